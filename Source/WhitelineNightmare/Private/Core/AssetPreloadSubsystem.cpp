@@ -0,0 +1,237 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Core/AssetPreloadSubsystem.h"
+#include "Core/GameDataStructs.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+
+namespace
+{
+	/** Append a soft reference if it is set */
+	template<typename T>
+	void AddSoftPath(const TSoftObjectPtr<T>& SoftAsset, TArray<FSoftObjectPath>& OutPaths)
+	{
+		if (!SoftAsset.IsNull())
+		{
+			OutPaths.AddUnique(SoftAsset.ToSoftObjectPath());
+		}
+	}
+
+	/** Walk every row of a table with a known row struct */
+	template<typename RowType>
+	void GatherTableAssets(const UDataTable* DataTable, TArray<FSoftObjectPath>& OutPaths)
+	{
+		DataTable->ForeachRow<RowType>(TEXT("UAssetPreloadSubsystem::PreloadDataTable"),
+			[&OutPaths](const FName& RowName, const RowType& Row)
+			{
+				UAssetPreloadSubsystem::GatherRowAssets(Row, OutPaths);
+			});
+	}
+}
+
+void UAssetPreloadSubsystem::Deinitialize()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	PreloadHandles.Empty();
+	PreloadedTables.Empty();
+	RequestedAssets.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAssetPreloadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UAssetPreloadSubsystem* UAssetPreloadSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UAssetPreloadSubsystem>() : nullptr;
+}
+
+int32 UAssetPreloadSubsystem::PreloadDataTable(const UDataTable* DataTable)
+{
+	if (!DataTable || PreloadedTables.Contains(DataTable))
+	{
+		return 0;
+	}
+	PreloadedTables.Add(DataTable);
+
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	TArray<FSoftObjectPath> AssetPaths;
+
+	if (RowStruct == FWorldTileData::StaticStruct())
+	{
+		GatherTableAssets<FWorldTileData>(DataTable, AssetPaths);
+	}
+	else if (RowStruct == FTurretData::StaticStruct())
+	{
+		GatherTableAssets<FTurretData>(DataTable, AssetPaths);
+	}
+	else if (RowStruct == FPickupData::StaticStruct())
+	{
+		GatherTableAssets<FPickupData>(DataTable, AssetPaths);
+	}
+	else if (RowStruct == FWarRigData::StaticStruct())
+	{
+		GatherTableAssets<FWarRigData>(DataTable, AssetPaths);
+	}
+	else if (RowStruct == FEnemyData::StaticStruct())
+	{
+		GatherTableAssets<FEnemyData>(DataTable, AssetPaths);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("AssetPreloadSubsystem: %s has no soft references to preload (row struct %s)"),
+			*DataTable->GetName(), *GetNameSafe(RowStruct));
+		return 0;
+	}
+
+	const int32 RequestedCount = PreloadAssets(AssetPaths);
+	UE_LOG(LogTemp, Log, TEXT("AssetPreloadSubsystem: Preloading %d asset(s) from %s"), RequestedCount, *DataTable->GetName());
+	return RequestedCount;
+}
+
+int32 UAssetPreloadSubsystem::PreloadAssets(const TArray<FSoftObjectPath>& AssetPaths)
+{
+	TArray<FSoftObjectPath> PathsToLoad;
+	PathsToLoad.Reserve(AssetPaths.Num());
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		if (AssetPath.IsNull() || RequestedAssets.Contains(AssetPath))
+		{
+			continue;
+		}
+
+		RequestedAssets.Add(AssetPath);
+		PathsToLoad.Add(AssetPath);
+	}
+
+	if (PathsToLoad.Num() == 0)
+	{
+		return 0;
+	}
+
+	bCompleteBroadcast = false;
+
+	// PreloadHandles keeps the handle (and so the assets) alive until the world goes away
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(PathsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UAssetPreloadSubsystem::HandleStreamingUpdate),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (Handle.IsValid())
+	{
+		Handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateWeakLambda(this,
+			[this](TSharedRef<FStreamableHandle>)
+			{
+				HandleStreamingUpdate();
+			}));
+		PreloadHandles.Add(Handle);
+	}
+
+	// Everything may already have been in memory, in which case the handle completed synchronously
+	HandleStreamingUpdate();
+
+	return PathsToLoad.Num();
+}
+
+float UAssetPreloadSubsystem::GetPreloadProgress() const
+{
+	int32 TotalAssets = 0;
+	float LoadedAssets = 0.0f;
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+	{
+		if (!Handle.IsValid())
+		{
+			continue;
+		}
+
+		int32 LoadedCount = 0;
+		int32 RequestedCount = 0;
+		Handle->GetLoadedCount(LoadedCount, RequestedCount);
+		TotalAssets += RequestedCount;
+		LoadedAssets += Handle->HasLoadCompleted() ? RequestedCount : Handle->GetProgress() * RequestedCount;
+	}
+
+	return TotalAssets > 0 ? LoadedAssets / TotalAssets : 1.0f;
+}
+
+bool UAssetPreloadSubsystem::IsPreloadComplete() const
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : PreloadHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UAssetPreloadSubsystem::HandleStreamingUpdate()
+{
+	OnPreloadProgress.Broadcast(GetPreloadProgress());
+
+	if (!bCompleteBroadcast && IsPreloadComplete())
+	{
+		bCompleteBroadcast = true;
+		UE_LOG(LogTemp, Log, TEXT("AssetPreloadSubsystem: Preload complete (%d asset(s) resident)"), RequestedAssets.Num());
+		OnPreloadComplete.Broadcast();
+	}
+}
+
+void UAssetPreloadSubsystem::NoteSyncFallback(const UObject* WorldContextObject, const FSoftObjectPath& AssetPath)
+{
+	if (UAssetPreloadSubsystem* Preloader = Get(WorldContextObject))
+	{
+		++Preloader->SyncFallbackCount;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("AssetPreloadSubsystem: %s was not preloaded, loading synchronously"), *AssetPath.ToString());
+}
+
+void UAssetPreloadSubsystem::GatherRowAssets(const FWorldTileData& Row, TArray<FSoftObjectPath>& OutPaths)
+{
+	AddSoftPath(Row.TileMesh, OutPaths);
+	AddSoftPath(Row.TileMaterial, OutPaths);
+}
+
+void UAssetPreloadSubsystem::GatherRowAssets(const FTurretData& Row, TArray<FSoftObjectPath>& OutPaths)
+{
+	AddSoftPath(Row.TurretMesh, OutPaths);
+	AddSoftPath(Row.Icon, OutPaths);
+	AddSoftPath(Row.ProjectileMesh, OutPaths);
+}
+
+void UAssetPreloadSubsystem::GatherRowAssets(const FPickupData& Row, TArray<FSoftObjectPath>& OutPaths)
+{
+	AddSoftPath(Row.PickupMesh, OutPaths);
+	AddSoftPath(Row.PickupSound, OutPaths);
+	AddSoftPath(Row.PickupParticle, OutPaths);
+}
+
+void UAssetPreloadSubsystem::GatherRowAssets(const FWarRigData& Row, TArray<FSoftObjectPath>& OutPaths)
+{
+	for (const TSoftObjectPtr<UStaticMesh>& MeshSection : Row.MeshSections)
+	{
+		AddSoftPath(MeshSection, OutPaths);
+	}
+	AddSoftPath(Row.PrimaryMaterial, OutPaths);
+	AddSoftPath(Row.SecondaryMaterial, OutPaths);
+}
+
+void UAssetPreloadSubsystem::GatherRowAssets(const FEnemyData& Row, TArray<FSoftObjectPath>& OutPaths)
+{
+	AddSoftPath(Row.EnemyMesh, OutPaths);
+}
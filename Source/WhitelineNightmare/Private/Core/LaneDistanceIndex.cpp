@@ -0,0 +1,163 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Core/LaneDistanceIndex.h"
+#include "GameFramework/Actor.h"
+
+FLaneDistanceIndex::FLaneDistanceIndex()
+	: BucketLength(1000.0f)
+	, NumBuckets(64)
+{
+}
+
+void FLaneDistanceIndex::Initialize(int32 InNumLanes, float InBucketLength, int32 InNumBuckets)
+{
+	BucketLength = FMath::Max(InBucketLength, 1.0f);
+	NumBuckets = FMath::Max(InNumBuckets, 1);
+
+	Locations.Empty();
+	Lanes.Empty(InNumLanes);
+	Lanes.SetNum(FMath::Max(InNumLanes, 0));
+	for (TArray<TArray<FEntry>>& LaneBuckets : Lanes)
+	{
+		LaneBuckets.SetNum(NumBuckets);
+	}
+}
+
+int32 FLaneDistanceIndex::GetBucketSlot(float RoadDistance) const
+{
+	const int64 BucketIndex = FMath::FloorToInt64(RoadDistance / BucketLength);
+	const int64 Slot = BucketIndex % NumBuckets;
+	return static_cast<int32>(Slot < 0 ? Slot + NumBuckets : Slot);
+}
+
+bool FLaneDistanceIndex::Add(AActor* Actor, int32 Lane, float RoadDistance)
+{
+	if (!Actor || Lane < 0)
+	{
+		return false;
+	}
+
+	const int32 Bucket = GetBucketSlot(RoadDistance);
+
+	const TObjectKey<AActor> Key(Actor);
+
+	// Already indexed: update in place when the bucket doesn't change
+	if (const FLocation* Existing = Locations.Find(Key))
+	{
+		if (Existing->Lane == Lane && Existing->Bucket == Bucket)
+		{
+			Lanes[Lane][Bucket][Existing->EntryIndex].RoadDistance = RoadDistance;
+			return true;
+		}
+
+		const FLocation OldLocation = *Existing;
+		Locations.Remove(Key);
+		RemoveAt(OldLocation);
+	}
+
+	// Grow lanes on demand
+	while (Lanes.Num() <= Lane)
+	{
+		Lanes.AddDefaulted_GetRef().SetNum(NumBuckets);
+	}
+
+	TArray<FEntry>& Entries = Lanes[Lane][Bucket];
+	const int32 EntryIndex = Entries.Add({ Key, Actor, RoadDistance });
+	Locations.Add(Key, { Lane, Bucket, EntryIndex });
+	return true;
+}
+
+bool FLaneDistanceIndex::Remove(const AActor* Actor)
+{
+	return Remove(TObjectKey<AActor>(Actor));
+}
+
+bool FLaneDistanceIndex::Remove(const TObjectKey<AActor>& Key)
+{
+	FLocation Location;
+	if (!Locations.RemoveAndCopyValue(Key, Location))
+	{
+		return false;
+	}
+
+	RemoveAt(Location);
+	return true;
+}
+
+void FLaneDistanceIndex::RemoveAt(const FLocation& Location)
+{
+	TArray<FEntry>& Entries = Lanes[Location.Lane][Location.Bucket];
+	Entries.RemoveAtSwap(Location.EntryIndex, 1, EAllowShrinking::No);
+
+	// Patch the entry that was swapped into the freed index
+	if (Location.EntryIndex < Entries.Num())
+	{
+		if (FLocation* Moved = Locations.Find(Entries[Location.EntryIndex].Key))
+		{
+			Moved->EntryIndex = Location.EntryIndex;
+		}
+	}
+}
+
+int32 FLaneDistanceIndex::Query(int32 LaneMin, int32 LaneMax, float DistanceMin, float DistanceMax, TArray<AActor*>& OutActors) const
+{
+	LaneMin = FMath::Max(LaneMin, 0);
+	LaneMax = FMath::Min(LaneMax, Lanes.Num() - 1);
+	if (LaneMin > LaneMax || DistanceMin > DistanceMax)
+	{
+		return 0;
+	}
+
+	// Visit each ring slot at most once, however long the range is
+	const int64 FirstBucket = FMath::FloorToInt64(DistanceMin / BucketLength);
+	const int64 LastBucket = FMath::FloorToInt64(DistanceMax / BucketLength);
+	const int32 NumBucketsToVisit = static_cast<int32>(FMath::Min<int64>(LastBucket - FirstBucket + 1, NumBuckets));
+	const int32 FirstSlot = GetBucketSlot(DistanceMin);
+
+	const int32 NumBefore = OutActors.Num();
+	for (int32 Lane = LaneMin; Lane <= LaneMax; ++Lane)
+	{
+		const TArray<TArray<FEntry>>& LaneBuckets = Lanes[Lane];
+		for (int32 i = 0; i < NumBucketsToVisit; ++i)
+		{
+			for (const FEntry& Entry : LaneBuckets[(FirstSlot + i) % NumBuckets])
+			{
+				// Exact distance check also rejects entries from buckets aliased in the ring
+				if (Entry.RoadDistance >= DistanceMin && Entry.RoadDistance <= DistanceMax)
+				{
+					if (AActor* Actor = Entry.Actor.Get())
+					{
+						OutActors.Add(Actor);
+					}
+				}
+			}
+		}
+	}
+
+	return OutActors.Num() - NumBefore;
+}
+
+bool FLaneDistanceIndex::GetEntry(const AActor* Actor, int32& OutLane, float& OutRoadDistance) const
+{
+	const FLocation* Location = Locations.Find(TObjectKey<AActor>(Actor));
+	if (!Location)
+	{
+		return false;
+	}
+
+	OutLane = Location->Lane;
+	OutRoadDistance = Lanes[Location->Lane][Location->Bucket][Location->EntryIndex].RoadDistance;
+	return true;
+}
+
+void FLaneDistanceIndex::Reset()
+{
+	Locations.Empty();
+	for (TArray<TArray<FEntry>>& LaneBuckets : Lanes)
+	{
+		for (TArray<FEntry>& Entries : LaneBuckets)
+		{
+			Entries.Reset();
+		}
+	}
+}
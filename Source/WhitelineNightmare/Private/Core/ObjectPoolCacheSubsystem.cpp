@@ -0,0 +1,161 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Core/ObjectPoolCacheSubsystem.h"
+#include "Core/ObjectPoolComponent.h"
+#include "Core/ObjectPoolSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+void UObjectPoolCacheSubsystem::Deinitialize()
+{
+	ClearCache();
+
+	Super::Deinitialize();
+}
+
+UObjectPoolCacheSubsystem* UObjectPoolCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UObjectPoolCacheSubsystem>() : nullptr;
+}
+
+int32 UObjectPoolCacheSubsystem::ParkPools(UWorld* World)
+{
+	// Actors the level being left never adopted weren't needed; don't carry them any further
+	ClearCache();
+
+	UObjectPoolSubsystem* PoolSubsystem = World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr;
+	if (!PoolSubsystem)
+	{
+		return 0;
+	}
+
+	TArray<UObjectPoolComponent*> Pools;
+	PoolSubsystem->GetAllPools(Pools);
+
+	int32 NumParked = 0;
+	for (UObjectPoolComponent* Pool : Pools)
+	{
+		if (Pool && Pool->IsPersistentAcrossLevels())
+		{
+			NumParked += ParkPool(Pool);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectPoolCacheSubsystem: Parked %d pooled actor(s) from %d pool(s) for travel"), NumParked, Pools.Num());
+	return NumParked;
+}
+
+int32 UObjectPoolCacheSubsystem::ParkPool(UObjectPoolComponent* Pool)
+{
+	if (!Pool || !Pool->GetPooledActorClass())
+	{
+		return 0;
+	}
+
+	TArray<AActor*> Actors;
+	Pool->ReleaseAllActors(Actors);
+
+	FCachedPoolEntry& Entry = CachedPools.FindOrAdd(Pool->GetPooledActorClass());
+	Entry.ParkedActors.Append(Actors);
+
+	UE_LOG(LogTemp, Log, TEXT("ObjectPoolCacheSubsystem: Parked %d actor(s) of %s"),
+		Actors.Num(), *Pool->GetPooledActorClass()->GetName());
+	return Actors.Num();
+}
+
+void UObjectPoolCacheSubsystem::GetParkedActors(TArray<AActor*>& OutActors) const
+{
+	for (const TPair<TSubclassOf<AActor>, FCachedPoolEntry>& Pair : CachedPools)
+	{
+		for (const TWeakObjectPtr<AActor>& ParkedActor : Pair.Value.ParkedActors)
+		{
+			if (AActor* Actor = ParkedActor.Get())
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+}
+
+int32 UObjectPoolCacheSubsystem::TakeParkedActors(TSubclassOf<AActor> ActorClass, const UWorld* World, int32 MaxCount, TArray<AActor*>& OutActors)
+{
+	FCachedPoolEntry* Entry = CachedPools.Find(ActorClass);
+	if (!Entry || MaxCount <= 0)
+	{
+		return 0;
+	}
+
+	int32 NumTaken = 0;
+	for (int32 Index = Entry->ParkedActors.Num() - 1; Index >= 0 && NumTaken < MaxCount; --Index)
+	{
+		AActor* Actor = Entry->ParkedActors[Index].Get();
+		if (!IsValid(Actor))
+		{
+			// Destroyed with its world (hard travel) or externally
+			Entry->ParkedActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (Actor->GetWorld() != World)
+		{
+			continue;
+		}
+
+		OutActors.Add(Actor);
+		Entry->ParkedActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		++NumTaken;
+	}
+
+	return NumTaken;
+}
+
+int32 UObjectPoolCacheSubsystem::GetParkedActorCount(TSubclassOf<AActor> ActorClass) const
+{
+	const FCachedPoolEntry* Entry = CachedPools.Find(ActorClass);
+	if (!Entry)
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	for (const TWeakObjectPtr<AActor>& ParkedActor : Entry->ParkedActors)
+	{
+		if (ParkedActor.IsValid())
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void UObjectPoolCacheSubsystem::ForgetClass(TSubclassOf<AActor> ActorClass)
+{
+	if (FCachedPoolEntry* Entry = CachedPools.Find(ActorClass))
+	{
+		DestroyParkedActors(*Entry);
+		CachedPools.Remove(ActorClass);
+	}
+}
+
+void UObjectPoolCacheSubsystem::ClearCache()
+{
+	for (TPair<TSubclassOf<AActor>, FCachedPoolEntry>& Pair : CachedPools)
+	{
+		DestroyParkedActors(Pair.Value);
+	}
+	CachedPools.Empty();
+}
+
+void UObjectPoolCacheSubsystem::DestroyParkedActors(FCachedPoolEntry& Entry)
+{
+	for (const TWeakObjectPtr<AActor>& ParkedActor : Entry.ParkedActors)
+	{
+		if (AActor* Actor = ParkedActor.Get())
+		{
+			Actor->Destroy();
+		}
+	}
+	Entry.ParkedActors.Empty();
+}
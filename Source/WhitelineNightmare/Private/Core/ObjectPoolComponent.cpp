@@ -3,7 +3,16 @@
 #include "Core/ObjectPoolComponent.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
-#include "EngineUtils.h"
+#include "Core/ObjectPoolSubsystem.h"
+#include "Core/ObjectPoolCacheSubsystem.h"
+
+namespace
+{
+	// Number of buckets the adaptive demand window is split into
+	constexpr int32 AdaptiveDemandBucketCount = 8;
+}
+
+int32 UObjectPoolComponent::LastPoolSerial = 0;
 
 UObjectPoolComponent::UObjectPoolComponent()
 {
@@ -11,6 +20,14 @@ UObjectPoolComponent::UObjectPoolComponent()
 	PrimaryComponentTick.bStartWithTickEnabled = false; // Only tick if debug visualization is enabled
 	bIsInitialized = false;
 	bShowDebugVisualization = false;
+	PendingPrewarmCount = 0;
+	bPoolReady = false;
+	bPrewarmCompleteBroadcast = false;
+	DemandBucketCursor = 0;
+	DemandBucketElapsed = 0.0f;
+	OverTargetTime = 0.0f;
+	PoolSerial = ++LastPoolSerial;
+	ConsumerCount = 0;
 }
 
 void UObjectPoolComponent::BeginPlay()
@@ -21,10 +38,62 @@ void UObjectPoolComponent::BeginPlay()
 	// Initialize() must be called manually with desired configuration
 }
 
+void UObjectPoolComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindDeferredFlush();
+
+	if (UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this))
+	{
+		PoolSubsystem->UnregisterPool(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UObjectPoolComponent::RemoveConsumer()
+{
+	ConsumerCount = FMath::Max(0, ConsumerCount - 1);
+}
+
+bool UObjectPoolComponent::CanRunPoolWideOperation(const TCHAR* Operation) const
+{
+	if (IsShared())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: %s rejected on %s - pool is shared by %d consumers; return your own actors instead"),
+			Operation, *GetName(), ConsumerCount);
+		return false;
+	}
+	return true;
+}
+
+void UObjectPoolComponent::RegisterWithSubsystem()
+{
+	if (UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this))
+	{
+		PoolSubsystem->RegisterPool(this);
+	}
+}
+
 void UObjectPoolComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// Continue spawning the initial pool, then adapt size to demand
+	if (PendingPrewarmCount > 0)
+	{
+		TickPrewarm();
+	}
+	else if (bIsInitialized && PoolConfig.bAdaptiveSizing)
+	{
+		TickAdaptiveSizing(DeltaTime);
+	}
+
+	// Stop ticking once there is no per-frame work left
+	if (!NeedsTick())
+	{
+		SetComponentTickEnabled(false);
+	}
+
 	// Draw debug visualization if enabled
 	if (bShowDebugVisualization)
 	{
@@ -55,30 +124,134 @@ bool UObjectPoolComponent::Initialize(TSubclassOf<AActor> ActorClass, const FObj
 		return false;
 	}
 
+	// Re-initializing would take out every consumer's active actors
+	if (!CanRunPoolWideOperation(TEXT("Initialize")))
+	{
+		return false;
+	}
+
 	// Store configuration
 	PooledActorClass = ActorClass;
 	PoolConfig = Config;
+	PoolConfig.PrewarmActorsPerFrame = FMath::Max(1, Config.PrewarmActorsPerFrame);
+	PoolConfig.MinReadyCount = (Config.MinReadyCount <= 0) ? Config.PoolSize : FMath::Min(Config.MinReadyCount, Config.PoolSize);
 
 	// Clear any existing pool
-	ClearPool();
-	AvailableObjects.Empty();
-	ActiveObjects.Empty();
-	AllPooledObjects.Empty();
+	ReturnAllActive();
+	FlushDeferredStateChanges();
+	ResetSlots();
+	ResetPoolStats();
+	PendingPrewarmCount = 0;
+	bPoolReady = false;
+	bPrewarmCompleteBroadcast = false;
+
+	// Reset the demand window
+	DemandBucketPeaks.Init(0, PoolConfig.bAdaptiveSizing ? AdaptiveDemandBucketCount : 0);
+	DemandBucketCursor = 0;
+	DemandBucketElapsed = 0.0f;
+	OverTargetTime = 0.0f;
+	if (PoolConfig.bAdaptiveSizing)
+	{
+		SetComponentTickEnabled(true);
+	}
+
+	// Deferred state changes are applied once per frame after all actors have ticked
+	if (PoolConfig.bDeferActorStateChanges)
+	{
+		BindDeferredFlush();
+	}
+	else
+	{
+		UnbindDeferredFlush();
+	}
+
+	// Actors carried over from the previous level count towards the initial pool
+	const int32 NumAdopted = PoolConfig.bPersistAcrossLevels ? AdoptParkedActors() : 0;
+	const int32 NumToSpawn = FMath::Max(PoolConfig.PoolSize - NumAdopted, 0);
+
+	if (PoolConfig.bTimeSlicedPrewarm)
+	{
+		// Spawn over the next frames from TickComponent
+		PendingPrewarmCount = NumToSpawn;
+		SetComponentTickEnabled(true);
+
+		bIsInitialized = true;
+		RegisterWithSubsystem();
+		UE_LOG(LogTemp, Log, TEXT("ObjectPoolComponent: Initialized pool of class %s, prewarming %d objects (%d per frame, %.2fms budget, ready at %d)"),
+			*ActorClass->GetName(), NumToSpawn, PoolConfig.PrewarmActorsPerFrame, PoolConfig.PrewarmBudgetMs, PoolConfig.MinReadyCount);
+		UpdatePrewarmState();
+		return true;
+	}
 
 	// Pre-spawn the pool
-	if (!PreSpawnPool(Config.PoolSize))
+	if (!PreSpawnPool(NumToSpawn))
 	{
 		UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to pre-spawn pool"));
 		return false;
 	}
 
 	bIsInitialized = true;
+	RegisterWithSubsystem();
 	UE_LOG(LogTemp, Log, TEXT("ObjectPoolComponent: Initialized pool with %d objects of class %s"),
-		Config.PoolSize, *ActorClass->GetName());
+		GetTotalPoolSize(), *ActorClass->GetName());
+
+	UpdatePrewarmState();
 
 	return true;
 }
 
+void UObjectPoolComponent::TickPrewarm()
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = PoolConfig.PrewarmBudgetMs / 1000.0;
+
+	int32 SpawnedThisFrame = 0;
+	while (PendingPrewarmCount > 0 && SpawnedThisFrame < PoolConfig.PrewarmActorsPerFrame)
+	{
+		// Always spawn at least one actor per frame so prewarm cannot stall
+		if (SpawnedThisFrame > 0 && BudgetSeconds > 0.0 && (FPlatformTime::Seconds() - StartTime) >= BudgetSeconds)
+		{
+			break;
+		}
+
+		AActor* NewActor = SpawnPooledActor();
+		if (!NewActor)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to spawn pooled actor during prewarm, abandoning %d pending"), PendingPrewarmCount);
+			PendingPrewarmCount = 0;
+			break;
+		}
+
+		DeactivateActor(NewActor);
+		AddSlot(NewActor);
+		--PendingPrewarmCount;
+		++SpawnedThisFrame;
+	}
+
+	UpdatePrewarmState();
+}
+
+void UObjectPoolComponent::UpdatePrewarmState()
+{
+	if (!bPoolReady && GetTotalPoolSize() >= PoolConfig.MinReadyCount)
+	{
+		bPoolReady = true;
+		UE_LOG(LogTemp, Log, TEXT("ObjectPoolComponent: Pool of %s ready (%d objects)"),
+			PooledActorClass ? *PooledActorClass->GetName() : TEXT("None"), GetTotalPoolSize());
+		OnPoolReady.Broadcast(this);
+	}
+
+	if (PendingPrewarmCount == 0 && bPoolReady)
+	{
+		// Only report completion once per initialization
+		if (!bPrewarmCompleteBroadcast)
+		{
+			bPrewarmCompleteBroadcast = true;
+			OnPrewarmComplete.Broadcast(this);
+		}
+	}
+}
+
 bool UObjectPoolComponent::PreSpawnPool(int32 NumToSpawn)
 {
 	UWorld* World = GetWorld();
@@ -100,13 +273,77 @@ bool UObjectPoolComponent::PreSpawnPool(int32 NumToSpawn)
 
 		// Deactivate and add to available pool
 		DeactivateActor(NewActor);
-		AvailableObjects.Add(NewActor);
-		AllPooledObjects.Add(NewActor);
+		AddSlot(NewActor);
 	}
 
 	return true;
 }
 
+int32 UObjectPoolComponent::AdoptParkedActors()
+{
+	UObjectPoolCacheSubsystem* PoolCache = UObjectPoolCacheSubsystem::Get(this);
+	if (!PoolCache)
+	{
+		return 0;
+	}
+
+	// Parked actors are already spawned, so take as many as the pool is allowed to hold
+	int32 MaxCount = PoolConfig.PoolSize;
+	if (PoolConfig.bAutoExpand)
+	{
+		MaxCount = PoolConfig.MaxPoolSize > 0 ? PoolConfig.MaxPoolSize : MAX_int32;
+	}
+
+	TArray<AActor*> Adopted;
+	PoolCache->TakeParkedActors(PooledActorClass, GetWorld(), MaxCount, Adopted);
+
+	for (AActor* Actor : Adopted)
+	{
+		Actor->SetOwner(GetOwner());
+		DeactivateActor(Actor);
+		AddSlot(Actor);
+
+		// References from the previous level are stale; inject this level's
+		OnPooledActorSpawned(Actor);
+	}
+
+	if (Adopted.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("ObjectPoolComponent: Adopted %d parked actor(s) of class %s"), Adopted.Num(), *PooledActorClass->GetName());
+	}
+	return Adopted.Num();
+}
+
+int32 UObjectPoolComponent::ReleaseAllActors(TArray<AActor*>& OutActors)
+{
+	if (!bIsInitialized || !CanRunPoolWideOperation(TEXT("ReleaseAllActors")))
+	{
+		return 0;
+	}
+
+	// Everything goes back inactive first (deferred changes are applied now, the actors are leaving)
+	ReturnAllActive();
+	FlushDeferredStateChanges();
+
+	int32 NumReleased = 0;
+	for (AActor* Actor : AvailableObjects)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+			Actor->SetOwner(nullptr);
+			OutActors.Add(Actor);
+			++NumReleased;
+		}
+	}
+
+	// The pool stays initialized but empty; it no longer spawns its remaining prewarm
+	ResetSlots();
+	PendingPrewarmCount = 0;
+
+	return NumReleased;
+}
+
 AActor* UObjectPoolComponent::SpawnPooledActor()
 {
 	UWorld* World = GetWorld();
@@ -121,25 +358,166 @@ AActor* UObjectPoolComponent::SpawnPooledActor()
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
 	AActor* NewActor = World->SpawnActor<AActor>(PooledActorClass, FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (NewActor)
+	{
+		OnPooledActorSpawned(NewActor);
+	}
 
 	return NewActor;
 }
 
 AActor* UObjectPoolComponent::GetFromPool(FVector SpawnLocation, FRotator SpawnRotation)
 {
+	FPooledActorHandle Handle;
+	return GetFromPoolWithHandle(SpawnLocation, SpawnRotation, Handle);
+}
+
+AActor* UObjectPoolComponent::GetFromPoolWithHandle(FVector SpawnLocation, FRotator SpawnRotation, FPooledActorHandle& OutHandle)
+{
+	OutHandle.Reset();
+
 	if (!bIsInitialized)
 	{
 		UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Cannot get from pool - not initialized"));
 		return nullptr;
 	}
 
-	AActor* Actor = nullptr;
+	const int32 SlotIndex = AcquireSlot(true);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = Slots[SlotIndex].Actor;
+
+	// Activate the actor first (before moving it), or queue activation for the end of frame
+	UpdateSlotActorState(SlotIndex);
+
+	// Set actor location and rotation (teleport to avoid physics issues)
+	Actor->SetActorLocationAndRotation(SpawnLocation, SpawnRotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	// Force component transforms to update (deferred mode shows the actor only after its final move)
+	if (!PoolConfig.bDeferActorStateChanges)
+	{
+		if (USceneComponent* RootComp = Actor->GetRootComponent())
+		{
+			RootComp->UpdateComponentToWorld();
+		}
+	}
+
+	PoolStats.PeakActiveCount = FMath::Max(PoolStats.PeakActiveCount, ActiveObjects.Num());
+	RecordDemand();
+
+	OutHandle = FPooledActorHandle(PoolSerial, SlotIndex, Slots[SlotIndex].Generation);
+
+	// Call OnActivated if actor implements IPoolableActor
+	if (Actor->Implements<UPoolableActor>())
+	{
+		IPoolableActor::Execute_OnActivated(Actor);
+	}
+
+	return Actor;
+}
+
+int32 UObjectPoolComponent::GetFromPoolBatch(TArrayView<const FTransform> SpawnTransforms, TArray<AActor*>& OutActors, TArray<FPooledActorHandle>* OutHandles)
+{
+	OutActors.Reset(SpawnTransforms.Num());
+	if (OutHandles)
+	{
+		OutHandles->Reset(SpawnTransforms.Num());
+	}
+
+	if (!bIsInitialized)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Cannot get batch from pool - not initialized"));
+		return 0;
+	}
+
+	const int32 ExpansionsBefore = PoolStats.ExpansionCount;
+
+	// Pass 1: reserve slots (stops at the first request the pool can't serve)
+	TArray<int32, TInlineAllocator<32>> AcquiredSlots;
+	for (int32 i = 0; i < SpawnTransforms.Num(); ++i)
+	{
+		const int32 SlotIndex = AcquireSlot(false);
+		if (SlotIndex == INDEX_NONE)
+		{
+			// Count the requests that were never attempted as misses too
+			PoolStats.ExhaustionMisses += SpawnTransforms.Num() - i - 1;
+			break;
+		}
+		AcquiredSlots.Add(SlotIndex);
+	}
+
+	// Pass 2: activate and place (SetActorTransform already updates component transforms)
+	for (int32 i = 0; i < AcquiredSlots.Num(); ++i)
+	{
+		const int32 SlotIndex = AcquiredSlots[i];
+		AActor* Actor = Slots[SlotIndex].Actor;
+
+		UpdateSlotActorState(SlotIndex);
+		Actor->SetActorTransform(SpawnTransforms[i], false, nullptr, ETeleportType::TeleportPhysics);
+
+		OutActors.Add(Actor);
+		if (OutHandles)
+		{
+			OutHandles->Add(FPooledActorHandle(PoolSerial, SlotIndex, Slots[SlotIndex].Generation));
+		}
+	}
+
+	PoolStats.PeakActiveCount = FMath::Max(PoolStats.PeakActiveCount, ActiveObjects.Num());
+	RecordDemand();
+
+	// Pass 3: notify once everything is in place
+	for (AActor* Actor : OutActors)
+	{
+		if (Actor->Implements<UPoolableActor>())
+		{
+			IPoolableActor::Execute_OnActivated(Actor);
+		}
+	}
+
+	// One summary log for the whole batch
+	const int32 NumExpanded = PoolStats.ExpansionCount - ExpansionsBefore;
+	if (NumExpanded > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted during batch, auto-expanded by %d (new size: %d)"),
+			NumExpanded, GetTotalPoolSize());
+	}
+	if (AcquiredSlots.Num() < SpawnTransforms.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Batch request for %d actors only got %d (pool exhausted)"),
+			SpawnTransforms.Num(), AcquiredSlots.Num());
+	}
+
+	return AcquiredSlots.Num();
+}
+
+int32 UObjectPoolComponent::AcquireSlot(bool bLogExpansion)
+{
+	int32 SlotIndex = INDEX_NONE;
 
 	// Check if we have available objects
-	if (AvailableObjects.Num() > 0)
+	if (AvailableSlotIndices.Num() > 0)
+	{
+		// Take the last available object (O(1), no shifting)
+		SlotIndex = AvailableSlotIndices.Last();
+	}
+	else if (PendingPrewarmCount > 0)
 	{
-		// Get last object from available pool (faster than removing from front)
-		Actor = AvailableObjects.Pop();
+		// Prewarm hasn't caught up with demand - spawn one of the pending actors now
+		AActor* Actor = SpawnPooledActor();
+		if (!Actor)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to spawn pending prewarm actor on demand"));
+			return INDEX_NONE;
+		}
+
+		// Freshly spawned actors start visible with collision
+		SlotIndex = AddSlot(Actor);
+		Slots[SlotIndex].bAppliedActive = true;
+		--PendingPrewarmCount;
+		UpdatePrewarmState();
 	}
 	else if (PoolConfig.bAutoExpand)
 	{
@@ -148,52 +526,49 @@ AActor* UObjectPoolComponent::GetFromPool(FVector SpawnLocation, FRotator SpawnR
 		if (PoolConfig.MaxPoolSize == 0 || CurrentPoolSize < PoolConfig.MaxPoolSize)
 		{
 			// Spawn a new actor
-			Actor = SpawnPooledActor();
-			if (Actor)
+			AActor* Actor = SpawnPooledActor();
+			if (!Actor)
 			{
-				AllPooledObjects.Add(Actor);
-				UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted, auto-expanding (new size: %d)"), CurrentPoolSize + 1);
+				UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to spawn new actor for pool expansion"));
+				return INDEX_NONE;
 			}
-			else
+
+			SlotIndex = AddSlot(Actor);
+			Slots[SlotIndex].bAppliedActive = true;
+			++PoolStats.ExpansionCount;
+			if (bLogExpansion)
 			{
-				UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to spawn new actor for pool expansion"));
-				return nullptr;
+				UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted, auto-expanding (new size: %d)"), CurrentPoolSize + 1);
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted and max size reached (%d)"), PoolConfig.MaxPoolSize);
-			return nullptr;
+			if (bLogExpansion)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted and max size reached (%d)"), PoolConfig.MaxPoolSize);
+			}
+			++PoolStats.ExhaustionMisses;
+			return INDEX_NONE;
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted and auto-expand is disabled"));
-		return nullptr;
-	}
-
-	// Activate the actor first (before moving it)
-	ActivateActor(Actor);
-
-	// Set actor location and rotation (teleport to avoid physics issues)
-	Actor->SetActorLocationAndRotation(SpawnLocation, SpawnRotation, false, nullptr, ETeleportType::TeleportPhysics);
-
-	// Force component transforms to update
-	if (USceneComponent* RootComp = Actor->GetRootComponent())
-	{
-		RootComp->UpdateComponentToWorld();
+		if (bLogExpansion)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Pool exhausted and auto-expand is disabled"));
+		}
+		++PoolStats.ExhaustionMisses;
+		return INDEX_NONE;
 	}
 
 	// Move to active pool
-	ActiveObjects.Add(Actor);
+	SetSlotActive(SlotIndex, true);
 
-	// Call OnActivated if actor implements IPoolableActor
-	if (Actor->Implements<UPoolableActor>())
-	{
-		IPoolableActor::Execute_OnActivated(Actor);
-	}
+	// Update stats
+	Slots[SlotIndex].ActivationTime = GetStatsTime();
+	++PoolStats.TotalAcquires;
 
-	return Actor;
+	return SlotIndex;
 }
 
 bool UObjectPoolComponent::ReturnToPool(AActor* Actor)
@@ -211,75 +586,183 @@ bool UObjectPoolComponent::ReturnToPool(AActor* Actor)
 	}
 
 	// Validate actor is from this pool
-	if (!ValidatePooledActor(Actor))
+	const int32 SlotIndex = FindSlotIndex(Actor);
+	if (SlotIndex == INDEX_NONE)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Trying to return actor that is not from this pool: %s"), *Actor->GetName());
 		return false;
 	}
 
 	// Check if already in available pool
-	if (AvailableObjects.Contains(Actor))
+	if (!Slots[SlotIndex].bIsActive)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Actor %s is already in available pool"), *Actor->GetName());
 		return false;
 	}
 
-	// Remove from active pool
-	int32 RemovedCount = ActiveObjects.Remove(Actor);
-	if (RemovedCount == 0)
+	ReleaseSlot(SlotIndex);
+	return true;
+}
+
+bool UObjectPoolComponent::ReturnToPoolByHandle(const FPooledActorHandle& Handle)
+{
+	if (!bIsInitialized)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Cannot return to pool - not initialized"));
+		return false;
+	}
+
+	if (!IsHandleValid(Handle))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Actor %s was not in active pool"), *Actor->GetName());
+		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Stale or foreign handle (pool %d, slot %d, generation %d) - not an active actor of this pool"),
+			Handle.PoolSerial, Handle.SlotIndex, Handle.Generation);
+		return false;
 	}
 
-	// Call OnDeactivated if actor implements IPoolableActor
-	if (Actor->Implements<UPoolableActor>())
+	ReleaseSlot(Handle.SlotIndex);
+	return true;
+}
+
+AActor* UObjectPoolComponent::ResolveHandle(const FPooledActorHandle& Handle) const
+{
+	return IsHandleValid(Handle) ? Slots[Handle.SlotIndex].Actor.Get() : nullptr;
+}
+
+bool UObjectPoolComponent::IsHandleValid(const FPooledActorHandle& Handle) const
+{
+	if (Handle.PoolSerial != PoolSerial || !Slots.IsValidIndex(Handle.SlotIndex))
 	{
-		IPoolableActor::Execute_OnDeactivated(Actor);
+		return false;
+	}
+
+	const FPooledActorSlot& Slot = Slots[Handle.SlotIndex];
+	return Slot.bIsActive && Slot.Generation == Handle.Generation;
+}
+
+FPooledActorHandle UObjectPoolComponent::GetHandleForActor(const AActor* Actor) const
+{
+	const int32 SlotIndex = FindSlotIndex(Actor);
+	if (SlotIndex == INDEX_NONE || !Slots[SlotIndex].bIsActive)
+	{
+		return FPooledActorHandle();
 	}
 
-	// Deactivate the actor
-	DeactivateActor(Actor);
+	return FPooledActorHandle(PoolSerial, SlotIndex, Slots[SlotIndex].Generation);
+}
 
-	// Move actor to origin to avoid confusion
-	Actor->SetActorLocation(FVector::ZeroVector);
+void UObjectPoolComponent::ReleaseSlot(int32 SlotIndex)
+{
+	AActor* Actor = Slots[SlotIndex].Actor;
 
-	// Add to available pool
-	AvailableObjects.Add(Actor);
+	// Invalidate outstanding handles before any callbacks run
+	++Slots[SlotIndex].Generation;
 
-	return true;
+	// Actor may have been destroyed externally; still free the slot so the lists stay consistent
+	if (IsValid(Actor) && Actor->Implements<UPoolableActor>())
+	{
+		IPoolableActor::Execute_OnDeactivated(Actor);
+	}
+
+	// Move from active to available pool
+	SetSlotActive(SlotIndex, false);
+	RecordRelease(SlotIndex);
+
+	// Deactivate and park at the origin, or queue that for the end of frame
+	UpdateSlotActorState(SlotIndex);
 }
 
-void UObjectPoolComponent::ClearPool()
+void UObjectPoolComponent::RecordRelease(int32 SlotIndex)
+{
+	const double TimeActive = GetStatsTime() - Slots[SlotIndex].ActivationTime;
+	++PoolStats.TotalReleases;
+	PoolStats.TotalTimeToReturn += TimeActive;
+	PoolStats.MaxTimeToReturn = FMath::Max(PoolStats.MaxTimeToReturn, static_cast<float>(TimeActive));
+}
+
+int32 UObjectPoolComponent::ReturnToPoolBatch(TArrayView<AActor* const> Actors)
 {
 	if (!bIsInitialized)
 	{
-		return;
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Cannot return batch to pool - not initialized"));
+		return 0;
 	}
 
-	// Return all active objects to the pool
-	TArray<AActor*> ActiveCopy = ActiveObjects; // Copy because ReturnToPool modifies ActiveObjects
-	for (AActor* Actor : ActiveCopy)
+	// Pass 1: validate and release slots; duplicates in the batch fail the active check after the first
+	TArray<int32, TInlineAllocator<32>> ReleasedSlots;
+	int32 NumRejected = 0;
+	for (AActor* Actor : Actors)
 	{
-		if (Actor)
+		const int32 SlotIndex = FindSlotIndex(Actor);
+		if (SlotIndex == INDEX_NONE || !Slots[SlotIndex].bIsActive)
 		{
-			ReturnToPool(Actor);
+			++NumRejected;
+			continue;
 		}
+
+		++Slots[SlotIndex].Generation;
+		SetSlotActive(SlotIndex, false);
+		RecordRelease(SlotIndex);
+
+		ReleasedSlots.Add(SlotIndex);
+	}
+
+	// Pass 2: notify
+	for (int32 SlotIndex : ReleasedSlots)
+	{
+		AActor* Actor = Slots[SlotIndex].Actor;
+		if (IsValid(Actor) && Actor->Implements<UPoolableActor>())
+		{
+			IPoolableActor::Execute_OnDeactivated(Actor);
+		}
+	}
+
+	// Pass 3: deactivate and park at the origin (or queue for the end of frame)
+	for (int32 SlotIndex : ReleasedSlots)
+	{
+		UpdateSlotActorState(SlotIndex);
+	}
+
+	if (NumRejected > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ObjectPoolComponent: Batch return rejected %d actor(s) not active in this pool"), NumRejected);
+	}
+
+	return Actors.Num() - NumRejected;
+}
+
+void UObjectPoolComponent::ClearPool()
+{
+	if (!bIsInitialized || !CanRunPoolWideOperation(TEXT("ClearPool")))
+	{
+		return;
+	}
+
+	ReturnAllActive();
+}
+
+void UObjectPoolComponent::ReturnAllActive()
+{
+	// Return all active objects to the pool (releasing the last entry avoids any shifting)
+	while (ActiveSlotIndices.Num() > 0)
+	{
+		ReleaseSlot(ActiveSlotIndices.Last());
 	}
 }
 
 void UObjectPoolComponent::ResetPool()
 {
-	if (!bIsInitialized)
+	if (!bIsInitialized || !CanRunPoolWideOperation(TEXT("ResetPool")))
 	{
 		return;
 	}
 
 	// Clear all active objects
-	ClearPool();
+	ReturnAllActive();
 
 	// Reset state on all pooled objects
-	for (AActor* Actor : AllPooledObjects)
+	for (const FPooledActorSlot& Slot : Slots)
 	{
+		AActor* Actor = Slot.Actor;
 		if (Actor && Actor->Implements<UPoolableActor>())
 		{
 			IPoolableActor::Execute_ResetState(Actor);
@@ -287,6 +770,242 @@ void UObjectPoolComponent::ResetPool()
 	}
 }
 
+void UObjectPoolComponent::TickAdaptiveSizing(float DeltaTime)
+{
+	// Advance the demand window; a new bucket starts from the current active count
+	const float BucketDuration = FMath::Max(PoolConfig.DemandWindowSeconds, 0.1f) / AdaptiveDemandBucketCount;
+	DemandBucketElapsed += DeltaTime;
+	if (DemandBucketElapsed >= BucketDuration)
+	{
+		DemandBucketElapsed = 0.0f;
+		DemandBucketCursor = (DemandBucketCursor + 1) % AdaptiveDemandBucketCount;
+		DemandBucketPeaks[DemandBucketCursor] = 0;
+	}
+	RecordDemand();
+
+	const int32 TargetSize = GetAdaptiveTargetSize();
+	const int32 CurrentSize = GetTotalPoolSize();
+
+	if (CurrentSize < TargetSize)
+	{
+		// Grow ahead of demand so GetFromPool doesn't have to spawn
+		OverTargetTime = 0.0f;
+		const int32 NumToSpawn = FMath::Min(TargetSize - CurrentSize, PoolConfig.MaxAdaptiveSpawnsPerFrame);
+		for (int32 i = 0; i < NumToSpawn; ++i)
+		{
+			AActor* NewActor = SpawnPooledActor();
+			if (!NewActor)
+			{
+				UE_LOG(LogTemp, Error, TEXT("ObjectPoolComponent: Failed to spawn actor for adaptive growth"));
+				break;
+			}
+
+			DeactivateActor(NewActor);
+			AddSlot(NewActor);
+			++PoolStats.AdaptiveGrowCount;
+		}
+	}
+	else if (CurrentSize > TargetSize && AvailableObjects.Num() > 0)
+	{
+		// Only trim after demand has stayed low for ShrinkDelaySeconds
+		OverTargetTime += DeltaTime;
+		if (OverTargetTime >= PoolConfig.ShrinkDelaySeconds)
+		{
+			const int32 NumToDestroy = FMath::Min3(CurrentSize - TargetSize, AvailableObjects.Num(), PoolConfig.MaxAdaptiveDestroysPerFrame);
+			for (int32 i = 0; i < NumToDestroy; ++i)
+			{
+				RemoveSlot(AvailableSlotIndices.Last());
+				++PoolStats.AdaptiveShrinkCount;
+			}
+		}
+	}
+	else
+	{
+		OverTargetTime = 0.0f;
+	}
+}
+
+void UObjectPoolComponent::RecordDemand()
+{
+	if (DemandBucketPeaks.IsValidIndex(DemandBucketCursor))
+	{
+		DemandBucketPeaks[DemandBucketCursor] = FMath::Max(DemandBucketPeaks[DemandBucketCursor], ActiveObjects.Num());
+	}
+}
+
+int32 UObjectPoolComponent::GetAdaptiveTargetSize() const
+{
+	if (!PoolConfig.bAdaptiveSizing)
+	{
+		return PoolConfig.PoolSize;
+	}
+
+	int32 WindowPeak = 0;
+	for (int32 BucketPeak : DemandBucketPeaks)
+	{
+		WindowPeak = FMath::Max(WindowPeak, BucketPeak);
+	}
+
+	const int32 Floor = PoolConfig.MinPoolSize > 0 ? PoolConfig.MinPoolSize : PoolConfig.PoolSize;
+	int32 TargetSize = FMath::Max(Floor, FMath::CeilToInt(WindowPeak * (1.0f + PoolConfig.GrowHeadroom)));
+	if (PoolConfig.MaxPoolSize > 0)
+	{
+		TargetSize = FMath::Min(TargetSize, PoolConfig.MaxPoolSize);
+	}
+
+	return TargetSize;
+}
+
+bool UObjectPoolComponent::NeedsTick() const
+{
+	return bShowDebugVisualization
+		|| PendingPrewarmCount > 0
+		|| (bIsInitialized && PoolConfig.bAdaptiveSizing)
+		|| PrimaryComponentTick.bStartWithTickEnabled;
+}
+
+void UObjectPoolComponent::SetDebugVisualization(bool bEnabled)
+{
+	bShowDebugVisualization = bEnabled;
+	SetComponentTickEnabled(NeedsTick());
+}
+
+FObjectPoolStats UObjectPoolComponent::GetPoolStats() const
+{
+	FObjectPoolStats Stats = PoolStats;
+	Stats.AverageTimeToReturn = Stats.TotalReleases > 0 ? static_cast<float>(Stats.TotalTimeToReturn / Stats.TotalReleases) : 0.0f;
+
+	TArray<AActor*> LeakedActors;
+	GetLeakedActors(LeakedActors);
+	Stats.LeakedActorCount = LeakedActors.Num();
+
+	return Stats;
+}
+
+void UObjectPoolComponent::ResetPoolStats()
+{
+	PoolStats = FObjectPoolStats();
+	PoolStats.PeakActiveCount = ActiveObjects.Num();
+}
+
+void UObjectPoolComponent::GetLeakedActors(TArray<AActor*>& OutLeakedActors) const
+{
+	OutLeakedActors.Reset();
+
+	if (PoolConfig.LeakDetectionTTL <= 0.0f)
+	{
+		return;
+	}
+
+	// Only active slots can leak, so this is O(active) rather than O(pool)
+	const double Now = GetStatsTime();
+	for (int32 SlotIndex : ActiveSlotIndices)
+	{
+		const FPooledActorSlot& Slot = Slots[SlotIndex];
+		if (Now - Slot.ActivationTime > PoolConfig.LeakDetectionTTL)
+		{
+			OutLeakedActors.Add(Slot.Actor);
+		}
+	}
+}
+
+double UObjectPoolComponent::GetStatsTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UObjectPoolComponent::UpdateSlotActorState(int32 SlotIndex)
+{
+	if (!PoolConfig.bDeferActorStateChanges)
+	{
+		ApplySlotActorState(SlotIndex);
+		return;
+	}
+
+	// Queue once; the flush compares desired vs applied state, so toggling back and forth is free
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	if (!Slot.bStateDirty)
+	{
+		Slot.bStateDirty = true;
+		DirtySlotIndices.Add(SlotIndex);
+	}
+}
+
+bool UObjectPoolComponent::ApplySlotActorState(int32 SlotIndex)
+{
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	AActor* Actor = Slot.Actor;
+	if (!IsValid(Actor) || Slot.bAppliedActive == Slot.bIsActive)
+	{
+		return false;
+	}
+
+	if (Slot.bIsActive)
+	{
+		ActivateActor(Actor);
+	}
+	else
+	{
+		DeactivateActor(Actor);
+
+		// Move actor to origin to avoid confusion
+		Actor->SetActorLocation(FVector::ZeroVector);
+	}
+
+	Slot.bAppliedActive = Slot.bIsActive;
+	return true;
+}
+
+void UObjectPoolComponent::FlushDeferredStateChanges()
+{
+	if (DirtySlotIndices.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 SlotIndex : DirtySlotIndices)
+	{
+		// Slots removed by ResetSlots are dropped from the queue with it; trimmed slots have a null actor
+		Slots[SlotIndex].bStateDirty = false;
+		if (ApplySlotActorState(SlotIndex))
+		{
+			++PoolStats.DeferredStateChangesApplied;
+		}
+		else
+		{
+			++PoolStats.DeferredStateChangesCoalesced;
+		}
+	}
+
+	DirtySlotIndices.Reset();
+}
+
+void UObjectPoolComponent::BindDeferredFlush()
+{
+	if (!PostActorTickHandle.IsValid())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UObjectPoolComponent::HandleWorldPostActorTick);
+	}
+}
+
+void UObjectPoolComponent::UnbindDeferredFlush()
+{
+	if (PostActorTickHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+		PostActorTickHandle.Reset();
+	}
+}
+
+void UObjectPoolComponent::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushDeferredStateChanges();
+	}
+}
+
 void UObjectPoolComponent::DeactivateActor(AActor* Actor)
 {
 	if (!Actor)
@@ -323,7 +1042,96 @@ void UObjectPoolComponent::ActivateActor(AActor* Actor)
 
 bool UObjectPoolComponent::ValidatePooledActor(AActor* Actor) const
 {
-	return AllPooledObjects.Contains(Actor);
+	return FindSlotIndex(Actor) != INDEX_NONE;
+}
+
+int32 UObjectPoolComponent::FindSlotIndex(const AActor* Actor) const
+{
+	const int32* SlotIndex = SlotIndexByActor.Find(Actor);
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+int32 UObjectPoolComponent::AddSlot(AActor* Actor)
+{
+	// Reuse a slot freed by adaptive trimming (keeps its generation, so old handles stay stale)
+	const int32 SlotIndex = FreeSlotIndices.Num() > 0 ? FreeSlotIndices.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	Slot.Actor = Actor;
+	Slot.bIsActive = false;
+	Slot.ListIndex = AvailableObjects.Add(Actor);
+	AvailableSlotIndices.Add(SlotIndex);
+	SlotIndexByActor.Add(Actor, SlotIndex);
+	return SlotIndex;
+}
+
+void UObjectPoolComponent::SetSlotActive(int32 SlotIndex, bool bActive)
+{
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	if (Slot.bIsActive == bActive)
+	{
+		return;
+	}
+
+	TArray<AActor*>& FromObjects = Slot.bIsActive ? ActiveObjects : AvailableObjects;
+	TArray<int32>& FromIndices = Slot.bIsActive ? ActiveSlotIndices : AvailableSlotIndices;
+	TArray<AActor*>& ToObjects = bActive ? ActiveObjects : AvailableObjects;
+	TArray<int32>& ToIndices = bActive ? ActiveSlotIndices : AvailableSlotIndices;
+
+	// Swap-remove from the source list, then patch the slot that was moved into the hole
+	const int32 OldListIndex = Slot.ListIndex;
+	FromObjects.RemoveAtSwap(OldListIndex, 1, EAllowShrinking::No);
+	FromIndices.RemoveAtSwap(OldListIndex, 1, EAllowShrinking::No);
+	if (OldListIndex < FromIndices.Num())
+	{
+		Slots[FromIndices[OldListIndex]].ListIndex = OldListIndex;
+	}
+
+	// Append to the destination list
+	Slot.ListIndex = ToObjects.Add(Slot.Actor);
+	ToIndices.Add(SlotIndex);
+	Slot.bIsActive = bActive;
+}
+
+void UObjectPoolComponent::RemoveSlot(int32 SlotIndex)
+{
+	FPooledActorSlot& Slot = Slots[SlotIndex];
+	check(!Slot.bIsActive);
+
+	// Swap-remove from the available list and patch the moved slot
+	const int32 OldListIndex = Slot.ListIndex;
+	AvailableObjects.RemoveAtSwap(OldListIndex, 1, EAllowShrinking::No);
+	AvailableSlotIndices.RemoveAtSwap(OldListIndex, 1, EAllowShrinking::No);
+	if (OldListIndex < AvailableSlotIndices.Num())
+	{
+		Slots[AvailableSlotIndices[OldListIndex]].ListIndex = OldListIndex;
+	}
+
+	AActor* Actor = Slot.Actor;
+	SlotIndexByActor.Remove(Actor);
+	if (IsValid(Actor))
+	{
+		Actor->Destroy();
+	}
+
+	Slot.Actor = nullptr;
+	Slot.ListIndex = INDEX_NONE;
+	++Slot.Generation;
+	FreeSlotIndices.Add(SlotIndex);
+}
+
+void UObjectPoolComponent::ResetSlots()
+{
+	// Handles issued before the reset must not match the rebuilt slots
+	PoolSerial = ++LastPoolSerial;
+
+	Slots.Empty();
+	DirtySlotIndices.Empty();
+	FreeSlotIndices.Empty();
+	SlotIndexByActor.Empty();
+	AvailableObjects.Empty();
+	AvailableSlotIndices.Empty();
+	ActiveObjects.Empty();
+	ActiveSlotIndices.Empty();
 }
 
 void UObjectPoolComponent::DrawDebugVisualization()
@@ -383,44 +1191,39 @@ static FAutoConsoleCommand DebugShowPoolsCommand(
 			return;
 		}
 
-		// Find all object pool components and toggle visualization
+		UObjectPoolSubsystem* PoolSubsystem = World->GetSubsystem<UObjectPoolSubsystem>();
+		if (!PoolSubsystem)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Console: No object pool subsystem in this world"));
+			return;
+		}
+
+		// Toggle visualization on every registered pool
+		TArray<UObjectPoolComponent*> PoolComponents;
+		PoolSubsystem->GetAllPools(PoolComponents);
+
 		int32 PoolCount = 0;
 		bool bNewState = true; // Default to enabling
 
-		for (TActorIterator<AActor> It(World); It; ++It)
+		for (UObjectPoolComponent* PoolComponent : PoolComponents)
 		{
-			AActor* Actor = *It;
-			if (Actor)
+			// Toggle visualization (if first pool, determine new state)
+			if (PoolCount == 0)
 			{
-				TArray<UObjectPoolComponent*> PoolComponents;
-				Actor->GetComponents<UObjectPoolComponent>(PoolComponents);
-
-				for (UObjectPoolComponent* PoolComponent : PoolComponents)
-				{
-					if (PoolComponent)
-					{
-						// Toggle visualization (if first pool, determine new state)
-						if (PoolCount == 0)
-						{
-							bNewState = !PoolComponent->IsDebugVisualizationEnabled();
-						}
-
-						PoolComponent->SetDebugVisualization(bNewState);
-
-						// Enable ticking for debug visualization
-						PoolComponent->SetComponentTickEnabled(bNewState);
-
-						PoolCount++;
-
-						UE_LOG(LogTemp, Log, TEXT("Pool #%d: %s (Active: %d, Available: %d, Total: %d)"),
-							PoolCount,
-							*PoolComponent->GetOwner()->GetName(),
-							PoolComponent->GetActiveCount(),
-							PoolComponent->GetAvailableCount(),
-							PoolComponent->GetTotalPoolSize());
-					}
-				}
+				bNewState = !PoolComponent->IsDebugVisualizationEnabled();
 			}
+
+			// Also enables/disables ticking as needed
+			PoolComponent->SetDebugVisualization(bNewState);
+
+			PoolCount++;
+
+			UE_LOG(LogTemp, Log, TEXT("Pool #%d: %s (Active: %d, Available: %d, Total: %d)"),
+				PoolCount,
+				*PoolComponent->GetName(),
+				PoolComponent->GetActiveCount(),
+				PoolComponent->GetAvailableCount(),
+				PoolComponent->GetTotalPoolSize());
 		}
 
 		if (PoolCount == 0)
@@ -435,4 +1238,86 @@ static FAutoConsoleCommand DebugShowPoolsCommand(
 	})
 );
 
+static FAutoConsoleCommand DebugPoolStatsCommand(
+	TEXT("DebugPoolStats"),
+	TEXT("Print usage statistics (peak, expansions, misses, time-to-return, leaks) for all object pools in the world"),
+	FConsoleCommandDelegate::CreateStatic([]()
+	{
+		UWorld* World = nullptr;
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
+			{
+				World = Context.World();
+				break;
+			}
+		}
+
+		if (!World)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Console: No valid world found"));
+			return;
+		}
+
+		UObjectPoolSubsystem* PoolSubsystem = World->GetSubsystem<UObjectPoolSubsystem>();
+		if (!PoolSubsystem)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Console: No object pool subsystem in this world"));
+			return;
+		}
+
+		TArray<UObjectPoolComponent*> PoolComponents;
+		PoolSubsystem->GetAllPools(PoolComponents);
+
+		int32 PoolCount = 0;
+		for (UObjectPoolComponent* PoolComponent : PoolComponents)
+		{
+			const FObjectPoolStats Stats = PoolComponent->GetPoolStats();
+			const TSubclassOf<AActor> PooledClass = PoolComponent->GetPooledActorClass();
+			PoolCount++;
+
+			UE_LOG(LogTemp, Log, TEXT("Pool #%d: %s [%s] Size=%d Active=%d Peak=%d"),
+				PoolCount,
+				*PoolComponent->GetName(),
+				PooledClass ? *PooledClass->GetName() : TEXT("None"),
+				PoolComponent->GetTotalPoolSize(),
+				PoolComponent->GetActiveCount(),
+				Stats.PeakActiveCount);
+			UE_LOG(LogTemp, Log, TEXT("    Acquires=%d Releases=%d Expansions=%d AdaptiveGrow=%d AdaptiveShrink=%d Misses=%d (%.1f%%)"),
+				Stats.TotalAcquires,
+				Stats.TotalReleases,
+				Stats.ExpansionCount,
+				Stats.AdaptiveGrowCount,
+				Stats.AdaptiveShrinkCount,
+				Stats.ExhaustionMisses,
+				Stats.GetMissRate() * 100.0f);
+			UE_LOG(LogTemp, Log, TEXT("    TimeToReturn Avg=%.2fs Max=%.2fs"),
+				Stats.AverageTimeToReturn,
+				Stats.MaxTimeToReturn);
+			if (Stats.DeferredStateChangesApplied + Stats.DeferredStateChangesCoalesced > 0)
+			{
+				UE_LOG(LogTemp, Log, TEXT("    DeferredStateChanges Applied=%d Coalesced=%d"),
+					Stats.DeferredStateChangesApplied,
+					Stats.DeferredStateChangesCoalesced);
+			}
+
+			if (Stats.LeakedActorCount > 0)
+			{
+				TArray<AActor*> LeakedActors;
+				PoolComponent->GetLeakedActors(LeakedActors);
+				UE_LOG(LogTemp, Warning, TEXT("    %d actor(s) active longer than TTL - likely leaks:"), Stats.LeakedActorCount);
+				for (AActor* LeakedActor : LeakedActors)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("      %s"), *GetNameSafe(LeakedActor));
+				}
+			}
+		}
+
+		if (PoolCount == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("No object pools found in the world"));
+		}
+	})
+);
+
 #endif // !UE_BUILD_SHIPPING
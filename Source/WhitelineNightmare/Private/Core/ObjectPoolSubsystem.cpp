@@ -0,0 +1,163 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Core/ObjectPoolSubsystem.h"
+#include "Core/ObjectPoolComponent.h"
+#include "Engine/World.h"
+
+namespace
+{
+	/** Settings that change how a shared pool behaves for everyone drawing from it */
+	bool DoPoolConfigsMatch(const FObjectPoolConfig& A, const FObjectPoolConfig& B)
+	{
+		return A.PoolSize == B.PoolSize
+			&& A.bAutoExpand == B.bAutoExpand
+			&& A.MaxPoolSize == B.MaxPoolSize
+			&& A.bTimeSlicedPrewarm == B.bTimeSlicedPrewarm
+			&& A.bAdaptiveSizing == B.bAdaptiveSizing
+			&& A.bDeferActorStateChanges == B.bDeferActorStateChanges
+			&& A.bPersistAcrossLevels == B.bPersistAcrossLevels;
+	}
+}
+
+void UObjectPoolSubsystem::Deinitialize()
+{
+	PoolsByClass.Empty();
+	RegisteredPools.Empty();
+	PoolHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UObjectPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UObjectPoolSubsystem* UObjectPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UObjectPoolSubsystem>() : nullptr;
+}
+
+UObjectPoolComponent* UObjectPoolSubsystem::GetOrCreatePool(TSubclassOf<AActor> ActorClass, const FObjectPoolConfig& Config)
+{
+	if (!ActorClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolSubsystem: Cannot create pool for null ActorClass"));
+		return nullptr;
+	}
+
+	// Share the existing pool
+	if (UObjectPoolComponent* ExistingPool = FindPool(ActorClass))
+	{
+		if (!DoPoolConfigsMatch(ExistingPool->GetPoolConfig(), Config))
+		{
+			const FObjectPoolConfig& Existing = ExistingPool->GetPoolConfig();
+			UE_LOG(LogTemp, Warning, TEXT("ObjectPoolSubsystem: Pool for %s is already configured differently (size %d, max %d, expand %d, persist %d); requested config (size %d, max %d, expand %d, persist %d) is ignored"),
+				*ActorClass->GetName(),
+				Existing.PoolSize, Existing.MaxPoolSize, Existing.bAutoExpand, Existing.bPersistAcrossLevels,
+				Config.PoolSize, Config.MaxPoolSize, Config.bAutoExpand, Config.bPersistAcrossLevels);
+		}
+
+		ExistingPool->AddConsumer();
+		UE_LOG(LogTemp, Verbose, TEXT("ObjectPoolSubsystem: Sharing existing pool for %s (size %d, %d consumers)"),
+			*ActorClass->GetName(), ExistingPool->GetTotalPoolSize(), ExistingPool->GetConsumerCount());
+		return ExistingPool;
+	}
+
+	AActor* Host = GetOrCreatePoolHost();
+	if (!Host)
+	{
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolSubsystem: Failed to create pool host actor"));
+		return nullptr;
+	}
+
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(Host, UObjectPoolComponent::StaticClass(),
+		MakeUniqueObjectName(Host, UObjectPoolComponent::StaticClass(), *FString::Printf(TEXT("Pool_%s"), *ActorClass->GetName())));
+	Pool->RegisterComponent();
+
+	if (!Pool->Initialize(ActorClass, Config))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ObjectPoolSubsystem: Failed to initialize pool for %s"), *ActorClass->GetName());
+		Pool->DestroyComponent();
+		return nullptr;
+	}
+
+	Pool->AddConsumer();
+	PoolsByClass.Add(ActorClass, Pool);
+	UE_LOG(LogTemp, Log, TEXT("ObjectPoolSubsystem: Created shared pool for %s"), *ActorClass->GetName());
+
+	return Pool;
+}
+
+void UObjectPoolSubsystem::ReleasePool(UObjectPoolComponent* Pool)
+{
+	if (Pool)
+	{
+		Pool->RemoveConsumer();
+	}
+}
+
+UObjectPoolComponent* UObjectPoolSubsystem::FindPool(TSubclassOf<AActor> ActorClass) const
+{
+	const TObjectPtr<UObjectPoolComponent>* Pool = PoolsByClass.Find(ActorClass);
+	return (Pool && IsValid(*Pool)) ? Pool->Get() : nullptr;
+}
+
+void UObjectPoolSubsystem::RegisterPool(UObjectPoolComponent* Pool)
+{
+	if (Pool)
+	{
+		RegisteredPools.AddUnique(Pool);
+	}
+}
+
+void UObjectPoolSubsystem::UnregisterPool(UObjectPoolComponent* Pool)
+{
+	RegisteredPools.RemoveAllSwap([Pool](const TWeakObjectPtr<UObjectPoolComponent>& Entry)
+	{
+		return !Entry.IsValid() || Entry.Get() == Pool;
+	});
+
+	for (auto It = PoolsByClass.CreateIterator(); It; ++It)
+	{
+		if (It->Value == Pool)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UObjectPoolSubsystem::GetAllPools(TArray<UObjectPoolComponent*>& OutPools) const
+{
+	OutPools.Reset(RegisteredPools.Num());
+	for (const TWeakObjectPtr<UObjectPoolComponent>& Pool : RegisteredPools)
+	{
+		if (Pool.IsValid())
+		{
+			OutPools.Add(Pool.Get());
+		}
+	}
+}
+
+AActor* UObjectPoolSubsystem::GetOrCreatePoolHost()
+{
+	if (IsValid(PoolHost))
+	{
+		return PoolHost;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("ObjectPoolHost"));
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	PoolHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	return PoolHost;
+}
@@ -0,0 +1,174 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Core/ScrollMoverSubsystem.h"
+#include "Core/WorldScrollComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void FScrollMoverTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->TickMovers(DeltaTime);
+	}
+}
+
+FString FScrollMoverTickFunction::DiagnosticMessage()
+{
+	return TEXT("UScrollMoverSubsystem::TickMovers");
+}
+
+void UScrollMoverSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	MoverTickFunction.Target = this;
+	MoverTickFunction.bCanEverTick = true;
+	MoverTickFunction.bStartWithTickEnabled = true;
+	MoverTickFunction.TickGroup = TG_PrePhysics;
+	MoverTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UScrollMoverSubsystem::Deinitialize()
+{
+	if (MoverTickFunction.IsTickFunctionRegistered())
+	{
+		MoverTickFunction.UnRegisterTickFunction();
+	}
+	MoverTickFunction.Target = nullptr;
+
+	Movers.Empty();
+	MoverKeys.Empty();
+	MoverIndexByActor.Empty();
+	LaneIndex.Reset();
+	ScrollSource.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UScrollMoverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UScrollMoverSubsystem* UScrollMoverSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UScrollMoverSubsystem>() : nullptr;
+}
+
+void UScrollMoverSubsystem::SetScrollSource(UWorldScrollComponent* ScrollComponent)
+{
+	if (UWorldScrollComponent* OldSource = ScrollSource.Get())
+	{
+		MoverTickFunction.RemovePrerequisite(OldSource, OldSource->PrimaryComponentTick);
+	}
+
+	ScrollSource = ScrollComponent;
+
+	// Run after the scroll source so movers use this frame's velocity
+	if (ScrollComponent)
+	{
+		MoverTickFunction.AddPrerequisite(ScrollComponent, ScrollComponent->PrimaryComponentTick);
+		UE_LOG(LogTemp, Log, TEXT("ScrollMoverSubsystem: Scroll source set to %s"), *GetNameSafe(ScrollComponent->GetOwner()));
+	}
+}
+
+void UScrollMoverSubsystem::ClearScrollSource(UWorldScrollComponent* ScrollComponent)
+{
+	if (ScrollSource.Get() == ScrollComponent)
+	{
+		SetScrollSource(nullptr);
+	}
+}
+
+void UScrollMoverSubsystem::RegisterMover(AActor* Actor)
+{
+	const TObjectKey<AActor> Key(Actor);
+	if (!Actor || MoverIndexByActor.Contains(Key))
+	{
+		return;
+	}
+
+	MoverKeys.Add(Key);
+	MoverIndexByActor.Add(Key, Movers.Add(Actor));
+}
+
+void UScrollMoverSubsystem::UnregisterMover(AActor* Actor)
+{
+	const int32* MoverIndex = MoverIndexByActor.Find(TObjectKey<AActor>(Actor));
+	if (MoverIndex)
+	{
+		RemoveMoverAt(*MoverIndex);
+	}
+
+	// Road distance is meaningless once the actor stops scrolling
+	LaneIndex.Remove(Actor);
+}
+
+void UScrollMoverSubsystem::RegisterLaneEntity(AActor* Actor, int32 Lane)
+{
+	if (Actor)
+	{
+		LaneIndex.Add(Actor, Lane, GetRoadDistanceAtWorldX(Actor->GetActorLocation().X));
+	}
+}
+
+int32 UScrollMoverSubsystem::QueryLaneRange(int32 LaneMin, int32 LaneMax, float WorldXMin, float WorldXMax, TArray<AActor*>& OutActors) const
+{
+	return LaneIndex.Query(LaneMin, LaneMax, GetRoadDistanceAtWorldX(WorldXMin), GetRoadDistanceAtWorldX(WorldXMax), OutActors);
+}
+
+int32 UScrollMoverSubsystem::QueryAllLanes(float WorldXMin, float WorldXMax, TArray<AActor*>& OutActors) const
+{
+	if (LaneIndex.Num() == 0)
+	{
+		return 0;
+	}
+
+	return QueryLaneRange(0, LaneIndex.GetNumLanes() - 1, WorldXMin, WorldXMax, OutActors);
+}
+
+void UScrollMoverSubsystem::RemoveMoverAt(int32 MoverIndex)
+{
+	// Remove by the stored key: the pointer is already null if GC collected the actor
+	const TObjectKey<AActor> Key = MoverKeys[MoverIndex];
+	MoverIndexByActor.Remove(Key);
+	LaneIndex.Remove(Key);
+	Movers.RemoveAtSwap(MoverIndex, 1, EAllowShrinking::No);
+	MoverKeys.RemoveAtSwap(MoverIndex, 1, EAllowShrinking::No);
+	if (MoverIndex < Movers.Num())
+	{
+		MoverIndexByActor.Add(MoverKeys[MoverIndex], MoverIndex);
+	}
+}
+
+void UScrollMoverSubsystem::TickMovers(float DeltaTime)
+{
+	const UWorldScrollComponent* Source = ScrollSource.Get();
+	if (!Source)
+	{
+		return;
+	}
+
+	// Track the applied offset even with no movers so road distances stay consistent
+	const FVector DeltaLocation = Source->GetScrollVelocity() * DeltaTime;
+	ScrollOffsetX += DeltaLocation.X;
+	if (DeltaLocation.IsZero() || Movers.Num() == 0)
+	{
+		return;
+	}
+
+	// Iterate backwards so destroyed movers can be swap-removed in place
+	for (int32 i = Movers.Num() - 1; i >= 0; --i)
+	{
+		AActor* Mover = Movers[i];
+		if (!IsValid(Mover))
+		{
+			RemoveMoverAt(i);
+			continue;
+		}
+
+		Mover->AddActorWorldOffset(DeltaLocation);
+	}
+}
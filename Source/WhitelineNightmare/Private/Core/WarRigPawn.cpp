@@ -2,7 +2,11 @@
 
 #include "Core/WarRigPawn.h"
 #include "Core/LaneSystemComponent.h"
+#include "Core/AssetPreloadSubsystem.h"
 #include "Core/WarRigHUD.h"
+#include "Core/ObjectPoolSubsystem.h"
+#include "Core/ObjectPoolComponent.h"
+#include "Turrets/TurretBase.h"
 #include "AbilitySystemComponent.h"
 #include "GAS/WarRigAttributeSet.h"
 #include "GAS/GameplayAbility_FuelDrain.h"
@@ -10,6 +14,8 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "Engine/DataTable.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
@@ -53,6 +59,13 @@ AWarRigPawn::AWarRigPawn()
 	MountPointDebugColor = FColor::Cyan;
 	MountPointDebugSize = 50.0f;
 
+	// Mounted turrets' ability systems replicate and tick unless the rig opts out
+	bLightweightTurretAbilitySystems = false;
+
+	// Turrets are bought and sold a few at a time; keep a small pool per class that grows on demand
+	TurretPoolConfig.PoolSize = 2;
+	TurretPoolConfig.bAutoExpand = true;
+
 	// Default rig ID
 	CurrentRigID = FName("SemiTruck");
 }
@@ -135,13 +148,36 @@ void AWarRigPawn::BeginPlay()
 		UE_LOG(LogTemp, Error, TEXT("AWarRigPawn::BeginPlay - AbilitySystemComponent is null!"));
 	}
 
-	// Load war rig configuration from data table
+	// Stream rig and turret assets in the background (no-op if the game mode already preloaded these tables)
+	if (UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this))
+	{
+		Preloader->PreloadDataTable(WarRigDataTable);
+		Preloader->PreloadDataTable(TurretDataTable);
+	}
+
+	// Load the configuration right away: CreateMeshComponents streams and assembles each section as its
+	// mesh arrives, so the rig doesn't wait on the world preload (tile and turret tables included)
 	LoadWarRigConfiguration(CurrentRigID);
 
 	// Ensure we're at world origin (defensive check)
 	SetActorLocation(FVector::ZeroVector);
 }
 
+void AWarRigPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Other rigs may keep drawing from the shared turret pools
+	if (UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this))
+	{
+		for (const TPair<TSubclassOf<AActor>, TObjectPtr<UObjectPoolComponent>>& Pair : TurretPools)
+		{
+			PoolSubsystem->ReleasePool(Pair.Value);
+		}
+	}
+	TurretPools.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AWarRigPawn::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -209,6 +245,96 @@ UAbilitySystemComponent* AWarRigPawn::GetAbilitySystemComponent() const
 	return AbilitySystemComponent;
 }
 
+UCombatAttributeSet* AWarRigPawn::GetTurretAttributeSet(int32 MountIndex) const
+{
+	const ATurretBase* Turret = GetTurretAtMount(MountIndex);
+	return Turret ? Turret->GetCombatAttributeSet() : nullptr;
+}
+
+ATurretBase* AWarRigPawn::PlaceTurret(const FTurretData& TurretData, int32 MountIndex)
+{
+	if (!TurretData.TurretClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AWarRigPawn::PlaceTurret - Turret data has no TurretClass"));
+		return nullptr;
+	}
+
+	if (!MountPointComponents.IsValidIndex(MountIndex) || !MountPointComponents[MountIndex])
+	{
+		UE_LOG(LogTemp, Error, TEXT("AWarRigPawn::PlaceTurret - Invalid mount index %d"), MountIndex);
+		return nullptr;
+	}
+
+	if (GetTurretAtMount(MountIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::PlaceTurret - Mount %d is already occupied"), MountIndex);
+		return nullptr;
+	}
+
+	// One consumer registration per turret class, not per placement
+	UObjectPoolComponent* Pool = TurretPools.FindRef(TurretData.TurretClass);
+	if (!IsValid(Pool))
+	{
+		UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this);
+		Pool = PoolSubsystem ? PoolSubsystem->GetOrCreatePool(TurretData.TurretClass, TurretPoolConfig) : nullptr;
+		if (Pool)
+		{
+			TurretPools.Add(TurretData.TurretClass, Pool);
+		}
+	}
+	if (!Pool)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AWarRigPawn::PlaceTurret - No turret pool for %s"), *TurretData.TurretClass->GetName());
+		return nullptr;
+	}
+
+	USceneComponent* MountPoint = MountPointComponents[MountIndex];
+	ATurretBase* Turret = Cast<ATurretBase>(Pool->GetFromPool(MountPoint->GetComponentLocation(), MountPoint->GetComponentRotation()));
+	if (!Turret)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::PlaceTurret - Turret pool for %s is exhausted"), *TurretData.TurretClass->GetName());
+		return nullptr;
+	}
+
+	Turret->AttachToComponent(MountPoint, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	Turret->Initialize(TurretData, MountIndex, MountPoint->GetComponentRotation(), this);
+	SpawnedTurrets.Add(Turret);
+
+	return Turret;
+}
+
+bool AWarRigPawn::RemoveTurret(int32 MountIndex)
+{
+	ATurretBase* Turret = GetTurretAtMount(MountIndex);
+	if (!Turret)
+	{
+		return false;
+	}
+
+	SpawnedTurrets.Remove(Turret);
+
+	// The pool's deactivation resets the turret (effects, attributes, mount)
+	UObjectPoolComponent* Pool = TurretPools.FindRef(Turret->GetClass());
+	if (!IsValid(Pool) || !Pool->ReturnToPool(Turret))
+	{
+		Turret->Destroy();
+	}
+
+	return true;
+}
+
+ATurretBase* AWarRigPawn::GetTurretAtMount(int32 MountIndex) const
+{
+	for (ATurretBase* Turret : SpawnedTurrets)
+	{
+		if (Turret && Turret->GetMountIndex() == MountIndex)
+		{
+			return Turret;
+		}
+	}
+	return nullptr;
+}
+
 void AWarRigPawn::LoadWarRigConfiguration(const FName& RigID)
 {
 	if (!WarRigDataTable)
@@ -234,76 +360,200 @@ void AWarRigPawn::LoadWarRigConfiguration(const FName& RigID)
 		return;
 	}
 
+	// Drop any assembly still streaming for the previous configuration
+	if (SectionMeshHandle.IsValid())
+	{
+		SectionMeshHandle->CancelHandle();
+		SectionMeshHandle.Reset();
+	}
+
 	// Cache the data
 	CachedRigData = *RigData;
 	CurrentRigID = RigID;
 
-	// Clear existing components
-	ClearMeshComponents();
-	ClearMountPoints();
+	// Turrets on mounts the new rig doesn't have go back to their pool; the rest leave the old mounts
+	// before those are destroyed and are re-homed onto the new mount with the same index
+	TArray<int32> LostMounts;
+	for (ATurretBase* Turret : SpawnedTurrets)
+	{
+		if (Turret && Turret->GetMountIndex() >= RigData->MountPoints.Num())
+		{
+			LostMounts.Add(Turret->GetMountIndex());
+		}
+		else if (Turret)
+		{
+			Turret->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		}
+	}
+	for (int32 MountIndex : LostMounts)
+	{
+		UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::LoadWarRigConfiguration - Rig %s has no mount %d, removing its turret"), *RigID.ToString(), MountIndex);
+		RemoveTurret(MountIndex);
+	}
 
-	// Create new components from data
-	CreateMeshComponents(*RigData);
+	// Mount points and camera don't depend on meshes
+	ClearMountPoints();
 	CreateMountPoints(*RigData);
+	RehomeTurrets();
 	SetupCamera(*RigData);
-	ApplyVisualProperties(*RigData);
 
-	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::LoadWarRigConfiguration - Successfully loaded configuration for: %s (%s)"),
-		*RigID.ToString(), *RigData->DisplayName.ToString());
+	// Section components are reused; meshes that aren't resident stream in
+	CreateMeshComponents(*RigData);
+
+	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::LoadWarRigConfiguration - Successfully loaded configuration for: %s (%s), %d section(s) streaming"),
+		*RigID.ToString(), *RigData->DisplayName.ToString(), PendingMeshSections.Num());
+}
+
+void AWarRigPawn::SwapWarRig(FName NewRigID)
+{
+	if (NewRigID == CurrentRigID && IsRigAssemblyComplete() && MeshComponents.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::SwapWarRig - Already using %s"), *NewRigID.ToString());
+		return;
+	}
+
+	LoadWarRigConfiguration(NewRigID);
 }
 
 void AWarRigPawn::CreateMeshComponents(const FWarRigData& RigData)
 {
-	// For MVP, we'll use simple cube meshes positioned linearly
+	// Keep one component per section (reused across rig swaps), indexed by section
+	TrimMeshComponents(RigData.MeshSections.Num());
+	MeshComponents.SetNum(RigData.MeshSections.Num());
+	PendingMeshSections.Reset();
+	bRigAssemblyFinished = false;
+
+	// Sections with a resident mesh (or no mesh) are assembled now, the rest stream in
+	TArray<FSoftObjectPath> MeshesToStream;
+	for (int32 i = 0; i < RigData.MeshSections.Num(); i++)
+	{
+		const TSoftObjectPtr<UStaticMesh>& SectionMesh = RigData.MeshSections[i];
+		if (SectionMesh.IsNull() || SectionMesh.Get())
+		{
+			AssembleMeshSection(i, SectionMesh.Get());
+		}
+		else
+		{
+			PendingMeshSections.Add(i);
+			MeshesToStream.AddUnique(SectionMesh.ToSoftObjectPath());
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::CreateMeshComponents - %d mesh sections, %d streaming"),
+		RigData.MeshSections.Num(), PendingMeshSections.Num());
+
+	if (MeshesToStream.Num() == 0)
+	{
+		HandleSectionMeshesStreamed();
+		return;
+	}
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	SectionMeshHandle = Streamable.RequestAsyncLoad(MeshesToStream,
+		FStreamableDelegate::CreateUObject(this, &AWarRigPawn::HandleSectionMeshesStreamed),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	if (SectionMeshHandle.IsValid())
+	{
+		// Register each section as soon as its own mesh arrives, not when the whole batch is done
+		SectionMeshHandle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateWeakLambda(this,
+			[this](TSharedRef<FStreamableHandle>)
+			{
+				HandleSectionMeshesStreamed();
+			}));
+	}
+
+	// Covers requests that completed (or failed) immediately
+	if (!SectionMeshHandle.IsValid() || SectionMeshHandle->HasLoadCompleted())
+	{
+		HandleSectionMeshesStreamed();
+	}
+}
+
+void AWarRigPawn::AssembleMeshSection(int32 SectionIndex, UStaticMesh* Mesh)
+{
+	// For MVP, sections are positioned linearly
 	// Cab at origin, trailers behind it
 	const float SectionLength = 200.0f; // Length of each section
-	const float SectionWidth = 150.0f;
-	const float SectionHeight = 100.0f;
 
-	for (int32 i = 0; i < RigData.MeshSections.Num(); i++)
+	UStaticMeshComponent* MeshComponent = MeshComponents[SectionIndex];
+	if (!MeshComponent)
 	{
-		// Create mesh component
-		FString ComponentName = FString::Printf(TEXT("MeshSection_%d"), i);
-		UStaticMeshComponent* MeshComponent = NewObject<UStaticMeshComponent>(this, UStaticMeshComponent::StaticClass(), *ComponentName);
-
-		if (MeshComponent)
+		// Unique name: components destroyed by an earlier swap may still hold the plain name until GC
+		const FName ComponentName = MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(),
+			FName(*FString::Printf(TEXT("MeshSection_%d"), SectionIndex)));
+		MeshComponent = NewObject<UStaticMeshComponent>(this, UStaticMeshComponent::StaticClass(), ComponentName);
+		if (!MeshComponent)
 		{
-			MeshComponent->RegisterComponent();
-			MeshComponent->AttachToComponent(WarRigRoot, FAttachmentTransformRules::KeepRelativeTransform);
+			return;
+		}
 
-			// Position sections linearly (X-axis is forward)
-			// Cab at origin, trailers behind (negative X)
-			FVector Position = FVector(-i * SectionLength, 0.0f, 0.0f);
-			MeshComponent->SetRelativeLocation(Position);
+		MeshComponent->RegisterComponent();
+		MeshComponent->AttachToComponent(WarRigRoot, FAttachmentTransformRules::KeepRelativeTransform);
+		MeshComponents[SectionIndex] = MeshComponent;
+	}
 
-			// Try to load the mesh from the data table
-			if (RigData.MeshSections[i].ToSoftObjectPath().IsValid())
-			{
-				UStaticMesh* LoadedMesh = RigData.MeshSections[i].LoadSynchronous();
-				if (LoadedMesh)
-				{
-					MeshComponent->SetStaticMesh(LoadedMesh);
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::CreateMeshComponents - Failed to load mesh for section %d"), i);
-				}
-			}
+	// Position sections linearly (X-axis is forward)
+	// Cab at origin, trailers behind (negative X)
+	MeshComponent->SetRelativeLocation(FVector(-SectionIndex * SectionLength, 0.0f, 0.0f));
+	MeshComponent->SetStaticMesh(Mesh);
 
-			// For MVP: Use engine primitive cube as fallback
-			// This will be replaced with actual meshes in the data table
-			if (!MeshComponent->GetStaticMesh())
-			{
-				// Note: In a real project, you'd use a default cube mesh from engine content
-				// For now, we'll just leave it without a mesh and rely on data table setup
-				UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::CreateMeshComponents - Section %d has no mesh. Set up meshes in data table."), i);
-			}
+	if (Mesh)
+	{
+		// Apply the (preloaded) primary material right away so the section doesn't pop
+		if (UMaterialInterface* Material = CachedRigData.PrimaryMaterial.Get())
+		{
+			MeshComponent->SetMaterial(0, Material);
+		}
+	}
+	else if (!CachedRigData.MeshSections[SectionIndex].IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::AssembleMeshSection - Failed to load mesh for section %d"), SectionIndex);
+	}
+	else
+	{
+		// Note: In a real project, you'd use a default cube mesh from engine content
+		// For now, we'll just leave it without a mesh and rely on data table setup
+		UE_LOG(LogTemp, Warning, TEXT("AWarRigPawn::AssembleMeshSection - Section %d has no mesh. Set up meshes in data table."), SectionIndex);
+	}
+}
+
+void AWarRigPawn::HandleSectionMeshesStreamed()
+{
+	const bool bStreamingFinished = !SectionMeshHandle.IsValid() || !SectionMeshHandle->IsLoadingInProgress();
+
+	for (int32 i = PendingMeshSections.Num() - 1; i >= 0; --i)
+	{
+		const int32 SectionIndex = PendingMeshSections[i];
+		if (!CachedRigData.MeshSections.IsValidIndex(SectionIndex) || !MeshComponents.IsValidIndex(SectionIndex))
+		{
+			PendingMeshSections.RemoveAtSwap(i);
+			continue;
+		}
 
-			MeshComponents.Add(MeshComponent);
+		// Assemble arrived sections; once streaming is over, anything still missing failed to load
+		UStaticMesh* Mesh = CachedRigData.MeshSections[SectionIndex].Get();
+		if (Mesh || bStreamingFinished)
+		{
+			AssembleMeshSection(SectionIndex, Mesh);
+			PendingMeshSections.RemoveAtSwap(i);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::CreateMeshComponents - Created %d mesh sections"), MeshComponents.Num());
+	if (PendingMeshSections.Num() == 0 && !bRigAssemblyFinished)
+	{
+		bRigAssemblyFinished = true;
+		SectionMeshHandle.Reset();
+		FinishRigAssembly();
+	}
+}
+
+void AWarRigPawn::FinishRigAssembly()
+{
+	ApplyVisualProperties(CachedRigData);
+
+	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::FinishRigAssembly - %s assembled with %d mesh sections"),
+		*CurrentRigID.ToString(), MeshComponents.Num());
 }
 
 void AWarRigPawn::CreateMountPoints(const FWarRigData& RigData)
@@ -366,7 +616,7 @@ void AWarRigPawn::ApplyVisualProperties(const FWarRigData& RigData)
 			// Load primary material if set
 			if (RigData.PrimaryMaterial.ToSoftObjectPath().IsValid())
 			{
-				UMaterialInterface* Material = RigData.PrimaryMaterial.LoadSynchronous();
+				UMaterialInterface* Material = UAssetPreloadSubsystem::ResolveAsset(this, RigData.PrimaryMaterial);
 				if (Material)
 				{
 					MeshComponent->SetMaterial(0, Material);
@@ -412,16 +662,35 @@ bool AWarRigPawn::ValidateWarRigData(const FWarRigData& RigData) const
 	return bValid;
 }
 
-void AWarRigPawn::ClearMeshComponents()
+void AWarRigPawn::TrimMeshComponents(int32 NumSectionsToKeep)
 {
-	for (UStaticMeshComponent* MeshComponent : MeshComponents)
+	for (int32 i = MeshComponents.Num() - 1; i >= FMath::Max(NumSectionsToKeep, 0); --i)
 	{
-		if (MeshComponent)
+		if (MeshComponents[i])
 		{
-			MeshComponent->DestroyComponent();
+			MeshComponents[i]->DestroyComponent();
 		}
 	}
-	MeshComponents.Empty();
+
+	if (MeshComponents.Num() > NumSectionsToKeep)
+	{
+		MeshComponents.SetNum(FMath::Max(NumSectionsToKeep, 0));
+	}
+}
+
+void AWarRigPawn::RehomeTurrets()
+{
+	for (ATurretBase* Turret : SpawnedTurrets)
+	{
+		USceneComponent* MountPoint = Turret ? GetMountPointComponent(Turret->GetMountIndex()) : nullptr;
+		if (!MountPoint)
+		{
+			continue;
+		}
+
+		Turret->AttachToComponent(MountPoint, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		Turret->SetFacingDirection(MountPoint->GetComponentRotation());
+	}
 }
 
 void AWarRigPawn::ClearMountPoints()
@@ -456,6 +725,12 @@ void AWarRigPawn::DebugReloadWarRigData()
 	LoadWarRigConfiguration(CurrentRigID);
 }
 
+void AWarRigPawn::DebugSwapWarRig(FName RigID)
+{
+	UE_LOG(LogTemp, Log, TEXT("AWarRigPawn::DebugSwapWarRig - Swapping from %s to %s"), *CurrentRigID.ToString(), *RigID.ToString());
+	SwapWarRig(RigID);
+}
+
 void AWarRigPawn::DebugShowLanes()
 {
 	if (!LaneSystemComponent)
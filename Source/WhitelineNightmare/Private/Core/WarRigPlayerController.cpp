@@ -3,6 +3,7 @@
 #include "Core/WarRigPlayerController.h"
 #include "Core/WarRigHUD.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
 
 // Define logging category
 DEFINE_LOG_CATEGORY_STATIC(LogWarRigPlayerController, Log, All);
@@ -21,7 +22,7 @@ void AWarRigPlayerController::BeginPlay()
 	Super::BeginPlay();
 
 	// Initialize resources
-	CurrentScrap = StartingScrap;
+	ResetRunState();
 
 	// Enable mouse cursor for UI interaction
 	bShowMouseCursor = true;
@@ -39,6 +40,24 @@ void AWarRigPlayerController::BeginPlay()
 	LogPlayerState();
 }
 
+void AWarRigPlayerController::PostSeamlessTravel()
+{
+	Super::PostSeamlessTravel();
+
+	// A restart travels seamlessly and keeps this controller; the new level starts a new run
+	ResetRunState();
+
+	UE_LOG(LogWarRigPlayerController, Log, TEXT("WarRigPlayerController: Run state reset after seamless travel"));
+	LogPlayerState();
+}
+
+void AWarRigPlayerController::ResetRunState()
+{
+	CurrentScrap = StartingScrap;
+	bIsGameOver = false;
+	GetWorldTimerManager().ClearTimer(RestartTimerHandle);
+}
+
 void AWarRigPlayerController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
@@ -147,7 +166,6 @@ void AWarRigPlayerController::OnGameOver(bool bPlayerWon)
 	LogPlayerState();
 
 	// Start a timer to auto-restart after 10 seconds
-	FTimerHandle RestartTimerHandle;
 	GetWorldTimerManager().SetTimer(RestartTimerHandle, this, &AWarRigPlayerController::RestartGame, 10.0f, false);
 
 	UE_LOG(LogWarRigPlayerController, Log, TEXT("OnGameOver: Restart timer started (10 seconds)"));
@@ -179,8 +197,9 @@ void AWarRigPlayerController::RestartGame()
 
 	UE_LOG(LogWarRigPlayerController, Log, TEXT("RestartGame: Reloading level '%s'"), *CurrentLevelName);
 
-	// Reload the current level
-	UGameplayStatics::OpenLevel(World, FName(*CurrentLevelName));
+	// Reload the current level; the game mode travels seamlessly when it can, which keeps
+	// persisted pools' actors alive for the next level (falls back to a hard travel otherwise)
+	World->ServerTravel(CurrentLevelName);
 }
 
 bool AWarRigPlayerController::ValidateScrapAmount(int32 NewAmount) const
@@ -5,7 +5,12 @@
 #include "Core/WarRigHUD.h"
 #include "Core/WorldScrollComponent.h"
 #include "World/GroundTileManager.h"
+#include "Core/AssetPreloadSubsystem.h"
+#include "Core/WarRigPawn.h"
+#include "Core/ObjectPoolCacheSubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/DataTable.h"
+#include "UObject/ConstructorHelpers.h"
 
 #if !UE_BUILD_SHIPPING
 #include "Testing/TestManager.h"
@@ -36,11 +41,27 @@ AWhitelineNightmareGameMode::AWhitelineNightmareGameMode()
 	PlayerControllerClass = AWarRigPlayerController::StaticClass();
 	HUDClass = AWarRigHUD::StaticClass();
 
+	// Restarts travel seamlessly so pooled actors can be carried into the next level
+	bUseSeamlessTravel = true;
+
 	// Create world scroll component
 	WorldScrollComponent = CreateDefaultSubobject<UWorldScrollComponent>(TEXT("WorldScrollComponent"));
 
 	// Create ground tile manager
 	GroundTileManager = CreateDefaultSubobject<UGroundTileManager>(TEXT("GroundTileManager"));
+
+	// Project data tables streamed at level start (InitGame adds the tables the tile manager and pawn are configured with)
+	static ConstructorHelpers::FObjectFinder<UDataTable> WorldTileTable(TEXT("/Game/Data/DT_WorldTileData"));
+	if (WorldTileTable.Succeeded())
+	{
+		PreloadDataTables.Add(WorldTileTable.Object);
+	}
+
+	static ConstructorHelpers::FObjectFinder<UDataTable> WarRigTable(TEXT("/Game/Data/DT_WarRigData"));
+	if (WarRigTable.Succeeded())
+	{
+		PreloadDataTables.Add(WarRigTable.Object);
+	}
 }
 
 void AWhitelineNightmareGameMode::BeginPlay()
@@ -89,6 +110,71 @@ void AWhitelineNightmareGameMode::InitGame(const FString& MapName, const FString
 
 	// TODO: Load gameplay balance data from data table
 	// For now, using default values set in constructor
+	// Start streaming data table assets before any actor begins play (the road waits for OnPreloadComplete; the war rig streams its own sections)
+	// Start streaming data table assets before any actor begins play; consumers set up once OnPreloadComplete fires
+	if (UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this))
+	{
+		TArray<UDataTable*> DataTables;
+		GatherPreloadDataTables(DataTables);
+
+		int32 RequestedCount = 0;
+		for (const UDataTable* DataTable : DataTables)
+		{
+			RequestedCount += Preloader->PreloadDataTable(DataTable);
+		}
+
+		UE_LOG(LogWhitelineNightmare, Log, TEXT("WhitelineNightmareGameMode: Preloading %d asset(s) from %d data table(s)"),
+			RequestedCount, DataTables.Num());
+	}
+}
+
+void AWhitelineNightmareGameMode::GatherPreloadDataTables(TArray<UDataTable*>& OutDataTables) const
+{
+	for (UDataTable* DataTable : PreloadDataTables)
+	{
+		if (DataTable)
+		{
+			OutDataTables.AddUnique(DataTable);
+		}
+	}
+
+	// Tables the level's consumers read at BeginPlay
+	if (GroundTileManager && GroundTileManager->GetTileDataTable())
+	{
+		OutDataTables.AddUnique(GroundTileManager->GetTileDataTable());
+	}
+
+	if (const AWarRigPawn* PawnDefaults = Cast<AWarRigPawn>(DefaultPawnClass ? DefaultPawnClass->GetDefaultObject() : nullptr))
+	{
+		if (PawnDefaults->GetWarRigDataTable())
+		{
+			OutDataTables.AddUnique(PawnDefaults->GetWarRigDataTable());
+		}
+		if (PawnDefaults->GetTurretDataTable())
+		{
+			OutDataTables.AddUnique(PawnDefaults->GetTurretDataTable());
+		}
+	}
+}
+
+void AWhitelineNightmareGameMode::GetSeamlessTravelActorList(bool bToTransition, TArray<AActor*>& ActorList)
+{
+	Super::GetSeamlessTravelActorList(bToTransition, ActorList);
+
+	UObjectPoolCacheSubsystem* PoolCache = UObjectPoolCacheSubsystem::Get(this);
+	if (!PoolCache)
+	{
+		return;
+	}
+
+	// Leaving the level: take every persisted pool's actors out of their pools before the pools go away
+	if (bToTransition)
+	{
+		PoolCache->ParkPools(GetWorld());
+	}
+
+	// Parked actors ride along to the transition map and then on to the destination
+	PoolCache->GetParkedActors(ActorList);
 }
 
 void AWhitelineNightmareGameMode::AddDistanceTraveled(float DeltaDistance)
@@ -228,7 +314,7 @@ void AWhitelineNightmareGameMode::DebugResetDistance()
 		return;
 	}
 
-	const float OldDistance = WorldScrollComponent->GetDistanceTraveled();
+	const double OldDistance = WorldScrollComponent->GetDistanceTraveled();
 	WorldScrollComponent->ResetDistance();
 	UE_LOG(LogWhitelineNightmare, Log, TEXT("DebugResetDistance: Reset distance from %.2f to 0.0"), OldDistance);
 }
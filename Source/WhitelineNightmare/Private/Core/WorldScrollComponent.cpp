@@ -2,6 +2,7 @@
 
 #include "Core/WorldScrollComponent.h"
 #include "Core/GameDataStructs.h"
+#include "Core/ScrollMoverSubsystem.h"
 #include "Engine/DataTable.h"
 
 // Define logging category
@@ -12,7 +13,7 @@ UWorldScrollComponent::UWorldScrollComponent()
 	, DataTableRowName("DefaultScroll")
 	, ScrollSpeed(1000.0f)
 	, bIsScrolling(true)
-	, DistanceTraveled(0.0f)
+	, DistanceTraveled(0.0)
 	, ScrollDirection(-1.0f, 0.0f, 0.0f)
 {
 	// Enable ticking for distance accumulation
@@ -36,6 +37,23 @@ void UWorldScrollComponent::BeginPlay()
 
 	// Log initial state
 	LogScrollState();
+
+	// The first scroll component in the world drives the shared scroll movers
+	UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this);
+	if (ScrollMovers && !ScrollMovers->GetScrollSource())
+	{
+		ScrollMovers->SetScrollSource(this);
+	}
+}
+
+void UWorldScrollComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		ScrollMovers->ClearScrollSource(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UWorldScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -45,7 +63,7 @@ void UWorldScrollComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	// Accumulate distance traveled if scrolling is active
 	if (bIsScrolling && ScrollSpeed > 0.0f)
 	{
-		const float DeltaDistance = ScrollSpeed * DeltaTime;
+		const double DeltaDistance = static_cast<double>(ScrollSpeed) * DeltaTime;
 		DistanceTraveled += DeltaDistance;
 
 		// Verbose logging for debugging (can be disabled in shipping builds)
@@ -88,8 +106,8 @@ void UWorldScrollComponent::SetScrolling(bool bEnabled)
 
 void UWorldScrollComponent::ResetDistance()
 {
-	const float OldDistance = DistanceTraveled;
-	DistanceTraveled = 0.0f;
+	const double OldDistance = DistanceTraveled;
+	DistanceTraveled = 0.0;
 
 	UE_LOG(LogWorldScroll, Log, TEXT("WorldScrollComponent: Distance reset from %.2f to 0.0"),
 		OldDistance);
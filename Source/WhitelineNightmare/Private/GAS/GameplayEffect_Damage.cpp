@@ -0,0 +1,23 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "GAS/GameplayEffect_Damage.h"
+#include "GAS/Attributes/CombatAttributeSet.h"
+
+UGameplayEffect_Damage::UGameplayEffect_Damage()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat DamageMagnitude;
+	DamageMagnitude.DataTag = GetDamageDataTag();
+
+	FGameplayModifierInfo HealthModifier;
+	HealthModifier.Attribute = UCombatAttributeSet::GetHealthAttribute();
+	HealthModifier.ModifierOp = EGameplayModOp::Additive;
+	HealthModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(DamageMagnitude);
+	Modifiers.Add(HealthModifier);
+}
+
+FGameplayTag UGameplayEffect_Damage::GetDamageDataTag()
+{
+	return FGameplayTag::RequestGameplayTag(FName("Data.Damage"));
+}
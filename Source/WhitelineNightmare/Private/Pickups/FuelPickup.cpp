@@ -4,19 +4,21 @@
 #include "Pickups/PickupPoolComponent.h"
 #include "Components/SphereComponent.h"
 #include "Core/WorldScrollComponent.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "Core/AssetPreloadSubsystem.h"
 #include "Core/WarRigPawn.h"
 #include "GAS/WarRigAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraSystem.h"
-#include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Sound/SoundBase.h"
 
 AFuelPickup::AFuelPickup()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Movement comes from UScrollMoverSubsystem, so pickups never tick
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Create sphere component as root
 	SphereComponent = CreateDefaultSubobject<USphereComponent>(TEXT("SphereComponent"));
@@ -50,19 +52,6 @@ void AFuelPickup::BeginPlay()
 	// Initially deactivated until pooling system activates it
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
-	SetActorTickEnabled(false);
-}
-
-void AFuelPickup::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	// Scroll backward with the world
-	if (WorldScrollComponent && WorldScrollComponent->IsScrolling())
-	{
-		const FVector ScrollVelocity = WorldScrollComponent->GetScrollVelocity();
-		AddActorWorldOffset(ScrollVelocity * DeltaTime, false);
-	}
 }
 
 void AFuelPickup::OnActivated_Implementation()
@@ -76,8 +65,11 @@ void AFuelPickup::OnActivated_Implementation()
 	// Make visible
 	SetActorHiddenInGame(false);
 
-	// Enable ticking for movement
-	SetActorTickEnabled(true);
+	// Scroll with the world
+	if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		ScrollMovers->RegisterMover(this);
+	}
 }
 
 void AFuelPickup::OnDeactivated_Implementation()
@@ -91,15 +83,13 @@ void AFuelPickup::OnDeactivated_Implementation()
 	// Make invisible
 	SetActorHiddenInGame(true);
 
-	// Disable ticking
-	SetActorTickEnabled(false);
-
-	// Clean up any active particle effects
-	if (ActiveParticleComponent)
+	// Stop scrolling
+	if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
 	{
-		ActiveParticleComponent->DestroyComponent();
-		ActiveParticleComponent = nullptr;
+		ScrollMovers->UnregisterMover(this);
 	}
+
+	// Collection effects are owned by the pool and finish playing on their own
 }
 
 void AFuelPickup::ResetState_Implementation()
@@ -144,6 +134,11 @@ void AFuelPickup::SetPoolComponent(UPickupPoolComponent* InPoolComponent)
 	PoolComponent = InPoolComponent;
 }
 
+void AFuelPickup::SetPoolHandle(const FPooledActorHandle& InPoolHandle)
+{
+	PoolHandle = InPoolHandle;
+}
+
 void AFuelPickup::OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
@@ -154,6 +149,12 @@ void AFuelPickup::OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent,
 		return;
 	}
 
+	// Ignore overlaps after this activation was already collected (e.g. multiple overlaps in one frame)
+	if (PoolComponent && PoolHandle.IsSet() && !PoolComponent->IsHandleValid(PoolHandle))
+	{
+		return;
+	}
+
 	// Apply fuel restoration
 	ApplyFuelRestore(WarRig);
 
@@ -164,7 +165,14 @@ void AFuelPickup::OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent,
 	if (PoolComponent)
 	{
 		// The pool component will handle deactivation via OnDeactivated
-		PoolComponent->ReturnToPool(this);
+		if (PoolHandle.IsSet())
+		{
+			PoolComponent->ReturnToPoolByHandle(PoolHandle);
+		}
+		else
+		{
+			PoolComponent->ReturnToPool(this);
+		}
 	}
 	else
 	{
@@ -220,10 +228,17 @@ void AFuelPickup::ApplyFuelRestore(AWarRigPawn* WarRig)
 
 void AFuelPickup::PlayPickupEffects()
 {
+	// Pooled pickups reuse the pool's preloaded effect components
+	if (PoolComponent)
+	{
+		PoolComponent->PlayPickupEffects(PickupData, GetActorTransform());
+		return;
+	}
+
 	// Play pickup sound
 	if (!PickupData.PickupSound.IsNull())
 	{
-		USoundBase* Sound = PickupData.PickupSound.LoadSynchronous();
+		USoundBase* Sound = UAssetPreloadSubsystem::ResolveAsset(this, PickupData.PickupSound);
 		if (Sound)
 		{
 			UGameplayStatics::PlaySoundAtLocation(this, Sound, GetActorLocation());
@@ -233,7 +248,7 @@ void AFuelPickup::PlayPickupEffects()
 	// Spawn pickup particle effect
 	if (!PickupData.PickupParticle.IsNull())
 	{
-		UNiagaraSystem* ParticleSystem = PickupData.PickupParticle.LoadSynchronous();
+		UNiagaraSystem* ParticleSystem = UAssetPreloadSubsystem::ResolveAsset(this, PickupData.PickupParticle);
 		if (ParticleSystem)
 		{
 			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
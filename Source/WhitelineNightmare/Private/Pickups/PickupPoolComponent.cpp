@@ -5,7 +5,14 @@
 #include "Core/WarRigPawn.h"
 #include "Core/WorldScrollComponent.h"
 #include "Core/LaneSystemComponent.h"
+#include "Core/AssetPreloadSubsystem.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "Engine/DataTable.h"
 #include "DrawDebugHelpers.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundBase.h"
 
 #if !UE_BUILD_SHIPPING
 // Static debug instance
@@ -34,11 +41,14 @@ static FAutoConsoleCommand DebugShowPickupPoolCmd(
 UPickupPoolComponent::UPickupPoolComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true; // Despawn checks run every frame
 
 	// Default values
 	SpawnDistanceAhead = 2000.0f;
 	DespawnDistanceBehind = -1000.0f;
 	SpawnHeight = 0.0f;
+	MaxConcurrentPickupEffects = 8;
+	DroppedPickupEffectCount = 0;
 
 	// Default lane positions (5 lanes)
 	LaneYPositions = { -400.0f, -200.0f, 0.0f, 200.0f, 400.0f };
@@ -123,21 +133,162 @@ bool UPickupPoolComponent::InitializePickupPool(AWarRigPawn* WarRig, UWorldScrol
 	Config.SpawnDistanceAhead = SpawnDistanceAhead;
 	Config.DespawnDistanceBehind = DespawnDistanceBehind;
 
-	bool bSuccess = Initialize(PickupClass, Config);
-	if (bSuccess)
+	// Pickups aren't needed until the first spawn, so fill the pool in the background
+	Config.bTimeSlicedPrewarm = true;
+	Config.PrewarmActorsPerFrame = 2;
+
+	// Pickup density varies per run segment, so let the pool follow demand between half and double size
+	Config.bAdaptiveSizing = true;
+	Config.MinPoolSize = FMath::Max(1, PoolSize / 2);
+
+	// Keep pickup assets loaded and the learned pool size across restarts
+	Config.bPersistAcrossLevels = true;
+
+	// Effect components are created once here; their assets stream in while the pool prewarms
+	CreatePooledEffectComponents();
+	PreloadPickupEffects(PickupClass);
+
+	// Pickups receive their scroll/pool references in OnPooledActorSpawned as they are created
+	return Initialize(PickupClass, Config);
+}
+
+void UPickupPoolComponent::OnPooledActorSpawned(AActor* Actor)
+{
+	Super::OnPooledActorSpawned(Actor);
+
+	// Set world scroll component and pool component reference on every pooled pickup
+	if (AFuelPickup* Pickup = Cast<AFuelPickup>(Actor))
+	{
+		Pickup->SetWorldScrollComponent(WorldScrollComponent);
+		Pickup->SetPoolComponent(this);
+	}
+}
+
+void UPickupPoolComponent::CreatePooledEffectComponents()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || PooledParticleComponents.Num() > 0)
+	{
+		return;
+	}
+
+	const int32 NumComponents = FMath::Max(1, MaxConcurrentPickupEffects);
+	PooledParticleComponents.Reserve(NumComponents);
+	PooledAudioComponents.Reserve(NumComponents);
+
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		// World-space, never auto-destroyed: the same components are replayed for every collection
+		UNiagaraComponent* ParticleComponent = NewObject<UNiagaraComponent>(Owner);
+		ParticleComponent->SetAutoActivate(false);
+		ParticleComponent->SetAutoDestroy(false);
+		ParticleComponent->SetUsingAbsoluteLocation(true);
+		ParticleComponent->SetUsingAbsoluteRotation(true);
+		ParticleComponent->RegisterComponent();
+		PooledParticleComponents.Add(ParticleComponent);
+
+		UAudioComponent* AudioComponent = NewObject<UAudioComponent>(Owner);
+		AudioComponent->bAutoActivate = false;
+		AudioComponent->bAutoDestroy = false;
+		AudioComponent->SetUsingAbsoluteLocation(true);
+		AudioComponent->RegisterComponent();
+		PooledAudioComponents.Add(AudioComponent);
+	}
+}
+
+int32 UPickupPoolComponent::PreloadPickupEffects(TSubclassOf<AFuelPickup> PickupClass)
+{
+	const AFuelPickup* DefaultPickup = PickupClass ? PickupClass->GetDefaultObject<AFuelPickup>() : nullptr;
+	const UDataTable* PickupDataTable = DefaultPickup ? DefaultPickup->GetPickupDataTable() : nullptr;
+	UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this);
+	if (!PickupDataTable || !Preloader)
 	{
-		// Set world scroll component and pool component reference on all pooled pickups
-		for (AActor* PooledActor : AllPooledObjects)
+		UE_LOG(LogTemp, Verbose, TEXT("UPickupPoolComponent::PreloadPickupEffects - Nothing to preload for %s"), *GetNameSafe(PickupClass));
+		return 0;
+	}
+
+	// Any row may be assigned to a pooled pickup, so stream every row's effects in one request
+	TArray<FSoftObjectPath> EffectPaths;
+	PickupDataTable->ForeachRow<FPickupData>(TEXT("UPickupPoolComponent::PreloadPickupEffects"),
+		[&EffectPaths](const FName& RowName, const FPickupData& Row)
 		{
-			if (AFuelPickup* Pickup = Cast<AFuelPickup>(PooledActor))
+			if (!Row.PickupSound.IsNull())
+			{
+				EffectPaths.AddUnique(Row.PickupSound.ToSoftObjectPath());
+			}
+			if (!Row.PickupParticle.IsNull())
 			{
-				Pickup->SetWorldScrollComponent(WorldScrollComponent);
-				Pickup->SetPoolComponent(this);
+				EffectPaths.AddUnique(Row.PickupParticle.ToSoftObjectPath());
 			}
+		});
+
+	// The preload subsystem holds the streaming handle, keeping the assets resident for the world
+	return Preloader->PreloadAssets(EffectPaths);
+}
+
+template<typename T>
+T* UPickupPoolComponent::GetPreloadedEffectAsset(const TSoftObjectPtr<T>& SoftAsset)
+{
+	if (SoftAsset.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const TObjectPtr<UObject>* Preloaded = PreloadedEffectAssets.Find(SoftAsset.ToSoftObjectPath()))
+	{
+		return Cast<T>(Preloaded->Get());
+	}
+
+	T* Asset = UAssetPreloadSubsystem::ResolveAsset(this, SoftAsset);
+	PreloadedEffectAssets.Add(SoftAsset.ToSoftObjectPath(), Asset);
+	return Asset;
+}
+
+void UPickupPoolComponent::PlayPickupEffects(const FPickupData& PickupData, const FTransform& EffectTransform)
+{
+	// Play pickup sound on an idle pooled audio component
+	if (USoundBase* Sound = GetPreloadedEffectAsset(PickupData.PickupSound))
+	{
+		UAudioComponent* const* IdleAudio = PooledAudioComponents.FindByPredicate([](const UAudioComponent* Component)
+		{
+			return Component && !Component->IsPlaying();
+		});
+
+		if (IdleAudio)
+		{
+			(*IdleAudio)->SetSound(Sound);
+			(*IdleAudio)->SetWorldLocation(EffectTransform.GetLocation());
+			(*IdleAudio)->Play();
+		}
+		else
+		{
+			++DroppedPickupEffectCount;
 		}
 	}
 
-	return bSuccess;
+	// Spawn pickup particle effect on an idle pooled Niagara component
+	if (UNiagaraSystem* ParticleSystem = GetPreloadedEffectAsset(PickupData.PickupParticle))
+	{
+		UNiagaraComponent* const* IdleParticle = PooledParticleComponents.FindByPredicate([](const UNiagaraComponent* Component)
+		{
+			return Component && !Component->IsActive();
+		});
+
+		if (IdleParticle)
+		{
+			// Changing the asset reinitializes the system, so only do it when a different pickup type plays
+			if ((*IdleParticle)->GetAsset() != ParticleSystem)
+			{
+				(*IdleParticle)->SetAsset(ParticleSystem);
+			}
+			(*IdleParticle)->SetWorldLocationAndRotation(EffectTransform.GetLocation(), EffectTransform.GetRotation());
+			(*IdleParticle)->Activate(true);
+		}
+		else
+		{
+			++DroppedPickupEffectCount;
+		}
+	}
 }
 
 AFuelPickup* UPickupPoolComponent::SpawnPickupInLane(int32 LaneIndex)
@@ -154,16 +305,20 @@ AFuelPickup* UPickupPoolComponent::SpawnPickupInLane(int32 LaneIndex)
 	FVector SpawnLocation = GetSpawnLocationForLane(LaneIndex);
 	FRotator SpawnRotation = FRotator::ZeroRotator;
 
-	// Get pickup from pool
-	AActor* PickupActor = GetFromPool(SpawnLocation, SpawnRotation);
+	// Get pickup from pool (references are injected in OnPooledActorSpawned)
+	FPooledActorHandle PickupHandle;
+	AActor* PickupActor = GetFromPoolWithHandle(SpawnLocation, SpawnRotation, PickupHandle);
 	AFuelPickup* Pickup = Cast<AFuelPickup>(PickupActor);
 
 	if (Pickup)
 	{
-		// Ensure world scroll component and pool component are set
-		// (in case this is a newly created actor from auto-expand)
-		Pickup->SetWorldScrollComponent(WorldScrollComponent);
-		Pickup->SetPoolComponent(this);
+		Pickup->SetPoolHandle(PickupHandle);
+
+		// Index by lane so spawners/collision can query the lane instead of scanning every pickup
+		if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+		{
+			ScrollMovers->RegisterLaneEntity(Pickup, LaneIndex);
+		}
 	}
 
 	return Pickup;
@@ -203,10 +358,10 @@ void UPickupPoolComponent::CheckAndDespawnPickups()
 		}
 	}
 
-	// Return pickups to pool
-	for (AActor* Pickup : PickupsToDespawn)
+	// Return pickups to pool in one pass
+	if (PickupsToDespawn.Num() > 0)
 	{
-		ReturnToPool(Pickup);
+		ReturnToPoolBatch(PickupsToDespawn);
 	}
 }
 
@@ -284,7 +439,7 @@ void UPickupPoolComponent::DrawDebugVisualization() const
 	// Draw pool statistics
 	FVector StatsLocation = WarRigLocation + FVector(0.0f, 0.0f, 300.0f);
 	FString StatsText = FString::Printf(TEXT("Pickup Pool:\nActive: %d\nAvailable: %d\nTotal: %d"),
-		ActiveObjects.Num(), AvailableObjects.Num(), AllPooledObjects.Num());
+		ActiveObjects.Num(), AvailableObjects.Num(), GetTotalPoolSize());
 	DrawDebugString(GetWorld(), StatsLocation, StatsText, nullptr, FColor::Yellow, 0.0f, true, 1.5f);
 }
 
@@ -346,6 +501,8 @@ void UPickupPoolComponent::DebugShowPickupPool(const TArray<FString>& Args)
 	UE_LOG(LogTemp, Log, TEXT("Spawn Distance Ahead: %.1f"), DebugInstance->SpawnDistanceAhead);
 	UE_LOG(LogTemp, Log, TEXT("Despawn Distance Behind: %.1f"), DebugInstance->DespawnDistanceBehind);
 	UE_LOG(LogTemp, Log, TEXT("Number of Lanes: %d"), DebugInstance->LaneYPositions.Num());
+	UE_LOG(LogTemp, Log, TEXT("Pooled Effect Components: %d (dropped effects: %d)"),
+		DebugInstance->PooledParticleComponents.Num(), DebugInstance->DroppedPickupEffectCount);
 	UE_LOG(LogTemp, Log, TEXT("=============================="));
 }
 #endif
@@ -5,17 +5,36 @@
 #include "Testing/ObjectPoolTestHelpers.h"
 #include "Core/ObjectPoolComponent.h"
 #include "Core/ObjectPoolTypes.h"
+#include "Core/ObjectPoolSubsystem.h"
+#include "Core/ObjectPoolCacheSubsystem.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "Core/LaneDistanceIndex.h"
+#include "Core/AssetPreloadSubsystem.h"
+#include "Engine/DataTable.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "World/GroundTile.h"
 #include "World/GroundTileManager.h"
 #include "Turrets/TurretBase.h"
+#include "Turrets/TurretTargetingSubsystem.h"
+#include "Turrets/TurretTargetingKernel.h"
+#include "Turrets/ProjectileSubsystem.h"
+#include "Turrets/TurretTraceSubsystem.h"
+#include "Turrets/TurretFireSchedulerSubsystem.h"
 #include "Testing/TestTurret.h"
+#include "Testing/TestGroundTileManager.h"
+#include "GameFramework/DefaultPawn.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
 #include "GAS/Attributes/CombatAttributeSet.h"
+#include "GAS/GameplayEffect_Damage.h"
 #include "Core/WarRigPawn.h"
 #include "Core/GameDataStructs.h"
 #include "AbilitySystemComponent.h"
 #include "Core/WorldScrollComponent.h"
+#include "Core/WhitelineNightmareGameMode.h"
+#include "Core/WarRigPlayerController.h"
 
 #if !UE_BUILD_SHIPPING
 
@@ -414,804 +433,2583 @@ static bool ObjectPoolTest_ResetPool()
 	TEST_SUCCESS("ObjectPoolTest_ResetPool");
 }
 
-// ============================================================================
-// GROUND TILE TESTS
-// ============================================================================
-
-// Helper function to create a simple war rig stand-in for testing
-static AActor* CreateTestWarRig(UWorld* World, const FVector& Location)
+/**
+ * Test: Out-Of-Order Return
+ * Verify that returning actors in arbitrary order keeps the active/available lists consistent
+ * and that a second return of the same actor is rejected
+ */
+static bool ObjectPoolTest_OutOfOrderReturn()
 {
-	if (!World)
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 4;
+	Config.bAutoExpand = false;
+
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
+
+	TArray<AActor*> Actors;
+	for (int32 i = 0; i < 4; ++i)
 	{
-		return nullptr;
+		AActor* Actor = PoolComponent->GetFromPool(FVector(i * 100.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+		TEST_NOT_NULL(Actor, "Should get actor from pool");
+		Actors.Add(Actor);
 	}
 
-	AActor* WarRig = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator);
-	if (WarRig)
+	// Return from the middle of the active list first (exercises swap-remove)
+	TEST_TRUE(PoolComponent->ReturnToPool(Actors[1]), "Should return middle actor");
+	TEST_TRUE(PoolComponent->ReturnToPool(Actors[0]), "Should return first actor");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 2, "Should have 2 active objects");
+	TEST_EQUAL(PoolComponent->GetAvailableCount(), 2, "Should have 2 available objects");
+
+	// Returning the same actor again must fail without changing counts
+	TEST_FALSE(PoolComponent->ReturnToPool(Actors[1]), "Double return should be rejected");
+	TEST_EQUAL(PoolComponent->GetAvailableCount(), 2, "Double return should not add a duplicate");
+
+	// Remaining active actors must still be returnable
+	TEST_TRUE(PoolComponent->ReturnToPool(Actors[3]), "Should return last actor");
+	TEST_TRUE(PoolComponent->ReturnToPool(Actors[2]), "Should return remaining actor");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 0, "Should have 0 active objects");
+	TEST_EQUAL(PoolComponent->GetAvailableCount(), 4, "Should have 4 available objects");
+	TEST_EQUAL(PoolComponent->GetTotalPoolSize(), 4, "Pool size should be unchanged");
+
+	// Cleanup
+	if (PoolComponent->GetOwner())
 	{
-		WarRig->SetActorLabel(TEXT("WarRig"));
+		PoolComponent->GetOwner()->Destroy();
 	}
-	return WarRig;
+
+	TEST_SUCCESS("ObjectPoolTest_OutOfOrderReturn");
 }
 
 /**
- * Test: Tile Pool Recycling
- * Verify tiles are reused, not destroyed when they leave the visible area
+ * Test: Time-Sliced Prewarm
+ * Verify that a time-sliced pool defers spawning, still serves requests on demand,
+ * and reports ready once MinReadyCount actors exist
  */
-static bool GroundTileTest_TilePoolRecycling()
+static bool ObjectPoolTest_TimeSlicedPrewarm()
 {
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	TEST_NOT_NULL(World, "World should exist");
-
-	// Create a war rig for position reference
-	AActor* WarRig = CreateTestWarRig(World, FVector::ZeroVector);
-	TEST_NOT_NULL(WarRig, "War rig should be created");
-
-	// Create pool directly without accessing protected members
-	AActor* PoolOwner = World->SpawnActor<AActor>();
-	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
-
-	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool->RegisterComponent();
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
 	FObjectPoolConfig Config;
-	Config.PoolSize = 5;
+	Config.PoolSize = 6;
 	Config.bAutoExpand = false;
-	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
-	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
-
-	TEST_EQUAL(Pool->GetTotalPoolSize(), 5, "Pool should have 5 tiles");
-
-	// Get a tile from the pool
-	AActor* Tile1Actor = Pool->GetFromPool(FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
-	TEST_NOT_NULL(Tile1Actor, "First tile should be retrieved");
-	AGroundTile* Tile1 = Cast<AGroundTile>(Tile1Actor);
-	TEST_NOT_NULL(Tile1, "Should be a GroundTile");
-
-	// Store the pointer to the first tile
-	AGroundTile* OriginalTile = Tile1;
+	Config.bTimeSlicedPrewarm = true;
+	Config.PrewarmActorsPerFrame = 2;
+	Config.MinReadyCount = 2;
 
-	// Return it to the pool
-	Pool->ReturnToPool(Tile1);
-	TEST_EQUAL(Pool->GetAvailableCount(), 5, "All tiles should be available again");
+	TEST_TRUE(PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config), "Initialization should succeed");
 
-	// Get a tile again
-	AActor* Tile2Actor = Pool->GetFromPool(FVector(3000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
-	AGroundTile* Tile2 = Cast<AGroundTile>(Tile2Actor);
+	// Nothing is spawned until the pool ticks
+	TEST_TRUE(PoolComponent->IsPrewarming(), "Pool should be prewarming");
+	TEST_FALSE(PoolComponent->IsPoolReady(), "Pool should not be ready yet");
+	TEST_EQUAL(PoolComponent->GetTotalPoolSize(), 0, "No actors should be spawned during Initialize");
 
-	// Verify it's the SAME instance (reused, not destroyed and recreated)
-	TEST_EQUAL(OriginalTile, Tile2, "Pool should reuse the same tile instance");
-	TEST_EQUAL(Pool->GetTotalPoolSize(), 5, "Pool size should remain constant");
+	// Requests during prewarm spawn pending actors immediately
+	AActor* Actor1 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	AActor* Actor2 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_NOT_NULL(Actor1, "Should get actor during prewarm");
+	TEST_NOT_NULL(Actor2, "Should get second actor during prewarm");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 2, "Should have 2 active objects");
+	TEST_TRUE(PoolComponent->IsPoolReady(), "Pool should be ready after MinReadyCount actors exist");
+	TEST_TRUE(PoolComponent->IsPrewarming(), "Remaining actors should still be pending");
 
-	// Cleanup
-	if (WarRig)
+	// On-demand spawns count against the prewarm target, never beyond PoolSize
+	for (int32 i = 0; i < 4; ++i)
 	{
-		WarRig->Destroy();
+		TEST_NOT_NULL(PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator), "Should get pending actor");
 	}
-	if (PoolOwner)
+	TEST_FALSE(PoolComponent->IsPrewarming(), "Prewarm should be complete");
+	TEST_EQUAL(PoolComponent->GetTotalPoolSize(), 6, "Pool should not exceed PoolSize");
+	TEST_NULL(PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator), "Pool should be exhausted");
+
+	// Cleanup
+	if (PoolComponent->GetOwner())
 	{
-		PoolOwner->Destroy();
+		PoolComponent->GetOwner()->Destroy();
 	}
 
-	TEST_SUCCESS("GroundTileTest_TilePoolRecycling");
+	TEST_SUCCESS("ObjectPoolTest_TimeSlicedPrewarm");
 }
 
 /**
- * Test: Seamless Scrolling
- * Verify no gaps between tiles when positioned in sequence
+ * Test: Pool Stats
+ * Verify that acquires, releases, exhaustion misses, expansions and peak active count are tracked
  */
-static bool GroundTileTest_SeamlessScrolling()
+static bool ObjectPoolTest_PoolStats()
 {
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	TEST_NOT_NULL(World, "World should exist");
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
-	// Create pool
-	AActor* PoolOwner = World->SpawnActor<AActor>();
-	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+	FObjectPoolConfig Config;
+	Config.PoolSize = 2;
+	Config.bAutoExpand = true;
+	Config.MaxPoolSize = 3;
 
-	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool->RegisterComponent();
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
 
-	FObjectPoolConfig Config;
-	Config.PoolSize = 3;
-	Config.bAutoExpand = false;
-	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
-	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+	// Two from the pool, one expansion, then one miss at max size
+	AActor* Actor1 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	AActor* Actor2 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	AActor* Actor3 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	AActor* Actor4 = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_NOT_NULL(Actor3, "Third actor should come from expansion");
+	TEST_NULL(Actor4, "Fourth request should miss");
 
-	const float TileSize = 2000.0f;
+	PoolComponent->ReturnToPool(Actor1);
+	PoolComponent->ReturnToPool(Actor2);
 
-	// Spawn tiles in sequence
-	TArray<AGroundTile*> Tiles;
-	for (int32 i = 0; i < 3; ++i)
-	{
-		float XPosition = i * TileSize;
-		AActor* TileActor = Pool->GetFromPool(FVector(XPosition, 0.0f, 0.0f), FRotator::ZeroRotator);
-		AGroundTile* Tile = Cast<AGroundTile>(TileActor);
-		TEST_NOT_NULL(Tile, "Tile should be created");
+	FObjectPoolStats Stats = PoolComponent->GetPoolStats();
+	TEST_EQUAL(Stats.TotalAcquires, 3, "Should count 3 acquires");
+	TEST_EQUAL(Stats.TotalReleases, 2, "Should count 2 releases");
+	TEST_EQUAL(Stats.ExpansionCount, 1, "Should count 1 expansion");
+	TEST_EQUAL(Stats.ExhaustionMisses, 1, "Should count 1 exhaustion miss");
+	TEST_EQUAL(Stats.PeakActiveCount, 3, "Peak active should be 3");
+	TEST_NEARLY_EQUAL(Stats.GetMissRate(), 0.25f, 0.001f, "Miss rate should be 1 of 4 requests");
+	TEST_TRUE(Stats.MaxTimeToReturn >= Stats.AverageTimeToReturn, "Max time-to-return should be at least the average");
+
+	// Resetting keeps the current active count as the new peak
+	PoolComponent->ResetPoolStats();
+	Stats = PoolComponent->GetPoolStats();
+	TEST_EQUAL(Stats.TotalAcquires, 0, "Acquires should reset");
+	TEST_EQUAL(Stats.PeakActiveCount, 1, "Peak should restart from current active count");
 
-		Tile->SetTileLength(TileSize);
-		Tiles.Add(Tile);
+	// Cleanup
+	if (PoolComponent->GetOwner())
+	{
+		PoolComponent->GetOwner()->Destroy();
 	}
 
-	// Verify no gaps between tiles
-	for (int32 i = 0; i < Tiles.Num() - 1; ++i)
-	{
-		AGroundTile* CurrentTile = Tiles[i];
-		AGroundTile* NextTile = Tiles[i + 1];
+	TEST_SUCCESS("ObjectPoolTest_PoolStats");
+}
 
-		float CurrentTileEnd = CurrentTile->GetActorLocation().X + (TileSize / 2.0f);
-		float NextTileStart = NextTile->GetActorLocation().X - (TileSize / 2.0f);
+/**
+ * Test: Pooled Actor Handles
+ * Verify that handles resolve while the actor is active and go stale once it is returned,
+ * even if the same actor is handed out again, and that other pools reject them
+ */
+static bool ObjectPoolTest_PooledActorHandles()
+{
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
-		// Tiles should be adjacent with no gap (allowing small floating point tolerance)
-		float Gap = NextTileStart - CurrentTileEnd;
-		TEST_NEARLY_EQUAL(Gap, 0.0f, 1.0f, "No gap should exist between tiles");
-	}
+	FObjectPoolConfig Config;
+	Config.PoolSize = 1;
+	Config.bAutoExpand = false;
 
-	// Verify tiles form a continuous line
-	float ExpectedTotalLength = TileSize * 3;
-	float FirstTileStart = Tiles[0]->GetActorLocation().X - (TileSize / 2.0f);
-	float LastTileEnd = Tiles[2]->GetActorLocation().X + (TileSize / 2.0f);
-	float ActualTotalLength = LastTileEnd - FirstTileStart;
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
 
-	TEST_NEARLY_EQUAL(ActualTotalLength, ExpectedTotalLength, 1.0f,
-		"Total length should equal expected continuous length");
+	FPooledActorHandle FirstHandle;
+	AActor* Actor = PoolComponent->GetFromPoolWithHandle(FVector::ZeroVector, FRotator::ZeroRotator, FirstHandle);
+	TEST_NOT_NULL(Actor, "Should get actor from pool");
+	TEST_TRUE(FirstHandle.IsSet(), "Handle should be set");
+	TEST_TRUE(PoolComponent->IsHandleValid(FirstHandle), "Handle should be valid while active");
+	TEST_TRUE(PoolComponent->ResolveHandle(FirstHandle) == Actor, "Handle should resolve to the actor");
+	TEST_TRUE(PoolComponent->GetHandleForActor(Actor) == FirstHandle, "Actor lookup should return the same handle");
+
+	// Returning invalidates the handle and rejects a second release
+	TEST_TRUE(PoolComponent->ReturnToPoolByHandle(FirstHandle), "Should return by handle");
+	TEST_FALSE(PoolComponent->IsHandleValid(FirstHandle), "Handle should be stale after return");
+	TEST_NULL(PoolComponent->ResolveHandle(FirstHandle), "Stale handle should not resolve");
+	TEST_FALSE(PoolComponent->ReturnToPoolByHandle(FirstHandle), "Double release by handle should be rejected");
+	TEST_FALSE(PoolComponent->GetHandleForActor(Actor).IsSet(), "Inactive actor should have no handle");
+
+	// Reusing the same actor issues a new generation; the old handle stays stale
+	FPooledActorHandle SecondHandle;
+	AActor* ReusedActor = PoolComponent->GetFromPoolWithHandle(FVector::ZeroVector, FRotator::ZeroRotator, SecondHandle);
+	TEST_TRUE(ReusedActor == Actor, "Single-actor pool should reuse the same actor");
+	TEST_TRUE(SecondHandle != FirstHandle, "New activation should get a new handle");
+	TEST_FALSE(PoolComponent->IsHandleValid(FirstHandle), "Old handle must not resolve to the reused actor");
+	TEST_FALSE(PoolComponent->ReturnToPoolByHandle(FirstHandle), "Old handle must not release the reused actor");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 1, "Reused actor should still be active");
+
+	// A handle from another pool never matches, even when slot and generation line up
+	UObjectPoolComponent* OtherPool = CreateTestPoolComponent();
+	TEST_NOT_NULL(OtherPool, "Second pool component should be created");
+	OtherPool->Initialize(ATestPoolableActor::StaticClass(), Config);
+	FPooledActorHandle OtherHandle;
+	AActor* OtherActor = OtherPool->GetFromPoolWithHandle(FVector::ZeroVector, FRotator::ZeroRotator, OtherHandle);
+	TEST_NOT_NULL(OtherActor, "Should get actor from the second pool");
+	TEST_EQUAL(OtherHandle.SlotIndex, SecondHandle.SlotIndex, "Both pools should use the same slot");
+	TEST_FALSE(PoolComponent->IsHandleValid(OtherHandle), "Foreign handle should not be valid");
+	TEST_NULL(PoolComponent->ResolveHandle(OtherHandle), "Foreign handle should not resolve");
+	TEST_FALSE(PoolComponent->ReturnToPoolByHandle(OtherHandle), "Foreign handle must not release this pool's actor");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 1, "This pool's actor should still be active");
+	TEST_TRUE(OtherPool->ReturnToPoolByHandle(OtherHandle), "Issuing pool should accept its handle");
 
 	// Cleanup
-	if (PoolOwner)
+	if (OtherPool->GetOwner())
 	{
-		PoolOwner->Destroy();
+		OtherPool->GetOwner()->Destroy();
+	}
+	if (PoolComponent->GetOwner())
+	{
+		PoolComponent->GetOwner()->Destroy();
 	}
 
-	TEST_SUCCESS("GroundTileTest_SeamlessScrolling");
+	TEST_SUCCESS("ObjectPoolTest_PooledActorHandles");
 }
 
 /**
- * Test: Tile Positioning
- * Verify spawn positions are correct relative to war rig
+ * Test: Adaptive Target Size
+ * Verify that the adaptive target follows observed peak demand plus headroom,
+ * respects the floor and is capped by MaxPoolSize
  */
-static bool GroundTileTest_TilePositioning()
+static bool ObjectPoolTest_AdaptiveTargetSize()
 {
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	TEST_NOT_NULL(World, "World should exist");
-
-	// Create war rig at a specific position
-	const FVector WarRigPosition(1000.0f, 0.0f, 0.0f);
-	AActor* WarRig = CreateTestWarRig(World, WarRigPosition);
-	TEST_NOT_NULL(WarRig, "War rig should be created");
-
-	// Create pool
-	AActor* PoolOwner = World->SpawnActor<AActor>();
-	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
-
-	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool->RegisterComponent();
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
 	FObjectPoolConfig Config;
-	Config.PoolSize = 5;
-	Config.bAutoExpand = false;
-	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
-	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
-
-	const float TileSize = 2000.0f;
-	const float SpawnDistanceAhead = 5000.0f;
-
-	// Calculate where the furthest tile should spawn
-	float ExpectedFurthestPosition = WarRigPosition.X + SpawnDistanceAhead;
-
-	// Spawn a tile at the expected furthest position
-	AActor* TileActor = Pool->GetFromPool(FVector(ExpectedFurthestPosition, 0.0f, 0.0f), FRotator::ZeroRotator);
-	AGroundTile* Tile = Cast<AGroundTile>(TileActor);
-	TEST_NOT_NULL(Tile, "Tile should be created");
-
-	// Verify tile is at correct position
-	float ActualTileX = Tile->GetActorLocation().X;
-	TEST_NEARLY_EQUAL(ActualTileX, ExpectedFurthestPosition, 1.0f,
-		"Tile should be at correct spawn distance");
+	Config.PoolSize = 4;
+	Config.bAutoExpand = true;
+	Config.MaxPoolSize = 7;
+	Config.bAdaptiveSizing = true;
+	Config.MinPoolSize = 2;
+	Config.GrowHeadroom = 0.5f;
 
-	// Verify tile is ahead of war rig
-	TEST_TRUE(ActualTileX > WarRigPosition.X, "Tile should be ahead of war rig");
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
 
-	// Calculate distance between war rig and tile
-	float DistanceFromWarRig = ActualTileX - WarRigPosition.X;
-	TEST_NEARLY_EQUAL(DistanceFromWarRig, SpawnDistanceAhead, 1.0f,
-		"Distance should match spawn distance");
+	// No demand yet - target sits at the floor
+	TEST_EQUAL(PoolComponent->GetAdaptiveTargetSize(), 2, "Target should start at MinPoolSize");
 
-	// Test multiple tiles at different positions
-	float TestPosition1 = WarRigPosition.X - 1000.0f;
-	AActor* TestTileActor1 = Pool->GetFromPool(FVector(TestPosition1, 0.0f, 0.0f), FRotator::ZeroRotator);
-	if (TestTileActor1)
+	// Peak of 4 active -> 4 * 1.5 = 6
+	TArray<AActor*> Actors;
+	for (int32 i = 0; i < 4; ++i)
 	{
-		TEST_NEARLY_EQUAL(TestTileActor1->GetActorLocation().X, TestPosition1, 1.0f, "Tile at position 1");
-		Pool->ReturnToPool(TestTileActor1);
+		Actors.Add(PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator));
 	}
+	TEST_EQUAL(PoolComponent->GetAdaptiveTargetSize(), 6, "Target should be window peak plus headroom");
 
-	float TestPosition2 = WarRigPosition.X;
-	AActor* TestTileActor2 = Pool->GetFromPool(FVector(TestPosition2, 0.0f, 0.0f), FRotator::ZeroRotator);
-	if (TestTileActor2)
+	// Returning actors doesn't lower the target until the peak leaves the window
+	for (AActor* Actor : Actors)
 	{
-		TEST_NEARLY_EQUAL(TestTileActor2->GetActorLocation().X, TestPosition2, 1.0f, "Tile at position 2");
-		Pool->ReturnToPool(TestTileActor2);
+		PoolComponent->ReturnToPool(Actor);
 	}
+	TEST_EQUAL(PoolComponent->GetAdaptiveTargetSize(), 6, "Target should hold the window peak");
 
-	float TestPosition3 = WarRigPosition.X + 2000.0f;
-	AActor* TestTileActor3 = Pool->GetFromPool(FVector(TestPosition3, 0.0f, 0.0f), FRotator::ZeroRotator);
-	if (TestTileActor3)
+	// Peak of 5 active -> 7.5, capped at MaxPoolSize
+	for (int32 i = 0; i < 5; ++i)
 	{
-		TEST_NEARLY_EQUAL(TestTileActor3->GetActorLocation().X, TestPosition3, 1.0f, "Tile at position 3");
-		Pool->ReturnToPool(TestTileActor3);
+		PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
 	}
+	TEST_EQUAL(PoolComponent->GetAdaptiveTargetSize(), 7, "Target should be capped by MaxPoolSize");
 
 	// Cleanup
-	if (WarRig)
-	{
-		WarRig->Destroy();
-	}
-	if (PoolOwner)
+	if (PoolComponent->GetOwner())
 	{
-		PoolOwner->Destroy();
+		PoolComponent->GetOwner()->Destroy();
 	}
 
-	TEST_SUCCESS("GroundTileTest_TilePositioning");
+	TEST_SUCCESS("ObjectPoolTest_AdaptiveTargetSize");
 }
 
 /**
- * Test: Pool Size
- * Verify correct number of tiles created and pool respects size limits
+ * Test: Pool Subsystem Sharing
+ * Verify that the world pool subsystem hands out one shared pool per actor class,
+ * guards it against pool-wide calls while shared, and that initialized pools show up in its registry
  */
-static bool GroundTileTest_PoolSize()
+static bool ObjectPoolTest_SubsystemSharing()
 {
 	UWorld* World = GetTestWorldForObjectPoolTests();
-	TEST_NOT_NULL(World, "World should exist");
+	TEST_NOT_NULL(World, "Test world should exist");
 
-	AActor* PoolOwner = World->SpawnActor<AActor>();
-	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+	UObjectPoolSubsystem* PoolSubsystem = World->GetSubsystem<UObjectPoolSubsystem>();
+	TEST_NOT_NULL(PoolSubsystem, "Pool subsystem should exist in game worlds");
 
-	// Test pool size of 5
-	UObjectPoolComponent* Pool1 = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool1->RegisterComponent();
+	FObjectPoolConfig Config;
+	Config.PoolSize = 2;
 
-	FObjectPoolConfig Config1;
-	Config1.PoolSize = 5;
-	Config1.bAutoExpand = false;
+	// Two requests for the same class share one pool
+	UObjectPoolComponent* FirstPool = PoolSubsystem->GetOrCreatePool(ATestPoolableActor::StaticClass(), Config);
+	UObjectPoolComponent* SecondPool = PoolSubsystem->GetOrCreatePool(ATestPoolableActor::StaticClass(), Config);
+	TEST_NOT_NULL(FirstPool, "Shared pool should be created");
+	TEST_TRUE(FirstPool == SecondPool, "Same class should return the same pool");
+	TEST_TRUE(PoolSubsystem->FindPool(ATestPoolableActor::StaticClass()) == FirstPool, "FindPool should return the shared pool");
+
+	// Pools owned by other systems register on Initialize
+	UObjectPoolComponent* OwnedPool = CreateTestPoolComponent();
+	TEST_NOT_NULL(OwnedPool, "Owned pool component should be created");
+	OwnedPool->Initialize(ATestPoolableActor::StaticClass(), Config);
+
+	TArray<UObjectPoolComponent*> AllPools;
+	PoolSubsystem->GetAllPools(AllPools);
+	TEST_TRUE(AllPools.Contains(FirstPool), "Registry should contain the shared pool");
+	TEST_TRUE(AllPools.Contains(OwnedPool), "Registry should contain the owned pool");
+
+	// While both consumers draw from it, one can't take out the other's actors
+	TEST_EQUAL(FirstPool->GetConsumerCount(), 2, "Both requests should count as consumers");
+	TEST_TRUE(FirstPool->IsShared(), "Pool with two consumers should be shared");
+	AActor* OtherConsumersActor = FirstPool->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_NOT_NULL(OtherConsumersActor, "Should get an actor from the shared pool");
+	FirstPool->ClearPool();
+	TEST_EQUAL(FirstPool->GetActiveCount(), 1, "ClearPool should be rejected on a shared pool");
+	FirstPool->ResetPool();
+	TEST_EQUAL(FirstPool->GetActiveCount(), 1, "ResetPool should be rejected on a shared pool");
+	TArray<AActor*> Released;
+	TEST_EQUAL(FirstPool->ReleaseAllActors(Released), 0, "ReleaseAllActors should be rejected on a shared pool");
+	TEST_EQUAL(FirstPool->GetActiveCount(), 1, "Other consumer's actor should still be active");
+
+	// Once the second consumer lets go, the remaining one owns pool-wide calls again
+	PoolSubsystem->ReleasePool(SecondPool);
+	TEST_FALSE(FirstPool->IsShared(), "Pool with one consumer should not be shared");
+	FirstPool->ClearPool();
+	TEST_EQUAL(FirstPool->GetActiveCount(), 0, "ClearPool should work for the last consumer");
 
-	bool bInitSuccess1 = Pool1->Initialize(AGroundTile::StaticClass(), Config1);
-	TEST_TRUE(bInitSuccess1, "Pool should initialize with size 5");
-	TEST_EQUAL(Pool1->GetTotalPoolSize(), 5, "Pool should have 5 tiles");
-	TEST_EQUAL(Pool1->GetAvailableCount(), 5, "All 5 tiles should be available");
-	TEST_EQUAL(Pool1->GetActiveCount(), 0, "No tiles should be active initially");
+	// Cleanup
+	PoolSubsystem->ReleasePool(FirstPool);
+	FirstPool->DestroyComponent();
+	if (OwnedPool->GetOwner())
+	{
+		OwnedPool->GetOwner()->Destroy();
+	}
 
-	// Get all tiles from pool
-	TArray<AActor*> RetrievedTiles;
-	for (int32 i = 0; i < 5; ++i)
+	TEST_NULL(PoolSubsystem->FindPool(ATestPoolableActor::StaticClass()), "Destroyed shared pool should be unregistered");
+
+	TEST_SUCCESS("ObjectPoolTest_SubsystemSharing");
+}
+
+/**
+ * Test: Batch Acquire/Release
+ * Verify that batch calls place, activate and return actors like the single-actor calls,
+ * stop at pool exhaustion and skip duplicates
+ */
+static bool ObjectPoolTest_BatchAcquireRelease()
+{
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 3;
+	Config.bAutoExpand = false;
+
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
+
+	// Request one more than the pool holds
+	TArray<FTransform> Transforms;
+	for (int32 i = 0; i < 4; ++i)
 	{
-		AActor* Tile = Pool1->GetFromPool(FVector(i * 1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
-		TEST_NOT_NULL(Tile, "Should retrieve tile from pool");
-		RetrievedTiles.Add(Tile);
+		Transforms.Add(FTransform(FVector(i * 100.0f, 0.0f, 0.0f)));
 	}
 
-	// Verify pool is exhausted
-	TEST_EQUAL(Pool1->GetActiveCount(), 5, "All 5 tiles should be active");
-	TEST_EQUAL(Pool1->GetAvailableCount(), 0, "Pool should be exhausted");
-
-	// Try to get one more (should fail - no auto-expand)
-	AActor* ExtraTile = Pool1->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
-	TEST_NULL(ExtraTile, "Should not get tile when pool exhausted");
+	TArray<AActor*> Actors;
+	TArray<FPooledActorHandle> Handles;
+	const int32 NumAcquired = PoolComponent->GetFromPoolBatch(Transforms, Actors, &Handles);
+	TEST_EQUAL(NumAcquired, 3, "Batch should acquire all 3 pooled actors");
+	TEST_EQUAL(Actors.Num(), 3, "Should output 3 actors");
+	TEST_EQUAL(Handles.Num(), 3, "Should output 3 handles");
+	TEST_EQUAL(PoolComponent->GetPoolStats().ExhaustionMisses, 1, "Unserved request should count as a miss");
 
-	// Return tiles
-	for (AActor* Tile : RetrievedTiles)
+	for (int32 i = 0; i < Actors.Num(); ++i)
 	{
-		Pool1->ReturnToPool(Tile);
+		TEST_NEARLY_EQUAL(Actors[i]->GetActorLocation().X, i * 100.0f, 0.1f, "Actor should be placed at its transform");
+		TEST_TRUE(PoolComponent->IsHandleValid(Handles[i]), "Batch handle should be valid");
+
+		ATestPoolableActor* TestActor = Cast<ATestPoolableActor>(Actors[i]);
+		TEST_NOT_NULL(TestActor, "Actor should be a test poolable actor");
+		TEST_EQUAL(TestActor->ActivationCount, 1, "OnActivated should be called once per actor");
 	}
 
-	// Test minimum recommended size (3)
-	UObjectPoolComponent* Pool2 = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool2->RegisterComponent();
+	// Return with a duplicate entry - only the unique actors count
+	TArray<AActor*> ToReturn = { Actors[0], Actors[1], Actors[0] };
+	TEST_EQUAL(PoolComponent->ReturnToPoolBatch(ToReturn), 2, "Duplicate should be skipped");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 1, "Should have 1 active object");
+	TEST_EQUAL(PoolComponent->GetAvailableCount(), 2, "Should have 2 available objects");
+	TEST_FALSE(PoolComponent->IsHandleValid(Handles[0]), "Returned actor's handle should be stale");
 
-	FObjectPoolConfig Config2;
-	Config2.PoolSize = 3;
-	Config2.bAutoExpand = false;
-	bool bInitSuccess2 = Pool2->Initialize(AGroundTile::StaticClass(), Config2);
-	TEST_TRUE(bInitSuccess2, "Pool should initialize with size 3");
-	TEST_EQUAL(Pool2->GetTotalPoolSize(), 3, "Minimum pool size should be 3");
+	ATestPoolableActor* ReturnedActor = Cast<ATestPoolableActor>(Actors[0]);
+	TEST_EQUAL(ReturnedActor->DeactivationCount, 1, "OnDeactivated should be called once");
 
 	// Cleanup
-	if (PoolOwner)
+	if (PoolComponent->GetOwner())
 	{
-		PoolOwner->Destroy();
+		PoolComponent->GetOwner()->Destroy();
 	}
 
-	TEST_SUCCESS("GroundTileTest_PoolSize");
+	TEST_SUCCESS("ObjectPoolTest_BatchAcquireRelease");
 }
 
 /**
- * Test: Tile Despawn
- * Verify tiles are returned to pool at correct distance behind war rig
+ * Test: Deferred State Changes
+ * Verify deferred mode applies activation at flush time and collapses acquire+return within a frame
  */
-static bool GroundTileTest_TileDespawn()
+static bool ObjectPoolTest_DeferredStateChanges()
 {
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	TEST_NOT_NULL(World, "World should exist");
-
-	// Create war rig
-	const FVector WarRigPosition(5000.0f, 0.0f, 0.0f);
-	AActor* WarRig = CreateTestWarRig(World, WarRigPosition);
-	TEST_NOT_NULL(WarRig, "War rig should be created");
-
-	// Create pool
-	AActor* PoolOwner = World->SpawnActor<AActor>();
-	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
-
-	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
-	Pool->RegisterComponent();
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
 	FObjectPoolConfig Config;
-	Config.PoolSize = 5;
+	Config.PoolSize = 2;
 	Config.bAutoExpand = false;
-	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
-	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+	Config.bDeferActorStateChanges = true;
 
-	const float DespawnDistance = 1000.0f;
-	const float DespawnThreshold = WarRigPosition.X - DespawnDistance;
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
 
-	// Test tile well behind threshold (should despawn)
-	float Position1 = DespawnThreshold - 500.0f;
-	AActor* TileActor1 = Pool->GetFromPool(FVector(Position1, 0.0f, 0.0f), FRotator::ZeroRotator);
-	TEST_NOT_NULL(TileActor1, "Tile 1 should be created");
-	AGroundTile* Tile1 = Cast<AGroundTile>(TileActor1);
-	bool IsBehind1 = (Tile1->GetActorLocation().X < DespawnThreshold);
-	TEST_TRUE(IsBehind1, "Tile 1 should be behind threshold");
-	Pool->ReturnToPool(TileActor1);
-	TEST_TRUE(Tile1->IsHidden(), "Despawned tile should be hidden");
+	// Acquire: bookkeeping and callbacks are immediate, visibility waits for the flush
+	AActor* Actor = PoolComponent->GetFromPool(FVector(100.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(Actor, "Should get actor from pool");
+	TEST_EQUAL(PoolComponent->GetActiveCount(), 1, "Actor should be active immediately");
+	TEST_NEARLY_EQUAL(Actor->GetActorLocation().X, 100.0f, 0.1f, "Actor should be placed immediately");
+	TEST_TRUE(Actor->IsHidden(), "Actor should stay hidden until the flush");
+	TEST_EQUAL(PoolComponent->GetPendingStateChangeCount(), 1, "Activation should be queued");
+
+	PoolComponent->FlushDeferredStateChanges();
+	TEST_FALSE(Actor->IsHidden(), "Actor should be visible after the flush");
+	TEST_EQUAL(PoolComponent->GetPendingStateChangeCount(), 0, "Queue should be empty after the flush");
+	TEST_EQUAL(PoolComponent->GetPoolStats().DeferredStateChangesApplied, 1, "One state change should be applied");
+
+	// Acquire and return within one frame - nothing should touch the actor's state
+	AActor* Transient = PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_NOT_NULL(Transient, "Should get second actor from pool");
+	TEST_TRUE(PoolComponent->ReturnToPool(Transient), "Should return second actor");
+	TEST_EQUAL(PoolComponent->GetPendingStateChangeCount(), 1, "Slot should only be queued once");
+
+	PoolComponent->FlushDeferredStateChanges();
+	TEST_TRUE(Transient->IsHidden(), "Transient actor should still be hidden");
+	TEST_EQUAL(PoolComponent->GetPoolStats().DeferredStateChangesCoalesced, 1, "Activate+deactivate should coalesce");
+	TEST_EQUAL(PoolComponent->GetPoolStats().DeferredStateChangesApplied, 1, "No extra state change should be applied");
+
+	ATestPoolableActor* TestActor = Cast<ATestPoolableActor>(Transient);
+	TEST_NOT_NULL(TestActor, "Actor should be a test poolable actor");
+	TEST_EQUAL(TestActor->ActivationCount, 1, "OnActivated should still fire");
+	TEST_EQUAL(TestActor->DeactivationCount, 1, "OnDeactivated should still fire");
 
-	// Test tile ahead of threshold (should not despawn)
-	float Position2 = DespawnThreshold + 500.0f;
-	AActor* TileActor2 = Pool->GetFromPool(FVector(Position2, 0.0f, 0.0f), FRotator::ZeroRotator);
-	TEST_NOT_NULL(TileActor2, "Tile 2 should be created");
-	AGroundTile* Tile2 = Cast<AGroundTile>(TileActor2);
-	bool IsBehind2 = (Tile2->GetActorLocation().X < DespawnThreshold);
-	TEST_FALSE(IsBehind2, "Tile 2 should be ahead of threshold");
-	Pool->ReturnToPool(TileActor2);
+	// Cleanup
+	if (PoolComponent->GetOwner())
+	{
+		PoolComponent->GetOwner()->Destroy();
+	}
 
-	// Test tile at war rig position (should not despawn)
-	float Position3 = WarRigPosition.X;
-	AActor* TileActor3 = Pool->GetFromPool(FVector(Position3, 0.0f, 0.0f), FRotator::ZeroRotator);
-	TEST_NOT_NULL(TileActor3, "Tile 3 should be created");
-	AGroundTile* Tile3 = Cast<AGroundTile>(TileActor3);
-	bool IsBehind3 = (Tile3->GetActorLocation().X < DespawnThreshold);
-	TEST_FALSE(IsBehind3, "Tile 3 should be ahead of threshold");
-	Pool->ReturnToPool(TileActor3);
+	TEST_SUCCESS("ObjectPoolTest_DeferredStateChanges");
+}
 
-	// Verify pool statistics after despawn operations
-	TEST_EQUAL(Pool->GetActiveCount(), 0, "All tiles returned");
-	TEST_EQUAL(Pool->GetAvailableCount(), 5, "All tiles available");
+/**
+ * Test: Pool Cache Across Levels
+ * Verify a persisted pool's actors are parked when the level is left and adopted by the next pool instead of respawned
+ */
+static bool ObjectPoolTest_PoolCacheAcrossLevels()
+{
+	UObjectPoolComponent* PoolComponent = CreateTestPoolComponent();
+	TEST_NOT_NULL(PoolComponent, "Pool component should be created");
 
-	// Test distance-based despawn with moving war rig
-	AActor* TestTile = Pool->GetFromPool(FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
-	TEST_NOT_NULL(TestTile, "Test tile should be created");
+	UObjectPoolCacheSubsystem* PoolCache = UObjectPoolCacheSubsystem::Get(PoolComponent);
+	TEST_NOT_NULL(PoolCache, "Game instance should provide the pool cache");
+	PoolCache->ForgetClass(ATestPoolableActor::StaticClass());
 
-	// Move war rig forward, making tile fall behind despawn threshold
-	WarRig->SetActorLocation(FVector(3000.0f, 0.0f, 0.0f));
-	float NewDespawnThreshold = 3000.0f - DespawnDistance;
-	float TilePosition = TestTile->GetActorLocation().X;
+	FObjectPoolConfig Config;
+	Config.PoolSize = 2;
+	Config.bAutoExpand = true;
+	Config.MaxPoolSize = 10;
+	Config.bPersistAcrossLevels = true;
 
-	// Tile at 1000 should now be behind threshold of 2000
-	TEST_TRUE(TilePosition < NewDespawnThreshold, "Tile should be behind new threshold");
+	PoolComponent->Initialize(ATestPoolableActor::StaticClass(), Config);
 
-	// Cleanup
-	Pool->ReturnToPool(TestTile);
-	if (WarRig)
+	// Grow the pool to 4 through demand, leaving one actor in use
+	TArray<AActor*> OriginalActors;
+	for (int32 i = 0; i < 4; ++i)
 	{
-		WarRig->Destroy();
+		OriginalActors.Add(PoolComponent->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator));
 	}
-	if (PoolOwner)
+	TEST_EQUAL(PoolComponent->GetTotalPoolSize(), 4, "Pool should have expanded to 4");
+	for (int32 i = 1; i < 4; ++i)
 	{
-		PoolOwner->Destroy();
+		PoolComponent->ReturnToPool(OriginalActors[i]);
 	}
 
-	TEST_SUCCESS("GroundTileTest_TileDespawn");
-}
-
-// ============================================================================
-// TURRET TEST HELPERS
-// ============================================================================
-
-// Helper function to create a test war rig
-static AWarRigPawn* CreateTestWarRig()
-{
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	if (!World)
+	// Leaving the level parks every actor (the one in use is returned first)
+	TEST_EQUAL(PoolCache->ParkPool(PoolComponent), 4, "Every pooled actor should be parked");
+	TEST_EQUAL(PoolComponent->GetTotalPoolSize(), 0, "Parked pool should be empty");
+	TEST_TRUE(OriginalActors[0]->IsHidden(), "Parked actor should be inactive");
+	TEST_NULL(OriginalActors[0]->GetOwner(), "Parked actor should not be owned by the old pool host");
+
+	// The old pool host going away doesn't take the parked actors with it
+	PoolComponent->GetOwner()->Destroy();
+	TEST_EQUAL(PoolCache->GetParkedActorCount(ATestPoolableActor::StaticClass()), 4, "Parked actors should outlive their pool");
+
+	TArray<AActor*> TravelActors;
+	PoolCache->GetParkedActors(TravelActors);
+	TEST_TRUE(TravelActors.Contains(OriginalActors[0]), "Parked actors should be listed for seamless travel");
+
+	// Pools that don't opt in ignore the cache
+	UObjectPoolComponent* PlainPool = CreateTestPoolComponent();
+	TEST_NOT_NULL(PlainPool, "Plain pool component should be created");
+	Config.bPersistAcrossLevels = false;
+	PlainPool->Initialize(ATestPoolableActor::StaticClass(), Config);
+	TEST_EQUAL(PlainPool->GetTotalPoolSize(), 2, "Non-persisted pool should spawn its configured size");
+	TEST_EQUAL(PoolCache->GetParkedActorCount(ATestPoolableActor::StaticClass()), 4, "Non-persisted pool should leave parked actors alone");
+
+	// The next level's pool adopts the parked actors instead of spawning
+	UObjectPoolComponent* NextPool = CreateTestPoolComponent();
+	TEST_NOT_NULL(NextPool, "Next pool component should be created");
+	Config.bPersistAcrossLevels = true;
+	NextPool->Initialize(ATestPoolableActor::StaticClass(), Config);
+	TEST_EQUAL(NextPool->GetTotalPoolSize(), 4, "Persisted pool should adopt every parked actor");
+	TEST_EQUAL(PoolCache->GetParkedActorCount(ATestPoolableActor::StaticClass()), 0, "Adopted actors should leave the cache");
+
+	TArray<AActor*> Reused;
+	for (int32 i = 0; i < 4; ++i)
 	{
-		return nullptr;
+		Reused.Add(NextPool->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator));
 	}
-
-	AWarRigPawn* WarRig = World->SpawnActor<AWarRigPawn>();
-	if (WarRig)
+	for (AActor* Actor : OriginalActors)
 	{
-		WarRig->SetActorLocation(FVector::ZeroVector);
+		TEST_TRUE(Reused.Contains(Actor), "Next level should reuse the parked actors");
 	}
-	return WarRig;
-}
+	TEST_EQUAL(NextPool->GetPoolStats().ExpansionCount, 0, "Adopted pool should not need to spawn");
+	TEST_EQUAL(Reused[0]->GetOwner(), NextPool->GetOwner(), "Adopted actors should belong to the new pool host");
 
-// Helper function to create a test turret
-static ATurretBase* CreateTestTurret()
-{
-	UWorld* World = GetTestWorldForObjectPoolTests();
-	if (!World)
+	// Cleanup
+	if (NextPool->GetOwner())
 	{
-		return nullptr;
+		NextPool->GetOwner()->Destroy();
 	}
+	if (PlainPool->GetOwner())
+	{
+		PlainPool->GetOwner()->Destroy();
+	}
+	for (AActor* Actor : OriginalActors)
+	{
+		if (IsValid(Actor))
+		{
+			Actor->Destroy();
+		}
+	}
+	PoolCache->ForgetClass(ATestPoolableActor::StaticClass());
 
-	// Spawn test turret at origin (using concrete ATestTurret class instead of abstract ATurretBase)
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	ATurretBase* Turret = World->SpawnActor<ATestTurret>(ATestTurret::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-	return Turret;
-}
-
-// Helper function to create test turret data
-static FTurretData CreateTestTurretData()
-{
-	FTurretData Data;
-	Data.TurretName = TEXT("TestTurret");
-	Data.DisplayName = FText::FromString(TEXT("Test Turret"));
-	Data.Description = FText::FromString(TEXT("A test turret for unit testing"));
-	Data.BaseDamage = 25.0f;
-	Data.FireRate = 2.0f;
-	Data.Range = 1500.0f;
-	Data.BaseHealth = 150.0f;
-	Data.BuildCost = 100;
-	Data.UpgradeCost = 50;
-	return Data;
+	TEST_SUCCESS("ObjectPoolTest_PoolCacheAcrossLevels");
 }
 
-// ============================================================================
-// TURRET TESTS
-// ============================================================================
-
 /**
- * Test: Turret Spawn
- * Verify that turret spawns at mount point correctly with all components
+ * Test: Restart Run State
+ * Restarts travel seamlessly (for the pool cache) and keep the player controller, so the controller
+ * must start a fresh run after the travel instead of carrying game over and scrap into it
  */
-static bool TurretTest_TurretSpawn()
+static bool ObjectPoolTest_RestartRunState()
 {
-	ATurretBase* Turret = CreateTestTurret();
-	TEST_NOT_NULL(Turret, "Turret should be created");
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
 
-	// Verify components exist
-	TEST_NOT_NULL(Turret->GetAbilitySystemComponent(), "AbilitySystemComponent should exist");
-	TEST_NOT_NULL(Turret->GetCombatAttributeSet(), "CombatAttributeSet should exist");
-	TEST_NOT_NULL(Turret->GetRootComponent(), "Root component should exist");
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AWarRigPlayerController* Controller = World->SpawnActor<AWarRigPlayerController>(AWarRigPlayerController::StaticClass(), FTransform::Identity, SpawnParams);
+	TEST_NOT_NULL(Controller, "Player controller should be spawned");
 
-	// Verify initial state
-	TEST_EQUAL(Turret->GetMountIndex(), -1, "Mount index should be -1 (uninitialized)");
-	TEST_NULL(Turret->GetOwnerWarRig(), "Owner war rig should be null (not initialized)");
-	TEST_NULL(Turret->GetCurrentTarget(), "Current target should be null");
+	const int32 StartingScrap = Controller->GetScrap();
+	TEST_FALSE(Controller->IsGameOver(), "New run should not be over");
+
+	// Play a run to game over
+	TEST_TRUE(Controller->SpendScrap(FMath::Min(StartingScrap, 30)), "Should spend scrap during the run");
+	TEST_TRUE(Controller->AddScrap(7), "Should collect scrap during the run");
+	Controller->OnGameOver(false);
+	TEST_TRUE(Controller->IsGameOver(), "Run should be over");
+	TEST_TRUE(Controller->GetScrap() != StartingScrap, "Run should have changed the scrap");
+
+	// The restart's seamless travel keeps the controller; the next level starts a new run
+	Controller->PostSeamlessTravel();
+	TEST_FALSE(Controller->IsGameOver(), "Restarted run should not start over");
+	TEST_EQUAL(Controller->GetScrap(), StartingScrap, "Restarted run should start with the starting scrap");
 
 	// Cleanup
-	if (Turret)
-	{
-		Turret->Destroy();
-	}
+	Controller->Destroy();
 
-	TEST_SUCCESS("TurretTest_TurretSpawn");
+	TEST_SUCCESS("ObjectPoolTest_RestartRunState");
 }
 
 /**
- * Test: Target Acquisition
- * Verify turret finds targets within range and firing arc
+ * Test: Asset Preload
+ * Verify data table rows are walked for soft references and each table is only preloaded once
  */
-static bool TurretTest_TargetAcquisition()
+static bool ObjectPoolTest_AssetPreload()
 {
 	UWorld* World = GetTestWorldForObjectPoolTests();
 	TEST_NOT_NULL(World, "World should exist");
 
-	ATurretBase* Turret = CreateTestTurret();
-	TEST_NOT_NULL(Turret, "Turret should be created");
+	UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(World);
+	TEST_NOT_NULL(Preloader, "World should provide the asset preloader");
 
-	// Initialize turret
-	AWarRigPawn* WarRig = CreateTestWarRig();
-	FTurretData TurretData = CreateTestTurretData();
-	FRotator FacingDirection = FRotator(0.0f, 0.0f, 0.0f); // Facing forward (X-axis)
-	Turret->Initialize(TurretData, 0, FacingDirection, WarRig);
+	// Gathering collects each set soft reference once
+	const FSoftObjectPath CubePath(TEXT("/Engine/BasicShapes/Cube.Cube"));
+	const FSoftObjectPath CylinderPath(TEXT("/Engine/BasicShapes/Cylinder.Cylinder"));
 
-	// Verify attributes initialized correctly
-	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
-	TEST_NOT_NULL(Attributes, "Attributes should exist after initialization");
-	TEST_NEARLY_EQUAL(Attributes->GetRange(), TurretData.Range, 0.1f, "Range should match data table");
+	FWarRigData RigRow;
+	RigRow.MeshSections.Add(TSoftObjectPtr<UStaticMesh>(CubePath));
+	RigRow.MeshSections.Add(TSoftObjectPtr<UStaticMesh>(CubePath));
+	RigRow.MeshSections.Add(TSoftObjectPtr<UStaticMesh>(CylinderPath));
 
-	// Create a test target (enemy pawn) within range and arc
-	FVector TargetLocationInRange = Turret->GetActorLocation() + FVector(500.0f, 0.0f, 0.0f); // 500 units ahead
-	AActor* TargetInRange = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationInRange, FRotator::ZeroRotator);
-	TEST_NOT_NULL(TargetInRange, "Target in range should be created");
+	TArray<FSoftObjectPath> GatheredPaths;
+	UAssetPreloadSubsystem::GatherRowAssets(RigRow, GatheredPaths);
+	TEST_EQUAL(GatheredPaths.Num(), 2, "Duplicate and unset references should be skipped");
+	TEST_TRUE(GatheredPaths.Contains(CubePath), "Cube mesh should be gathered");
+	TEST_TRUE(GatheredPaths.Contains(CylinderPath), "Cylinder mesh should be gathered");
 
-	// Verify target is in firing arc
-	bool bIsInArc = Turret->IsTargetInFiringArc(TargetLocationInRange);
-	TEST_TRUE(bIsInArc, "Target should be within 180° firing arc");
+	// A table is walked once; later calls (e.g. from each consumer's BeginPlay) are free
+	UDataTable* RigTable = NewObject<UDataTable>();
+	RigTable->RowStruct = FWarRigData::StaticStruct();
+	RigTable->AddRow(FName(TEXT("TestRig")), RigRow);
 
-	// Create a test target outside range
-	FVector TargetLocationOutOfRange = Turret->GetActorLocation() + FVector(3000.0f, 0.0f, 0.0f); // 3000 units ahead (beyond range)
-	AActor* TargetOutOfRange = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationOutOfRange, FRotator::ZeroRotator);
-	TEST_NOT_NULL(TargetOutOfRange, "Target out of range should be created");
+	Preloader->PreloadDataTable(RigTable);
+	TEST_EQUAL(Preloader->PreloadDataTable(RigTable), 0, "Preloading the same table again should request nothing");
 
-	// Create a target behind turret (outside arc)
-	FVector TargetLocationBehind = Turret->GetActorLocation() + FVector(-500.0f, 0.0f, 0.0f); // 500 units behind
-	AActor* TargetBehind = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationBehind, FRotator::ZeroRotator);
-	TEST_NOT_NULL(TargetBehind, "Target behind should be created");
+	// Null references resolve to null without a sync load
+	const int32 FallbacksBefore = Preloader->GetSyncFallbackCount();
+	TEST_TRUE(UAssetPreloadSubsystem::ResolveAsset(World, TSoftObjectPtr<UStaticMesh>()) == nullptr, "Null reference should resolve to null");
+	TEST_EQUAL(Preloader->GetSyncFallbackCount(), FallbacksBefore, "Null reference should not count as a sync fallback");
 
-	// Verify target behind is not in arc
-	bool bIsBehindInArc = Turret->IsTargetInFiringArc(TargetLocationBehind);
-	TEST_FALSE(bIsBehindInArc, "Target behind should not be in firing arc");
+	// Once the preload has finished, its assets resolve from memory without a sync fallback
+	if (Preloader->IsPreloadComplete())
+	{
+		TEST_TRUE(UAssetPreloadSubsystem::ResolveAsset(World, TSoftObjectPtr<UStaticMesh>(CubePath)) != nullptr, "Preloaded mesh should resolve");
+		TEST_EQUAL(Preloader->GetSyncFallbackCount(), FallbacksBefore, "Preloaded mesh should not need a sync fallback");
+	}
 
-	// Cleanup
-	if (Turret) Turret->Destroy();
-	if (WarRig) WarRig->Destroy();
-	if (TargetInRange) TargetInRange->Destroy();
-	if (TargetOutOfRange) TargetOutOfRange->Destroy();
-	if (TargetBehind) TargetBehind->Destroy();
+	// The game mode preloads the tables its consumers read before they begin play
+	if (const AWhitelineNightmareGameMode* GameMode = World->GetAuthGameMode<AWhitelineNightmareGameMode>())
+	{
+		TArray<UDataTable*> GameModeTables;
+		GameMode->GatherPreloadDataTables(GameModeTables);
+		for (const UDataTable* DataTable : GameModeTables)
+		{
+			TEST_EQUAL(Preloader->PreloadDataTable(DataTable), 0, "Game mode tables should already be preloaded");
+		}
+		if (GameMode->GroundTileManager && GameMode->GroundTileManager->GetTileDataTable())
+		{
+			TEST_TRUE(GameModeTables.Contains(GameMode->GroundTileManager->GetTileDataTable()), "Tile manager table should be preloaded by the game mode");
+		}
+	}
+
+	TEST_SUCCESS("ObjectPoolTest_AssetPreload");
+}
+
+// ============================================================================
+// GROUND TILE TESTS
+// ============================================================================
+
+// Helper function to create a simple war rig stand-in for testing
+static AActor* CreateTestWarRig(UWorld* World, const FVector& Location)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AActor* WarRig = World->SpawnActor<AActor>(AActor::StaticClass(), Location, FRotator::ZeroRotator);
+	if (WarRig)
+	{
+		WarRig->SetActorLabel(TEXT("WarRig"));
+	}
+	return WarRig;
+}
+
+/**
+ * Test: Tile Pool Recycling
+ * Verify tiles are reused, not destroyed when they leave the visible area
+ */
+static bool GroundTileTest_TilePoolRecycling()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	// Create a war rig for position reference
+	AActor* WarRig = CreateTestWarRig(World, FVector::ZeroVector);
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	// Create pool directly without accessing protected members
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool->RegisterComponent();
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 5;
+	Config.bAutoExpand = false;
+	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
+	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+
+	TEST_EQUAL(Pool->GetTotalPoolSize(), 5, "Pool should have 5 tiles");
+
+	// Get a tile from the pool
+	AActor* Tile1Actor = Pool->GetFromPool(FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(Tile1Actor, "First tile should be retrieved");
+	AGroundTile* Tile1 = Cast<AGroundTile>(Tile1Actor);
+	TEST_NOT_NULL(Tile1, "Should be a GroundTile");
+
+	// Store the pointer to the first tile
+	AGroundTile* OriginalTile = Tile1;
+
+	// Return it to the pool
+	Pool->ReturnToPool(Tile1);
+	TEST_EQUAL(Pool->GetAvailableCount(), 5, "All tiles should be available again");
+
+	// Get a tile again
+	AActor* Tile2Actor = Pool->GetFromPool(FVector(3000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	AGroundTile* Tile2 = Cast<AGroundTile>(Tile2Actor);
+
+	// Verify it's the SAME instance (reused, not destroyed and recreated)
+	TEST_EQUAL(OriginalTile, Tile2, "Pool should reuse the same tile instance");
+	TEST_EQUAL(Pool->GetTotalPoolSize(), 5, "Pool size should remain constant");
+
+	// Cleanup
+	if (WarRig)
+	{
+		WarRig->Destroy();
+	}
+	if (PoolOwner)
+	{
+		PoolOwner->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_TilePoolRecycling");
+}
+
+/**
+ * Test: Seamless Scrolling
+ * Verify no gaps between tiles when positioned in sequence
+ */
+static bool GroundTileTest_SeamlessScrolling()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	// Create pool
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool->RegisterComponent();
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 3;
+	Config.bAutoExpand = false;
+	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
+	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+
+	const float TileSize = 2000.0f;
+
+	// Spawn tiles in sequence
+	TArray<AGroundTile*> Tiles;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		float XPosition = i * TileSize;
+		AActor* TileActor = Pool->GetFromPool(FVector(XPosition, 0.0f, 0.0f), FRotator::ZeroRotator);
+		AGroundTile* Tile = Cast<AGroundTile>(TileActor);
+		TEST_NOT_NULL(Tile, "Tile should be created");
+
+		Tile->SetTileLength(TileSize);
+		Tiles.Add(Tile);
+	}
+
+	// Verify no gaps between tiles
+	for (int32 i = 0; i < Tiles.Num() - 1; ++i)
+	{
+		AGroundTile* CurrentTile = Tiles[i];
+		AGroundTile* NextTile = Tiles[i + 1];
+
+		float CurrentTileEnd = CurrentTile->GetActorLocation().X + (TileSize / 2.0f);
+		float NextTileStart = NextTile->GetActorLocation().X - (TileSize / 2.0f);
+
+		// Tiles should be adjacent with no gap (allowing small floating point tolerance)
+		float Gap = NextTileStart - CurrentTileEnd;
+		TEST_NEARLY_EQUAL(Gap, 0.0f, 1.0f, "No gap should exist between tiles");
+	}
+
+	// Verify tiles form a continuous line
+	float ExpectedTotalLength = TileSize * 3;
+	float FirstTileStart = Tiles[0]->GetActorLocation().X - (TileSize / 2.0f);
+	float LastTileEnd = Tiles[2]->GetActorLocation().X + (TileSize / 2.0f);
+	float ActualTotalLength = LastTileEnd - FirstTileStart;
+
+	TEST_NEARLY_EQUAL(ActualTotalLength, ExpectedTotalLength, 1.0f,
+		"Total length should equal expected continuous length");
+
+	// Cleanup
+	if (PoolOwner)
+	{
+		PoolOwner->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_SeamlessScrolling");
+}
+
+/**
+ * Test: Tile Positioning
+ * Verify spawn positions are correct relative to war rig
+ */
+static bool GroundTileTest_TilePositioning()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	// Create war rig at a specific position
+	const FVector WarRigPosition(1000.0f, 0.0f, 0.0f);
+	AActor* WarRig = CreateTestWarRig(World, WarRigPosition);
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	// Create pool
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool->RegisterComponent();
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 5;
+	Config.bAutoExpand = false;
+	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
+	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+
+	const float TileSize = 2000.0f;
+	const float SpawnDistanceAhead = 5000.0f;
+
+	// Calculate where the furthest tile should spawn
+	float ExpectedFurthestPosition = WarRigPosition.X + SpawnDistanceAhead;
+
+	// Spawn a tile at the expected furthest position
+	AActor* TileActor = Pool->GetFromPool(FVector(ExpectedFurthestPosition, 0.0f, 0.0f), FRotator::ZeroRotator);
+	AGroundTile* Tile = Cast<AGroundTile>(TileActor);
+	TEST_NOT_NULL(Tile, "Tile should be created");
+
+	// Verify tile is at correct position
+	float ActualTileX = Tile->GetActorLocation().X;
+	TEST_NEARLY_EQUAL(ActualTileX, ExpectedFurthestPosition, 1.0f,
+		"Tile should be at correct spawn distance");
+
+	// Verify tile is ahead of war rig
+	TEST_TRUE(ActualTileX > WarRigPosition.X, "Tile should be ahead of war rig");
+
+	// Calculate distance between war rig and tile
+	float DistanceFromWarRig = ActualTileX - WarRigPosition.X;
+	TEST_NEARLY_EQUAL(DistanceFromWarRig, SpawnDistanceAhead, 1.0f,
+		"Distance should match spawn distance");
+
+	// Test multiple tiles at different positions
+	float TestPosition1 = WarRigPosition.X - 1000.0f;
+	AActor* TestTileActor1 = Pool->GetFromPool(FVector(TestPosition1, 0.0f, 0.0f), FRotator::ZeroRotator);
+	if (TestTileActor1)
+	{
+		TEST_NEARLY_EQUAL(TestTileActor1->GetActorLocation().X, TestPosition1, 1.0f, "Tile at position 1");
+		Pool->ReturnToPool(TestTileActor1);
+	}
+
+	float TestPosition2 = WarRigPosition.X;
+	AActor* TestTileActor2 = Pool->GetFromPool(FVector(TestPosition2, 0.0f, 0.0f), FRotator::ZeroRotator);
+	if (TestTileActor2)
+	{
+		TEST_NEARLY_EQUAL(TestTileActor2->GetActorLocation().X, TestPosition2, 1.0f, "Tile at position 2");
+		Pool->ReturnToPool(TestTileActor2);
+	}
+
+	float TestPosition3 = WarRigPosition.X + 2000.0f;
+	AActor* TestTileActor3 = Pool->GetFromPool(FVector(TestPosition3, 0.0f, 0.0f), FRotator::ZeroRotator);
+	if (TestTileActor3)
+	{
+		TEST_NEARLY_EQUAL(TestTileActor3->GetActorLocation().X, TestPosition3, 1.0f, "Tile at position 3");
+		Pool->ReturnToPool(TestTileActor3);
+	}
+
+	// Cleanup
+	if (WarRig)
+	{
+		WarRig->Destroy();
+	}
+	if (PoolOwner)
+	{
+		PoolOwner->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_TilePositioning");
+}
+
+/**
+ * Test: Pool Size
+ * Verify correct number of tiles created and pool respects size limits
+ */
+static bool GroundTileTest_PoolSize()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+
+	// Test pool size of 5
+	UObjectPoolComponent* Pool1 = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool1->RegisterComponent();
+
+	FObjectPoolConfig Config1;
+	Config1.PoolSize = 5;
+	Config1.bAutoExpand = false;
+
+	bool bInitSuccess1 = Pool1->Initialize(AGroundTile::StaticClass(), Config1);
+	TEST_TRUE(bInitSuccess1, "Pool should initialize with size 5");
+	TEST_EQUAL(Pool1->GetTotalPoolSize(), 5, "Pool should have 5 tiles");
+	TEST_EQUAL(Pool1->GetAvailableCount(), 5, "All 5 tiles should be available");
+	TEST_EQUAL(Pool1->GetActiveCount(), 0, "No tiles should be active initially");
+
+	// Get all tiles from pool
+	TArray<AActor*> RetrievedTiles;
+	for (int32 i = 0; i < 5; ++i)
+	{
+		AActor* Tile = Pool1->GetFromPool(FVector(i * 1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+		TEST_NOT_NULL(Tile, "Should retrieve tile from pool");
+		RetrievedTiles.Add(Tile);
+	}
+
+	// Verify pool is exhausted
+	TEST_EQUAL(Pool1->GetActiveCount(), 5, "All 5 tiles should be active");
+	TEST_EQUAL(Pool1->GetAvailableCount(), 0, "Pool should be exhausted");
+
+	// Try to get one more (should fail - no auto-expand)
+	AActor* ExtraTile = Pool1->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_NULL(ExtraTile, "Should not get tile when pool exhausted");
+
+	// Return tiles
+	for (AActor* Tile : RetrievedTiles)
+	{
+		Pool1->ReturnToPool(Tile);
+	}
+
+	// Test minimum recommended size (3)
+	UObjectPoolComponent* Pool2 = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool2->RegisterComponent();
+
+	FObjectPoolConfig Config2;
+	Config2.PoolSize = 3;
+	Config2.bAutoExpand = false;
+	bool bInitSuccess2 = Pool2->Initialize(AGroundTile::StaticClass(), Config2);
+	TEST_TRUE(bInitSuccess2, "Pool should initialize with size 3");
+	TEST_EQUAL(Pool2->GetTotalPoolSize(), 3, "Minimum pool size should be 3");
+
+	// Cleanup
+	if (PoolOwner)
+	{
+		PoolOwner->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_PoolSize");
+}
+
+/**
+ * Test: Tile Despawn
+ * Verify tiles are returned to pool at correct distance behind war rig
+ */
+static bool GroundTileTest_TileDespawn()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	// Create war rig
+	const FVector WarRigPosition(5000.0f, 0.0f, 0.0f);
+	AActor* WarRig = CreateTestWarRig(World, WarRigPosition);
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	// Create pool
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
+
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool->RegisterComponent();
+
+	FObjectPoolConfig Config;
+	Config.PoolSize = 5;
+	Config.bAutoExpand = false;
+	bool bInitSuccess = Pool->Initialize(AGroundTile::StaticClass(), Config);
+	TEST_TRUE(bInitSuccess, "Pool should initialize successfully");
+
+	const float DespawnDistance = 1000.0f;
+	const float DespawnThreshold = WarRigPosition.X - DespawnDistance;
+
+	// Test tile well behind threshold (should despawn)
+	float Position1 = DespawnThreshold - 500.0f;
+	AActor* TileActor1 = Pool->GetFromPool(FVector(Position1, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(TileActor1, "Tile 1 should be created");
+	AGroundTile* Tile1 = Cast<AGroundTile>(TileActor1);
+	bool IsBehind1 = (Tile1->GetActorLocation().X < DespawnThreshold);
+	TEST_TRUE(IsBehind1, "Tile 1 should be behind threshold");
+	Pool->ReturnToPool(TileActor1);
+	TEST_TRUE(Tile1->IsHidden(), "Despawned tile should be hidden");
+
+	// Test tile ahead of threshold (should not despawn)
+	float Position2 = DespawnThreshold + 500.0f;
+	AActor* TileActor2 = Pool->GetFromPool(FVector(Position2, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(TileActor2, "Tile 2 should be created");
+	AGroundTile* Tile2 = Cast<AGroundTile>(TileActor2);
+	bool IsBehind2 = (Tile2->GetActorLocation().X < DespawnThreshold);
+	TEST_FALSE(IsBehind2, "Tile 2 should be ahead of threshold");
+	Pool->ReturnToPool(TileActor2);
+
+	// Test tile at war rig position (should not despawn)
+	float Position3 = WarRigPosition.X;
+	AActor* TileActor3 = Pool->GetFromPool(FVector(Position3, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(TileActor3, "Tile 3 should be created");
+	AGroundTile* Tile3 = Cast<AGroundTile>(TileActor3);
+	bool IsBehind3 = (Tile3->GetActorLocation().X < DespawnThreshold);
+	TEST_FALSE(IsBehind3, "Tile 3 should be ahead of threshold");
+	Pool->ReturnToPool(TileActor3);
+
+	// Verify pool statistics after despawn operations
+	TEST_EQUAL(Pool->GetActiveCount(), 0, "All tiles returned");
+	TEST_EQUAL(Pool->GetAvailableCount(), 5, "All tiles available");
+
+	// Test distance-based despawn with moving war rig
+	AActor* TestTile = Pool->GetFromPool(FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(TestTile, "Test tile should be created");
+
+	// Move war rig forward, making tile fall behind despawn threshold
+	WarRig->SetActorLocation(FVector(3000.0f, 0.0f, 0.0f));
+	float NewDespawnThreshold = 3000.0f - DespawnDistance;
+	float TilePosition = TestTile->GetActorLocation().X;
+
+	// Tile at 1000 should now be behind threshold of 2000
+	TEST_TRUE(TilePosition < NewDespawnThreshold, "Tile should be behind new threshold");
+
+	// Cleanup
+	Pool->ReturnToPool(TestTile);
+	if (WarRig)
+	{
+		WarRig->Destroy();
+	}
+	if (PoolOwner)
+	{
+		PoolOwner->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_TileDespawn");
+}
+
+// Defined with the world scroll tests below
+static UWorldScrollComponent* CreateTestWorldScrollComponent();
+
+/**
+ * Test: Instanced Road Recycling
+ * Verify the instanced road follows the scroll distance, recycles rear instances to the front
+ * of the ring, survives a multi-ring hitch and rebases without moving any instance
+ */
+static bool GroundTileTest_InstancedRoadRecycling()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	AActor* WarRig = CreateTestWarRig(World, FVector::ZeroVector);
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	UWorldScrollComponent* ScrollComponent = CreateTestWorldScrollComponent();
+	TEST_NOT_NULL(ScrollComponent, "Scroll component should be created");
+	ScrollComponent->SetScrollSpeed(1000.0f);
+	ScrollComponent->SetScrollDirection(FVector(-1.0f, 0.0f, 0.0f));
+	ScrollComponent->ResetDistance();
+	ScrollComponent->SetScrolling(true);
+
+	AActor* RoadOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(RoadOwner, "Road owner should be created");
+
+	const float TileSize = 1000.0f;
+	const float DespawnDistance = 2000.0f;
+	UTestGroundTileManager* Manager = NewObject<UTestGroundTileManager>(RoadOwner);
+	Manager->ConfigureRoad(true, false, TileSize, 4000.0f, DespawnDistance);
+	Manager->SetScrollSource(ScrollComponent);
+	Manager->SetTestWarRig(WarRig);
+	Manager->BuildTestInstancedRoad();
+	TEST_NOT_NULL(Manager->GetRoadInstances(), "Instanced road component should be created");
+
+	const int32 NumInstances = Manager->GetActiveTileCount();
+	TEST_TRUE(NumInstances >= 3, "Road should have at least 3 instances");
+	const float StartX = Manager->GetRoadInstanceWorldX(0);
+	const float DespawnThreshold = WarRig->GetActorLocation().X - DespawnDistance;
+
+	// Checks the ring is contiguous, starts right at the despawn threshold, renders where it is tracked and keeps the scroll phase
+	auto CheckRoad = [&](const TCHAR* Stage) -> bool
+	{
+		const float RearX = Manager->GetRoadInstanceWorldX(0);
+		const float ScrolledX = StartX - static_cast<float>(ScrollComponent->GetDistanceTraveled());
+		const float PhaseError = FMath::Abs(FMath::Fmod(RearX - ScrolledX, TileSize));
+		if (RearX < DespawnThreshold - 1.0f || RearX >= DespawnThreshold + TileSize + 1.0f)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GroundTileTest_InstancedRoadRecycling: %s - rear instance at %.1f, threshold %.1f"), Stage, RearX, DespawnThreshold);
+			return false;
+		}
+		if (FMath::Min(PhaseError, TileSize - PhaseError) > 1.0f)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GroundTileTest_InstancedRoadRecycling: %s - road drifted %.2f from the scroll distance"), Stage, PhaseError);
+			return false;
+		}
+		for (int32 i = 0; i < NumInstances; ++i)
+		{
+			const float ExpectedX = RearX + i * TileSize;
+			if (!FMath::IsNearlyEqual(Manager->GetRoadInstanceWorldX(i), ExpectedX, 1.0f)
+				|| !FMath::IsNearlyEqual(Manager->GetRoadInstanceRenderedX(i), ExpectedX, 1.0f))
+			{
+				UE_LOG(LogTemp, Error, TEXT("GroundTileTest_InstancedRoadRecycling: %s - instance %d at %.1f (rendered %.1f), expected %.1f"),
+					Stage, i, Manager->GetRoadInstanceWorldX(i), Manager->GetRoadInstanceRenderedX(i), ExpectedX);
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// Normal frames: the road moves with the scroll distance and rear instances wrap to the front
+	for (int32 Frame = 0; Frame < 120; ++Frame)
+	{
+		ScrollComponent->TickComponent(1.0f / 60.0f, ELevelTick::LEVELTICK_All, nullptr);
+		Manager->StepInstancedRoad();
+	}
+	TEST_TRUE(CheckRoad(TEXT("after 2 seconds")), "Road should stay contiguous while scrolling");
+	TEST_NEARLY_EQUAL(Manager->GetRoadInstances()->GetComponentLocation().X, -ScrollComponent->GetDistanceTraveled(), 1.0f,
+		"Road component should sit at minus the scroll distance");
+	const int32 HeadAfterScroll = Manager->GetRoadRingHead();
+	TEST_TRUE(HeadAfterScroll != 0, "Rear instances should have been recycled to the front");
+
+	// Hitch longer than a whole ring: every instance catches up in one update
+	ScrollComponent->TickComponent(NumInstances * TileSize * 2.5f / 1000.0f, ELevelTick::LEVELTICK_All, nullptr);
+	Manager->StepInstancedRoad();
+	TEST_TRUE(CheckRoad(TEXT("after a multi-ring hitch")), "Road should catch up after a hitch longer than the ring");
+
+	// Past the rebase distance: the component returns to the origin and the instances stay where they were
+	ScrollComponent->TickComponent(1100.0f, ELevelTick::LEVELTICK_All, nullptr);
+	Manager->StepInstancedRoad();
+	TEST_TRUE(FMath::Abs(Manager->GetRoadInstances()->GetComponentLocation().X) < 1.0f, "Road component should be rebased to the origin");
+	TEST_TRUE(CheckRoad(TEXT("after the rebase")), "Road should not move when rebased");
+
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+	{
+		ScrollComponent->TickComponent(1.0f / 60.0f, ELevelTick::LEVELTICK_All, nullptr);
+		Manager->StepInstancedRoad();
+	}
+	TEST_TRUE(CheckRoad(TEXT("after scrolling past the rebase")), "Road should keep recycling after the rebase");
+
+	// Cleanup
+	RoadOwner->Destroy();
+	WarRig->Destroy();
+	if (ScrollComponent->GetOwner())
+	{
+		ScrollComponent->GetOwner()->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_InstancedRoadRecycling");
+}
+
+/**
+ * Test: Analytic Tile Placement
+ * Verify analytic placement recycles and spawns several tiles in one update after a large
+ * scroll step, and that tile seams and the scroll phase do not drift over a long run
+ */
+static bool GroundTileTest_AnalyticPlacement()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	AActor* WarRig = CreateTestWarRig(World, FVector::ZeroVector);
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	UWorldScrollComponent* ScrollComponent = CreateTestWorldScrollComponent();
+	TEST_NOT_NULL(ScrollComponent, "Scroll component should be created");
+	ScrollComponent->SetScrollSpeed(1000.0f);
+	ScrollComponent->SetScrollDirection(FVector(-1.0f, 0.0f, 0.0f));
+	ScrollComponent->ResetDistance();
+	ScrollComponent->SetScrolling(true);
+
+	AActor* RoadOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(RoadOwner, "Road owner should be created");
+
+	const float TileSize = 1000.0f;
+	const float SpawnDistance = 4000.0f;
+	const float DespawnDistance = 2000.0f;
+	UTestGroundTileManager* Manager = NewObject<UTestGroundTileManager>(RoadOwner);
+	Manager->ConfigureRoad(false, true, TileSize, SpawnDistance, DespawnDistance);
+	Manager->SetScrollSource(ScrollComponent);
+	Manager->SetTestWarRig(WarRig);
+	TEST_TRUE(Manager->InitializeTestTilePool(), "Tile pool should initialize");
+
+	// First update anchors road index 0 at the despawn threshold
+	Manager->StepAnalyticTiles();
+	const int32 NumTiles = Manager->GetActiveTileCount();
+	TEST_TRUE(NumTiles > 0, "Analytic placement should fill the road on the first update");
+
+	const float WarRigX = WarRig->GetActorLocation().X;
+	const float AnchorX = WarRigX - DespawnDistance;
+
+	// Checks the road covers despawn..spawn threshold, every seam is exactly one tile and the phase follows the scroll distance
+	auto CheckRoad = [&](const TCHAR* Stage) -> bool
+	{
+		const int32 Count = Manager->GetActiveTileCount();
+		const float RearX = Manager->GetTileWorldX(0);
+		const float FrontX = Manager->GetTileWorldX(Count - 1);
+		if (Count != NumTiles || RearX < AnchorX - 0.5f || RearX >= AnchorX + TileSize || FrontX < WarRigX + SpawnDistance - 0.5f)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GroundTileTest_AnalyticPlacement: %s - %d tiles from %.1f to %.1f"), Stage, Count, RearX, FrontX);
+			return false;
+		}
+
+		const double ScrolledX = static_cast<double>(AnchorX) - ScrollComponent->GetDistanceTraveled();
+		const double Phase = FMath::Abs(FMath::Fmod(static_cast<double>(RearX) - ScrolledX, static_cast<double>(TileSize)));
+		if (FMath::Min(Phase, TileSize - Phase) > 0.5)
+		{
+			UE_LOG(LogTemp, Error, TEXT("GroundTileTest_AnalyticPlacement: %s - road drifted %.3f from the scroll distance"), Stage, Phase);
+			return false;
+		}
+
+		for (int32 i = 1; i < Count; ++i)
+		{
+			const float Seam = Manager->GetTileWorldX(i) - Manager->GetTileWorldX(i - 1);
+			if (!FMath::IsNearlyEqual(Seam, TileSize, 0.01f))
+			{
+				UE_LOG(LogTemp, Error, TEXT("GroundTileTest_AnalyticPlacement: %s - seam %d is %.3f long"), Stage, i, Seam);
+				return false;
+			}
+		}
+		return true;
+	};
+
+	TEST_TRUE(CheckRoad(TEXT("after anchoring")), "Road should cover the visible range after anchoring");
+
+	// One frame scrolling 3.5 tiles: several tiles recycle to the front in the same update
+	ScrollComponent->TickComponent(3.5f, ELevelTick::LEVELTICK_All, nullptr);
+	Manager->StepAnalyticTiles();
+	TEST_TRUE(CheckRoad(TEXT("after a 3.5 tile step")), "Road should catch up several tiles in one update");
+
+	// One frame scrolling further than the whole road: the ring is relabelled, not left behind
+	ScrollComponent->TickComponent(NumTiles * 3.0f + 0.25f, ELevelTick::LEVELTICK_All, nullptr);
+	Manager->StepAnalyticTiles();
+	TEST_TRUE(CheckRoad(TEXT("after a step longer than the road")), "Road should catch up after a step longer than the road");
+
+	// Long run with uneven frame times: per-frame placement never accumulates seam or phase error
+	ScrollComponent->SetScrollSpeed(5000.0f);
+	const float FrameTimes[] = { 0.1f, 0.0371f, 0.0167f, 0.0833f };
+	for (int32 Frame = 0; Frame < 2000; ++Frame)
+	{
+		ScrollComponent->TickComponent(FrameTimes[Frame % UE_ARRAY_COUNT(FrameTimes)], ELevelTick::LEVELTICK_All, nullptr);
+		Manager->StepAnalyticTiles();
+	}
+	TEST_TRUE(ScrollComponent->GetDistanceTraveled() > 500000.0f, "Long run should cover a long distance");
+	TEST_TRUE(CheckRoad(TEXT("after a long run")), "Seams and phase should not drift over a long distance");
+
+	// Far down the road (minutes at top speed) small per-frame steps still count: a float distance would drop them
+	ScrollComponent->SetScrollSpeed(100000.0f);
+	ScrollComponent->TickComponent(200.0f, ELevelTick::LEVELTICK_All, nullptr);
+	Manager->StepAnalyticTiles();
+	TEST_TRUE(ScrollComponent->GetDistanceTraveled() > 2.0e7, "Run should reach float-unsafe distances");
+	ScrollComponent->SetScrollSpeed(1000.0f);
+	const double FarDistance = ScrollComponent->GetDistanceTraveled();
+	double ExpectedSteps = 0.0;
+	for (int32 Frame = 0; Frame < 1000; ++Frame)
+	{
+		const float FrameTime = FrameTimes[Frame % UE_ARRAY_COUNT(FrameTimes)] * 0.01f;
+		ExpectedSteps += 1000.0 * FrameTime;
+		ScrollComponent->TickComponent(FrameTime, ELevelTick::LEVELTICK_All, nullptr);
+		Manager->StepAnalyticTiles();
+	}
+	TEST_NEARLY_EQUAL(ScrollComponent->GetDistanceTraveled() - FarDistance, ExpectedSteps, 0.01,
+		"Sub-unit steps should accumulate exactly far down the road");
+	TEST_TRUE(CheckRoad(TEXT("after small steps far down the road")), "Placement should follow the exact distance far down the road");
+
+	// Cleanup
+	Manager->ReleaseTestTiles();
+	RoadOwner->Destroy();
+	WarRig->Destroy();
+	if (ScrollComponent->GetOwner())
+	{
+		ScrollComponent->GetOwner()->Destroy();
+	}
+
+	TEST_SUCCESS("GroundTileTest_AnalyticPlacement");
+}
+
+// ============================================================================
+// TURRET TEST HELPERS
+// ============================================================================
+
+// Helper function to create a test war rig
+static AWarRigPawn* CreateTestWarRig()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AWarRigPawn* WarRig = World->SpawnActor<AWarRigPawn>();
+	if (WarRig)
+	{
+		WarRig->SetActorLocation(FVector::ZeroVector);
+	}
+	return WarRig;
+}
+
+// Helper function to create a test turret
+static ATestTurret* CreateTestTurret()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// Spawn test turret at origin (using concrete ATestTurret class instead of abstract ATurretBase)
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ATestTurret* Turret = World->SpawnActor<ATestTurret>(ATestTurret::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	return Turret;
+}
+
+// Helper function to create test turret data
+static FTurretData CreateTestTurretData()
+{
+	FTurretData Data;
+	Data.TurretName = TEXT("TestTurret");
+	Data.DisplayName = FText::FromString(TEXT("Test Turret"));
+	Data.Description = FText::FromString(TEXT("A test turret for unit testing"));
+	Data.BaseDamage = 25.0f;
+	Data.FireRate = 2.0f;
+	Data.Range = 1500.0f;
+	Data.BaseHealth = 150.0f;
+	Data.BuildCost = 100;
+	Data.UpgradeCost = 50;
+	return Data;
+}
+
+// ============================================================================
+// TURRET TESTS
+// ============================================================================
+
+/**
+ * Test: Turret Spawn
+ * Verify that turret spawns at mount point correctly with all components
+ */
+static bool TurretTest_TurretSpawn()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	// Verify components exist
+	TEST_NOT_NULL(Turret->GetAbilitySystemComponent(), "AbilitySystemComponent should exist");
+	TEST_NOT_NULL(Turret->GetCombatAttributeSet(), "CombatAttributeSet should exist");
+	TEST_NOT_NULL(Turret->GetRootComponent(), "Root component should exist");
+
+	// Verify initial state
+	TEST_EQUAL(Turret->GetMountIndex(), -1, "Mount index should be -1 (uninitialized)");
+	TEST_NULL(Turret->GetOwnerWarRig(), "Owner war rig should be null (not initialized)");
+	TEST_NULL(Turret->GetCurrentTarget(), "Current target should be null");
+
+	// Cleanup
+	if (Turret)
+	{
+		Turret->Destroy();
+	}
+
+	TEST_SUCCESS("TurretTest_TurretSpawn");
+}
+
+/**
+ * Test: Target Acquisition
+ * Verify turret finds targets within range and firing arc
+ */
+static bool TurretTest_TargetAcquisition()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	// Initialize turret
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	FTurretData TurretData = CreateTestTurretData();
+	FRotator FacingDirection = FRotator(0.0f, 0.0f, 0.0f); // Facing forward (X-axis)
+	Turret->Initialize(TurretData, 0, FacingDirection, WarRig);
+
+	// Verify attributes initialized correctly
+	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
+	TEST_NOT_NULL(Attributes, "Attributes should exist after initialization");
+	TEST_NEARLY_EQUAL(Attributes->GetRange(), TurretData.Range, 0.1f, "Range should match data table");
+
+	// Create a test target (enemy pawn) within range and arc
+	FVector TargetLocationInRange = Turret->GetActorLocation() + FVector(500.0f, 0.0f, 0.0f); // 500 units ahead
+	AActor* TargetInRange = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationInRange, FRotator::ZeroRotator);
+	TEST_NOT_NULL(TargetInRange, "Target in range should be created");
+
+	// Verify target is in firing arc
+	bool bIsInArc = Turret->IsTargetInFiringArc(TargetLocationInRange);
+	TEST_TRUE(bIsInArc, "Target should be within 180° firing arc");
+
+	// Create a test target outside range
+	FVector TargetLocationOutOfRange = Turret->GetActorLocation() + FVector(3000.0f, 0.0f, 0.0f); // 3000 units ahead (beyond range)
+	AActor* TargetOutOfRange = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationOutOfRange, FRotator::ZeroRotator);
+	TEST_NOT_NULL(TargetOutOfRange, "Target out of range should be created");
+
+	// Create a target behind turret (outside arc)
+	FVector TargetLocationBehind = Turret->GetActorLocation() + FVector(-500.0f, 0.0f, 0.0f); // 500 units behind
+	AActor* TargetBehind = World->SpawnActor<AActor>(AActor::StaticClass(), TargetLocationBehind, FRotator::ZeroRotator);
+	TEST_NOT_NULL(TargetBehind, "Target behind should be created");
+
+	// Verify target behind is not in arc
+	bool bIsBehindInArc = Turret->IsTargetInFiringArc(TargetLocationBehind);
+	TEST_FALSE(bIsBehindInArc, "Target behind should not be in firing arc");
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+	if (TargetInRange) TargetInRange->Destroy();
+	if (TargetOutOfRange) TargetOutOfRange->Destroy();
+	if (TargetBehind) TargetBehind->Destroy();
 
 	TEST_SUCCESS("TurretTest_TargetAcquisition");
 }
 
 /**
- * Test: Firing Arc Calculation
- * Verify 180° arc math is correct using dot product
+ * Test: Firing Arc Calculation
+ * Verify 180° arc math is correct using dot product
+ */
+static bool TurretTest_FiringArcCalculation()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	// Set turret facing forward (0°)
+	FRotator FacingDirection = FRotator(0.0f, 0.0f, 0.0f); // Facing +X
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	FTurretData TurretData = CreateTestTurretData();
+	Turret->Initialize(TurretData, 0, FacingDirection, WarRig);
+
+	FVector TurretLocation = Turret->GetActorLocation();
+
+	// Test 1: Target directly ahead (0°) - should be in arc (dot = 1.0)
+	FVector TargetAhead = TurretLocation + FVector(100.0f, 0.0f, 0.0f);
+	TEST_TRUE(Turret->IsTargetInFiringArc(TargetAhead), "Target directly ahead should be in arc");
+
+	// Test 2: Target at 45° (forward-right) - should be in arc (dot > 0)
+	FVector Target45Degrees = TurretLocation + FVector(100.0f, 100.0f, 0.0f);
+	TEST_TRUE(Turret->IsTargetInFiringArc(Target45Degrees), "Target at 45° should be in arc");
+
+	// Test 3: Target at 90° (perpendicular right) - should be at edge of arc (dot ≈ 0)
+	FVector Target90Degrees = TurretLocation + FVector(0.0f, 100.0f, 0.0f);
+	// This is the edge case - dot product will be very close to 0
+	// It should still be in arc since we use > 0.0, but edge case
+	bool bAt90 = Turret->IsTargetInFiringArc(Target90Degrees);
+	// At exactly 90°, dot product is 0, which is NOT > 0, so it should be false
+	TEST_FALSE(bAt90, "Target at exactly 90° should be at arc edge (not in arc)");
+
+	// Test 4: Target at -45° (forward-left) - should be in arc (dot > 0)
+	FVector TargetNeg45Degrees = TurretLocation + FVector(100.0f, -100.0f, 0.0f);
+	TEST_TRUE(Turret->IsTargetInFiringArc(TargetNeg45Degrees), "Target at -45° should be in arc");
+
+	// Test 5: Target at -90° (perpendicular left) - should be at edge of arc (dot ≈ 0)
+	FVector TargetNeg90Degrees = TurretLocation + FVector(0.0f, -100.0f, 0.0f);
+	bool bAtNeg90 = Turret->IsTargetInFiringArc(TargetNeg90Degrees);
+	TEST_FALSE(bAtNeg90, "Target at exactly -90° should be at arc edge (not in arc)");
+
+	// Test 6: Target at 135° (back-right) - should NOT be in arc (dot < 0)
+	FVector Target135Degrees = TurretLocation + FVector(-100.0f, 100.0f, 0.0f);
+	TEST_FALSE(Turret->IsTargetInFiringArc(Target135Degrees), "Target at 135° should not be in arc");
+
+	// Test 7: Target directly behind (180°) - should NOT be in arc (dot = -1.0)
+	FVector TargetBehind = TurretLocation + FVector(-100.0f, 0.0f, 0.0f);
+	TEST_FALSE(Turret->IsTargetInFiringArc(TargetBehind), "Target directly behind should not be in arc");
+
+	// Test 8: Target at -135° (back-left) - should NOT be in arc (dot < 0)
+	FVector TargetNeg135Degrees = TurretLocation + FVector(-100.0f, -100.0f, 0.0f);
+	TEST_FALSE(Turret->IsTargetInFiringArc(TargetNeg135Degrees), "Target at -135° should not be in arc");
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+
+	TEST_SUCCESS("TurretTest_FiringArcCalculation");
+}
+
+/**
+ * Test: Attribute Initialization
+ * Verify stats load correctly from data table
+ */
+static bool TurretTest_AttributeInitialization()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	// Create test data
+	FTurretData TurretData = CreateTestTurretData();
+	TurretData.BaseDamage = 42.0f;
+	TurretData.FireRate = 3.5f;
+	TurretData.Range = 2000.0f;
+	TurretData.BaseHealth = 250.0f;
+
+	// Initialize turret
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	FRotator FacingDirection = FRotator(0.0f, 90.0f, 0.0f); // Facing right
+	Turret->Initialize(TurretData, 5, FacingDirection, WarRig);
+
+	// Verify attributes match data table
+	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
+	TEST_NOT_NULL(Attributes, "Attributes should exist");
+
+	TEST_NEARLY_EQUAL(Attributes->GetHealth(), TurretData.BaseHealth, 0.1f, "Health should match data table");
+	TEST_NEARLY_EQUAL(Attributes->GetMaxHealth(), TurretData.BaseHealth, 0.1f, "MaxHealth should match data table");
+	TEST_NEARLY_EQUAL(Attributes->GetDamage(), TurretData.BaseDamage, 0.1f, "Damage should match data table");
+	TEST_NEARLY_EQUAL(Attributes->GetFireRate(), TurretData.FireRate, 0.1f, "FireRate should match data table");
+	TEST_NEARLY_EQUAL(Attributes->GetRange(), TurretData.Range, 0.1f, "Range should match data table");
+
+	// Verify turret properties
+	TEST_EQUAL(Turret->GetMountIndex(), 5, "Mount index should be set correctly");
+	TEST_EQUAL(Turret->GetOwnerWarRig(), WarRig, "Owner war rig should be set correctly");
+
+	// Verify facing direction (check yaw)
+	FRotator ActualFacing = Turret->GetFacingDirection();
+	TEST_NEARLY_EQUAL(ActualFacing.Yaw, FacingDirection.Yaw, 0.1f, "Facing direction should match");
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+
+	TEST_SUCCESS("TurretTest_AttributeInitialization");
+}
+
+/**
+ * Test: Null Target Handling
+ * Verify graceful handling when no targets are available
  */
-static bool TurretTest_FiringArcCalculation()
+static bool TurretTest_NullTargetHandling()
 {
 	ATurretBase* Turret = CreateTestTurret();
 	TEST_NOT_NULL(Turret, "Turret should be created");
 
-	// Set turret facing forward (0°)
-	FRotator FacingDirection = FRotator(0.0f, 0.0f, 0.0f); // Facing +X
+	// Initialize turret
 	AWarRigPawn* WarRig = CreateTestWarRig();
 	FTurretData TurretData = CreateTestTurretData();
-	Turret->Initialize(TurretData, 0, FacingDirection, WarRig);
+	Turret->Initialize(TurretData, 0, FRotator::ZeroRotator, WarRig);
 
-	FVector TurretLocation = Turret->GetActorLocation();
+	// Try to find a target (should return nullptr since no enemies exist)
+	AActor* Target = Turret->FindTarget();
+	TEST_NULL(Target, "FindTarget should return null when no targets available");
 
-	// Test 1: Target directly ahead (0°) - should be in arc (dot = 1.0)
-	FVector TargetAhead = TurretLocation + FVector(100.0f, 0.0f, 0.0f);
-	TEST_TRUE(Turret->IsTargetInFiringArc(TargetAhead), "Target directly ahead should be in arc");
+	// Verify current target is null
+	TEST_NULL(Turret->GetCurrentTarget(), "Current target should be null");
 
-	// Test 2: Target at 45° (forward-right) - should be in arc (dot > 0)
-	FVector Target45Degrees = TurretLocation + FVector(100.0f, 100.0f, 0.0f);
-	TEST_TRUE(Turret->IsTargetInFiringArc(Target45Degrees), "Target at 45° should be in arc");
+	// Try to fire with null target (should handle gracefully without crashing)
+	Turret->Fire(); // Should not crash or throw error
 
-	// Test 3: Target at 90° (perpendicular right) - should be at edge of arc (dot ≈ 0)
-	FVector Target90Degrees = TurretLocation + FVector(0.0f, 100.0f, 0.0f);
-	// This is the edge case - dot product will be very close to 0
-	// It should still be in arc since we use > 0.0, but edge case
-	bool bAt90 = Turret->IsTargetInFiringArc(Target90Degrees);
-	// At exactly 90°, dot product is 0, which is NOT > 0, so it should be false
-	TEST_FALSE(bAt90, "Target at exactly 90° should be at arc edge (not in arc)");
+	// Verify turret is still valid after attempting to fire with null target
+	TEST_TRUE(IsValid(Turret), "Turret should still be valid after firing with null target");
 
-	// Test 4: Target at -45° (forward-left) - should be in arc (dot > 0)
-	FVector TargetNeg45Degrees = TurretLocation + FVector(100.0f, -100.0f, 0.0f);
-	TEST_TRUE(Turret->IsTargetInFiringArc(TargetNeg45Degrees), "Target at -45° should be in arc");
+	// Test IsTargetInFiringArc with null target's location (edge case)
+	// This tests that the function handles invalid input gracefully
+	FVector InvalidLocation = FVector::ZeroVector;
+	bool bResult = Turret->IsTargetInFiringArc(InvalidLocation);
+	// Should not crash (result doesn't matter as much as not crashing)
 
-	// Test 5: Target at -90° (perpendicular left) - should be at edge of arc (dot ≈ 0)
-	FVector TargetNeg90Degrees = TurretLocation + FVector(0.0f, -100.0f, 0.0f);
-	bool bAtNeg90 = Turret->IsTargetInFiringArc(TargetNeg90Degrees);
-	TEST_FALSE(bAtNeg90, "Target at exactly -90° should be at arc edge (not in arc)");
+	// Cleanup
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+
+	TEST_SUCCESS("TurretTest_NullTargetHandling");
+}
+
+/**
+ * Test: Attribute Clamping
+ * Verify that health is clamped to [0, MaxHealth] range
+ */
+static bool TurretTest_AttributeClamping()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
+	TEST_NOT_NULL(Attributes, "Attributes should exist");
+
+	// Initialize with known values
+	float MaxHealth = 100.0f;
+	Attributes->InitMaxHealth(MaxHealth);
+	Attributes->InitHealth(MaxHealth);
+
+	// Verify initial values
+	TEST_NEARLY_EQUAL(Attributes->GetHealth(), MaxHealth, 0.1f, "Health should be at max");
+
+	// Try to set health above max (should be clamped)
+	Attributes->SetHealth(150.0f);
+	TEST_NEARLY_EQUAL(Attributes->GetHealth(), MaxHealth, 0.1f, "Health should be clamped to MaxHealth");
+
+	// Try to set health below zero (should be clamped)
+	Attributes->SetHealth(-50.0f);
+	TEST_NEARLY_EQUAL(Attributes->GetHealth(), 0.0f, 0.1f, "Health should be clamped to 0");
+
+	// Set health to valid value
+	Attributes->SetHealth(50.0f);
+	TEST_NEARLY_EQUAL(Attributes->GetHealth(), 50.0f, 0.1f, "Health should be set to 50");
+
+	// Change MaxHealth to lower value - health should be re-clamped
+	Attributes->SetMaxHealth(40.0f);
+	// Note: This requires PostGameplayEffectExecute to handle properly
+	// For now, just verify MaxHealth changed
+	TEST_NEARLY_EQUAL(Attributes->GetMaxHealth(), 40.0f, 0.1f, "MaxHealth should be updated");
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+
+	TEST_SUCCESS("TurretTest_AttributeClamping");
+}
+
+/**
+ * Test: Mount Point Integration
+ * Verify turret correctly stores and retrieves mount point information
+ */
+static bool TurretTest_MountPointIntegration()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+
+	FTurretData TurretData = CreateTestTurretData();
+
+	// Test different mount indices
+	for (int32 MountIdx = 0; MountIdx < 10; ++MountIdx)
+	{
+		FRotator FacingDirection = FRotator(0.0f, MountIdx * 45.0f, 0.0f); // Different facing for each mount
+		Turret->Initialize(TurretData, MountIdx, FacingDirection, WarRig);
+
+		TEST_EQUAL(Turret->GetMountIndex(), MountIdx, "Mount index should match initialization value");
+		TEST_NEARLY_EQUAL(Turret->GetFacingDirection().Yaw, FacingDirection.Yaw, 0.1f, "Facing direction should match");
+		TEST_EQUAL(Turret->GetOwnerWarRig(), WarRig, "Owner war rig should be consistent");
+	}
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+
+	TEST_SUCCESS("TurretTest_MountPointIntegration");
+}
+
+/**
+ * Test: Ability System Component Integration
+ * Verify ASC is properly integrated and accessible
+ */
+static bool TurretTest_AbilitySystemIntegration()
+{
+	ATurretBase* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+
+	// Verify ASC exists
+	UAbilitySystemComponent* ASC = Turret->GetAbilitySystemComponent();
+	TEST_NOT_NULL(ASC, "AbilitySystemComponent should exist");
+
+	// Verify attribute set is added to ASC
+	const TArray<UAttributeSet*>& AttributeSets = ASC->GetSpawnedAttributes();
+	TEST_TRUE(AttributeSets.Num() > 0, "ASC should have at least one attribute set");
+
+	// Verify CombatAttributeSet is present
+	bool bHasCombatAttributes = false;
+	for (UAttributeSet* AttrSet : AttributeSets)
+	{
+		if (Cast<UCombatAttributeSet>(AttrSet))
+		{
+			bHasCombatAttributes = true;
+			break;
+		}
+	}
+	TEST_TRUE(bHasCombatAttributes, "ASC should have CombatAttributeSet");
+
+	// Verify ASC replication is enabled
+	TEST_TRUE(ASC->GetIsReplicated(), "ASC should be replicated");
+
+	// Cleanup
+	if (Turret) Turret->Destroy();
+
+	TEST_SUCCESS("TurretTest_AbilitySystemIntegration");
+}
+
+/**
+ * Test: Shared Targeting
+ * Verify every registered turret resolves its target from one shared candidate query
+ */
+static bool TurretTest_SharedTargeting()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(World);
+	TEST_NOT_NULL(Targeting, "World should provide the turret targeting subsystem");
+
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	FTurretData TurretData = CreateTestTurretData();
+
+	// Two turrets facing +X, the second one ahead of the target
+	ATurretBase* RearTurret = CreateTestTurret();
+	ATurretBase* FrontTurret = CreateTestTurret();
+	TEST_NOT_NULL(RearTurret, "Rear turret should be created");
+	TEST_NOT_NULL(FrontTurret, "Front turret should be created");
+	FrontTurret->SetActorLocation(FVector(1000.0f, 0.0f, 0.0f));
+	RearTurret->Initialize(TurretData, 0, FRotator::ZeroRotator, WarRig);
+	FrontTurret->Initialize(TurretData, 1, FRotator::ZeroRotator, WarRig);
+
+	TEST_TRUE(Targeting->IsTurretRegistered(RearTurret), "Turrets should register when mounted");
+	TEST_TRUE(Targeting->IsTurretRegistered(FrontTurret), "Turrets should register when mounted");
+
+	// A pawn between the turrets: ahead of the rear turret, behind the front one
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Target, "Target pawn should be created");
+
+	Targeting->InvalidateCandidates();
+	const int32 QueriesBefore = Targeting->GetQueryCount();
+
+	TEST_EQUAL(RearTurret->FindTarget(), static_cast<AActor*>(Target), "Rear turret should acquire the target ahead of it");
+	TEST_NULL(FrontTurret->FindTarget(), "Front turret should ignore the target behind it");
+	TEST_EQUAL(Targeting->GetQueryCount() - QueriesBefore, 1, "Both turrets should share a single candidate query");
+
+	// Unregistered turrets drop out of the shared query
+	FrontTurret->Destroy();
+	TEST_FALSE(Targeting->IsTurretRegistered(FrontTurret), "Destroyed turret should unregister");
+
+	// Cleanup
+	if (RearTurret) RearTurret->Destroy();
+	if (WarRig) WarRig->Destroy();
+	if (Target) Target->Destroy();
+
+	TEST_SUCCESS("TurretTest_SharedTargeting");
+}
+
+/**
+ * Test: Target Stickiness
+ * Verify turrets keep valid targets, respect the per-frame re-acquisition budget and report target quality
+ */
+static bool TurretTest_TargetStickiness()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(World);
+	TEST_NOT_NULL(Targeting, "World should provide the turret targeting subsystem");
+
+	const int32 OriginalBudget = Targeting->GetReacquisitionBudget();
+	Targeting->SetReacquisitionBudget(1);
+	Targeting->ResetStats();
+
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	FTurretData TurretData = CreateTestTurretData();
+	ATurretBase* FirstTurret = CreateTestTurret();
+	ATurretBase* SecondTurret = CreateTestTurret();
+	TEST_NOT_NULL(FirstTurret, "First turret should be created");
+	TEST_NOT_NULL(SecondTurret, "Second turret should be created");
+	FirstTurret->Initialize(TurretData, 0, FRotator::ZeroRotator, WarRig);
+	SecondTurret->Initialize(TurretData, 1, FRotator::ZeroRotator, WarRig);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* FarTarget = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), FVector(800.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(FarTarget, "Far target should be created");
+
+	// Mount 0 re-evaluates immediately and spends the frame's only selection
+	FirstTurret->Tick(0.01f);
+	TEST_EQUAL(FirstTurret->GetCurrentTarget(), static_cast<AActor*>(FarTarget), "First turret should acquire the only target");
+	TEST_EQUAL(Targeting->GetStats().Reacquisitions, 1, "One selection should have run");
+
+	// Mount 1 is due as well but the budget is spent this frame
+	SecondTurret->Tick(1.0f);
+	TEST_NULL(SecondTurret->GetCurrentTarget(), "Second turret should wait for budget");
+	TEST_EQUAL(Targeting->GetStats().DeferredReacquisitions, 1, "Over-budget selection should be deferred");
+
+	// A closer target appears; the first turret keeps its target until re-evaluation and sampling records the cost
+	ADefaultPawn* NearTarget = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), FVector(300.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(NearTarget, "Near target should be created");
+	Targeting->InvalidateCandidates();
+	Targeting->SetQualitySampling(true);
+
+	FirstTurret->Tick(0.01f);
+	TEST_EQUAL(FirstTurret->GetCurrentTarget(), static_cast<AActor*>(FarTarget), "Valid target should be kept between re-evaluations");
+	TEST_EQUAL(Targeting->GetStats().QualitySamples, 1, "Kept target should be sampled");
+	TEST_EQUAL(Targeting->GetStats().SuboptimalSamples, 1, "Sample should report the closer target");
+	TEST_NEARLY_EQUAL(Targeting->GetStats().TotalExtraDistance, 500.0f, 1.0f, "Extra distance should be the gap between the targets");
+
+	// Once the interval expires the closer target is picked
+	Targeting->SetReacquisitionBudget(0);
+	FirstTurret->Tick(1.0f);
+	TEST_EQUAL(FirstTurret->GetCurrentTarget(), static_cast<AActor*>(NearTarget), "Re-evaluation should switch to the closer target");
+
+	// A lost target is replaced on the same tick
+	NearTarget->Destroy();
+	FirstTurret->Tick(0.01f);
+	TEST_EQUAL(FirstTurret->GetCurrentTarget(), static_cast<AActor*>(FarTarget), "Lost target should be replaced immediately");
+
+	// Cleanup
+	Targeting->SetQualitySampling(false);
+	Targeting->SetReacquisitionBudget(OriginalBudget);
+	if (FirstTurret) FirstTurret->Destroy();
+	if (SecondTurret) SecondTurret->Destroy();
+	if (WarRig) WarRig->Destroy();
+	if (FarTarget) FarTarget->Destroy();
+
+	TEST_SUCCESS("TurretTest_TargetStickiness");
+}
+
+/**
+ * Test: Targeting Kernel
+ * Verify the SIMD arc/range kernel matches the scalar reference and benchmark it against the per-candidate path
+ */
+static bool TurretTest_TargetingKernel()
+{
+	const FVector3f Origin(0.0f, 0.0f, 0.0f);
+	const FVector3f Forward(1.0f, 0.0f, 0.0f);
+	const float Range = 1500.0f;
+	const float RangeSquared = Range * Range;
+
+	// Hand-placed candidates: behind, out of range, perpendicular (edge of arc), then two valid ones
+	{
+		const float X[] = { -100.0f, 2000.0f, 0.0f, 900.0f, 400.0f, 400.0f };
+		const float Y[] = { 0.0f, 0.0f, 100.0f, 0.0f, 0.0f, 0.0f };
+		const float Z[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+		float DistanceSquared = 0.0f;
+		TEST_EQUAL(FTurretTargetingKernel::FindClosest(X, Y, Z, 6, Origin, Forward, RangeSquared, &DistanceSquared), 4, "Closest in-arc candidate should win (first of equal distances)");
+		TEST_NEARLY_EQUAL(DistanceSquared, 160000.0f, 1.0f, "Squared distance should be reported");
+		TEST_EQUAL(FTurretTargetingKernel::FindClosest(X, Y, Z, 3, Origin, Forward, RangeSquared), INDEX_NONE, "No valid candidate should return INDEX_NONE");
+		TEST_EQUAL(FTurretTargetingKernel::FindClosest(X, Y, Z, 0, Origin, Forward, RangeSquared), INDEX_NONE, "Empty input should return INDEX_NONE");
+	}
+
+	// Random candidate sets of every remainder size match the scalar reference
+	FRandomStream Random(1234);
+	TArray<float> X, Y, Z;
+	for (int32 Num = 1; Num <= 67; Num += 3)
+	{
+		X.SetNum(Num);
+		Y.SetNum(Num);
+		Z.SetNum(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			X[i] = Random.FRandRange(-3000.0f, 3000.0f);
+			Y[i] = Random.FRandRange(-3000.0f, 3000.0f);
+			Z[i] = Random.FRandRange(-200.0f, 200.0f);
+		}
+
+		const int32 SimdIndex = FTurretTargetingKernel::FindClosest(X.GetData(), Y.GetData(), Z.GetData(), Num, Origin, Forward, RangeSquared);
+		const int32 ScalarIndex = FTurretTargetingKernel::FindClosestScalar(X.GetData(), Y.GetData(), Z.GetData(), Num, Origin, Forward, RangeSquared);
+		TEST_EQUAL(SimdIndex, ScalarIndex, "SIMD kernel should match the scalar reference");
+	}
+
+	// Micro-benchmark: per-candidate normalize + Dist (previous FindTarget path) vs scalar vs SIMD kernel
+	const int32 NumCandidates = 256;
+	const int32 Iterations = 2000;
+	TArray<FVector> Locations;
+	X.SetNum(NumCandidates);
+	Y.SetNum(NumCandidates);
+	Z.SetNum(NumCandidates);
+	Locations.SetNum(NumCandidates);
+	for (int32 i = 0; i < NumCandidates; ++i)
+	{
+		X[i] = Random.FRandRange(-3000.0f, 3000.0f);
+		Y[i] = Random.FRandRange(-3000.0f, 3000.0f);
+		Z[i] = Random.FRandRange(-200.0f, 200.0f);
+		Locations[i] = FVector(X[i], Y[i], Z[i]);
+	}
+
+	int32 Checksum = 0;
+	const double PerCandidateStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		int32 BestIndex = INDEX_NONE;
+		float ClosestDistance = FLT_MAX;
+		for (int32 i = 0; i < NumCandidates; ++i)
+		{
+			const FVector ToTarget = (Locations[i] - FVector(Origin)).GetSafeNormal();
+			if (FVector::DotProduct(FVector(Forward), ToTarget) <= 0.0f)
+			{
+				continue;
+			}
+
+			const float Distance = FVector::Dist(FVector(Origin), Locations[i]);
+			if (Distance <= Range && Distance < ClosestDistance)
+			{
+				ClosestDistance = Distance;
+				BestIndex = i;
+			}
+		}
+		Checksum += BestIndex;
+	}
+	const double PerCandidateSeconds = FPlatformTime::Seconds() - PerCandidateStart;
+
+	const double ScalarStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Checksum += FTurretTargetingKernel::FindClosestScalar(X.GetData(), Y.GetData(), Z.GetData(), NumCandidates, Origin, Forward, RangeSquared);
+	}
+	const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+	const double SimdStart = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Checksum += FTurretTargetingKernel::FindClosest(X.GetData(), Y.GetData(), Z.GetData(), NumCandidates, Origin, Forward, RangeSquared);
+	}
+	const double SimdSeconds = FPlatformTime::Seconds() - SimdStart;
+
+	UE_LOG(LogTemp, Log, TEXT("TurretTest_TargetingKernel: %d candidates x %d: per-candidate %.3f ms, scalar %.3f ms, SIMD %.3f ms (%.1fx vs per-candidate, checksum %d)"),
+		NumCandidates, Iterations,
+		PerCandidateSeconds * 1000.0, ScalarSeconds * 1000.0, SimdSeconds * 1000.0,
+		SimdSeconds > 0.0 ? PerCandidateSeconds / SimdSeconds : 0.0, Checksum);
+
+	TEST_SUCCESS("TurretTest_TargetingKernel");
+}
+
+/**
+ * Test: Projectile System
+ * Verify batched projectiles move, expire, hit pawns in their path and respect the projectile limit
+ */
+static bool TurretTest_ProjectileSystem()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
 
-	// Test 6: Target at 135° (back-right) - should NOT be in arc (dot < 0)
-	FVector Target135Degrees = TurretLocation + FVector(-100.0f, 100.0f, 0.0f);
-	TEST_FALSE(Turret->IsTargetInFiringArc(Target135Degrees), "Target at 135° should not be in arc");
+	UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(World);
+	TEST_NOT_NULL(Projectiles, "World should provide the projectile subsystem");
+	Projectiles->ClearProjectiles();
 
-	// Test 7: Target directly behind (180°) - should NOT be in arc (dot = -1.0)
-	FVector TargetBehind = TurretLocation + FVector(-100.0f, 0.0f, 0.0f);
-	TEST_FALSE(Turret->IsTargetInFiringArc(TargetBehind), "Target directly behind should not be in arc");
+	// Well away from the level's own pawns
+	const FVector TestOrigin(0.0f, 20000.0f, 5000.0f);
 
-	// Test 8: Target at -135° (back-left) - should NOT be in arc (dot < 0)
-	FVector TargetNeg135Degrees = TurretLocation + FVector(-100.0f, -100.0f, 0.0f);
-	TEST_FALSE(Turret->IsTargetInFiringArc(TargetNeg135Degrees), "Target at -135° should not be in arc");
+	// A volley that hits nothing expires after its lifetime
+	FProjectileSpawnParams MissParams;
+	MissParams.Origin = TestOrigin;
+	MissParams.Direction = FVector(0.0f, 1.0f, 0.0f);
+	MissParams.Speed = 1000.0f;
+	MissParams.Lifetime = 0.5f;
+	for (int32 i = 0; i < 100; ++i)
+	{
+		TEST_TRUE(Projectiles->FireProjectile(MissParams), "Projectile should launch");
+	}
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 100, "Every projectile should be in flight");
+
+	Projectiles->TickProjectiles(0.25f);
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 100, "Projectiles should survive within their lifetime");
+	Projectiles->TickProjectiles(0.3f);
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 0, "Projectiles should expire after their lifetime");
+
+	// A round fired at a pawn hits it on the frame its segment reaches it
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), TestOrigin + FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Target, "Target pawn should be created");
+
+	const int32 HitsBefore = Projectiles->GetHitCount();
+	FProjectileSpawnParams HitParams;
+	HitParams.Origin = TestOrigin;
+	HitParams.Direction = FVector(1.0f, 0.0f, 0.0f);
+	HitParams.Speed = 4000.0f;
+	HitParams.Lifetime = 1.0f;
+	TEST_TRUE(Projectiles->FireProjectile(HitParams), "Projectile should launch");
+
+	Projectiles->TickProjectiles(0.1f);
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore, "Projectile should not hit before reaching the target");
+	Projectiles->TickProjectiles(0.2f);
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore + 1, "Projectile should hit the target in its path");
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 0, "Projectile should be removed on hit");
+
+	// Rounds pass through their instigator
+	HitParams.Origin = Target->GetActorLocation();
+	HitParams.Instigator = Target;
+	TEST_TRUE(Projectiles->FireProjectile(HitParams), "Projectile should launch");
+	Projectiles->TickProjectiles(0.05f);
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore + 1, "Projectile should not hit its instigator");
+
+	// Hits on actors with combat attributes go through the damage effect
+	ATurretBase* DamagedTurret = CreateTestTurret();
+	TEST_NOT_NULL(DamagedTurret, "Damaged turret should be created");
+	UCombatAttributeSet* DamagedAttributes = DamagedTurret->GetCombatAttributeSet();
+	DamagedAttributes->InitMaxHealth(100.0f);
+	DamagedAttributes->InitHealth(100.0f);
+	Projectiles->ApplyHit(DamagedTurret, 30.0f, Target, DamagedTurret->GetActorLocation());
+	TEST_NEARLY_EQUAL(DamagedAttributes->GetHealth(), 70.0f, 0.1f, "Hit should apply its damage through the damage effect");
+	TEST_EQUAL(DamagedTurret->GetAbilitySystemComponent()->GetNumActiveGameplayEffects(), 0, "Instant damage effect should not stay active");
+	Projectiles->ApplyHit(DamagedTurret, 500.0f, Target, DamagedTurret->GetActorLocation());
+	TEST_NEARLY_EQUAL(DamagedAttributes->GetHealth(), 0.0f, 0.1f, "Damage effect should respect the Health clamp");
+	DamagedTurret->Destroy();
+
+	// Limit
+	Projectiles->ClearProjectiles();
+	Projectiles->SetMaxProjectiles(2);
+	TEST_TRUE(Projectiles->FireProjectile(MissParams), "First projectile should launch");
+	TEST_TRUE(Projectiles->FireProjectile(MissParams), "Second projectile should launch");
+	TEST_FALSE(Projectiles->FireProjectile(MissParams), "Projectile over the limit should be dropped");
 
 	// Cleanup
-	if (Turret) Turret->Destroy();
-	if (WarRig) WarRig->Destroy();
+	Projectiles->SetMaxProjectiles(UProjectileSubsystem::DefaultMaxProjectiles);
+	Projectiles->ClearProjectiles();
+	if (Target) Target->Destroy();
 
-	TEST_SUCCESS("TurretTest_FiringArcCalculation");
+	TEST_SUCCESS("TurretTest_ProjectileSystem");
 }
 
 /**
- * Test: Attribute Initialization
- * Verify stats load correctly from data table
+ * Test: Lane Index Candidates
+ * Verify turret targeting and projectile hits read lane-indexed pawns without a physics query
  */
-static bool TurretTest_AttributeInitialization()
+static bool TurretTest_LaneIndexCandidates()
 {
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(World);
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(World);
+	UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(World);
+	TEST_NOT_NULL(ScrollMovers, "World should provide the scroll mover subsystem");
+	TEST_NOT_NULL(Targeting, "World should provide the turret targeting subsystem");
+	TEST_NOT_NULL(Projectiles, "World should provide the projectile subsystem");
+	Projectiles->ClearProjectiles();
+
+	// Well away from the level's own pawns
+	const FVector TestOrigin(0.0f, -20000.0f, 5000.0f);
+
+	AWarRigPawn* WarRig = CreateTestWarRig();
 	ATurretBase* Turret = CreateTestTurret();
 	TEST_NOT_NULL(Turret, "Turret should be created");
+	Turret->SetActorLocation(TestOrigin);
+	Turret->Initialize(CreateTestTurretData(), 0, FRotator::ZeroRotator, WarRig);
 
-	// Create test data
-	FTurretData TurretData = CreateTestTurretData();
-	TurretData.BaseDamage = 42.0f;
-	TurretData.FireRate = 3.5f;
-	TurretData.Range = 2000.0f;
-	TurretData.BaseHealth = 250.0f;
+	// A pawn without collision is invisible to overlaps, so only the lane index can find it
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), TestOrigin + FVector(1000.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Target, "Target pawn should be created");
+	Target->SetActorEnableCollision(false);
+	ScrollMovers->RegisterLaneEntity(Target, 1);
+
+	// A pawn that never registered as a lane entity is only found by the overlap
+	ADefaultPawn* Unindexed = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), TestOrigin + FVector(1200.0f, 400.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Unindexed, "Unindexed pawn should be created");
+
+	TArray<AActor*> Found;
+	ScrollMovers->QueryAllLanes(Target->GetActorLocation().X - 10.0f, Target->GetActorLocation().X + 10.0f, Found);
+	TEST_TRUE(Found.Contains(Target), "Lane query should span every lane");
+
+	// Targeting: both pawns are candidates, each once
+	Targeting->InvalidateCandidates();
+	const int32 QueriesBefore = Targeting->GetQueryCount();
+	const int32 LaneQueriesBefore = Targeting->GetLaneQueryCount();
+	TEST_EQUAL(Turret->FindTarget(), static_cast<AActor*>(Target), "Turret should acquire the closer lane-indexed target");
+	TEST_EQUAL(Targeting->GetCandidateCount(), 2, "Candidates should hold the lane-indexed and the unindexed pawn once each");
+	TEST_EQUAL(Targeting->GetLaneQueryCount() - LaneQueriesBefore, 1, "Candidates should include one lane index gather");
+	TEST_EQUAL(Targeting->GetQueryCount() - QueriesBefore, 1, "The overlap should run alongside the lane index");
+
+	// Projectile hits: one round at each pawn
+	const int32 HitsBefore = Projectiles->GetHitCount();
+	const int32 OverlapsBefore = Projectiles->GetOverlapQueryCount();
+	FProjectileSpawnParams HitParams;
+	HitParams.Origin = TestOrigin;
+	HitParams.Direction = FVector(1.0f, 0.0f, 0.0f);
+	HitParams.Speed = 4000.0f;
+	HitParams.Lifetime = 1.0f;
+	HitParams.Radius = 50.0f;
+	TEST_TRUE(Projectiles->FireProjectile(HitParams), "Projectile should launch");
+	Projectiles->TickProjectiles(0.3f);
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore + 1, "Projectile should hit the lane-indexed target");
+	TEST_TRUE(Projectiles->GetOverlapQueryCount() > OverlapsBefore, "Hit gathers should run the overlap alongside the lane index");
+
+	HitParams.Direction = (Unindexed->GetActorLocation() - TestOrigin).GetSafeNormal();
+	TEST_TRUE(Projectiles->FireProjectile(HitParams), "Second projectile should launch");
+	Projectiles->TickProjectiles(0.4f);
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore + 2, "Projectile should hit the unindexed pawn");
+
+	// Once unregistered the collisionless target is invisible to both systems
+	ScrollMovers->UnregisterLaneEntity(Target);
+	Targeting->InvalidateCandidates();
+	TEST_EQUAL(Turret->FindTarget(), static_cast<AActor*>(Unindexed), "Unregistered collisionless target should not be found");
+	TEST_EQUAL(Targeting->GetCandidateCount(), 1, "Only the unindexed pawn should remain a candidate");
 
-	// Initialize turret
-	AWarRigPawn* WarRig = CreateTestWarRig();
-	FRotator FacingDirection = FRotator(0.0f, 90.0f, 0.0f); // Facing right
-	Turret->Initialize(TurretData, 5, FacingDirection, WarRig);
+	// Cleanup
+	Projectiles->ClearProjectiles();
+	if (Turret) Turret->Destroy();
+	if (WarRig) WarRig->Destroy();
+	if (Target) Target->Destroy();
+	if (Unindexed) Unindexed->Destroy();
 
-	// Verify attributes match data table
-	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
-	TEST_NOT_NULL(Attributes, "Attributes should exist");
+	TEST_SUCCESS("TurretTest_LaneIndexCandidates");
+}
 
-	TEST_NEARLY_EQUAL(Attributes->GetHealth(), TurretData.BaseHealth, 0.1f, "Health should match data table");
-	TEST_NEARLY_EQUAL(Attributes->GetMaxHealth(), TurretData.BaseHealth, 0.1f, "MaxHealth should match data table");
-	TEST_NEARLY_EQUAL(Attributes->GetDamage(), TurretData.BaseDamage, 0.1f, "Damage should match data table");
-	TEST_NEARLY_EQUAL(Attributes->GetFireRate(), TurretData.FireRate, 0.1f, "FireRate should match data table");
-	TEST_NEARLY_EQUAL(Attributes->GetRange(), TurretData.Range, 0.1f, "Range should match data table");
+/**
+ * Test: Line-of-sight and hitscan traces are submitted asynchronously under a per-frame cap
+ */
+static bool TurretTest_AsyncTraces()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
 
-	// Verify turret properties
-	TEST_EQUAL(Turret->GetMountIndex(), 5, "Mount index should be set correctly");
-	TEST_EQUAL(Turret->GetOwnerWarRig(), WarRig, "Owner war rig should be set correctly");
+	UTurretTraceSubsystem* Traces = UTurretTraceSubsystem::Get(World);
+	TEST_NOT_NULL(Traces, "World should provide the trace subsystem");
 
-	// Verify facing direction (check yaw)
-	FRotator ActualFacing = Turret->GetFacingDirection();
-	TEST_NEARLY_EQUAL(ActualFacing.Yaw, FacingDirection.Yaw, 0.1f, "Facing direction should match");
+	ATestTurret* Turret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
 
-	// Cleanup
+	// Well away from the level's own pawns
+	const FVector TestOrigin(0.0f, -20000.0f, 5000.0f);
+	Turret->SetActorLocation(TestOrigin + FVector(0.0f, 1000.0f, 0.0f));
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), TestOrigin, FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Target, "Target pawn should be created");
+
+	// Earlier tests may already have used some of this frame's budget: leave room for exactly one trace
+	Traces->SetMaxTracesPerFrame(Traces->GetTracesThisFrame() + 1);
+	const int32 SubmittedBefore = Traces->GetSubmittedTraceCount();
+
+	// First refresh submits a trace; the result only arrives on a later frame
+	TEST_EQUAL(Traces->RefreshLineOfSight(Turret, Target), ETurretLineOfSight::Unknown, "Line of sight should be unknown before the first trace completes");
+	TEST_EQUAL(Traces->GetSubmittedTraceCount(), SubmittedBefore + 1, "First refresh should submit a trace");
+	TEST_TRUE(Turret->IsTargetValid(Target), "Unknown line of sight should not reject a target");
+	TEST_EQUAL(Traces->GetSubmittedTraceCount(), SubmittedBefore + 1, "Validity checks should only read the cache");
+
+	// An in-flight trace is not duplicated
+	Traces->RefreshLineOfSight(Turret, Target);
+	TEST_EQUAL(Traces->GetSubmittedTraceCount(), SubmittedBefore + 1, "Pending line of sight should not be traced again");
+
+	// Completed line of sight flips the cache: clear, then blocked by a wall
+	Traces->FlushPendingTraces();
+	TEST_EQUAL(Traces->GetPendingTraceCount(), 0, "Flushed traces should no longer be pending");
+	TEST_EQUAL(Traces->GetLineOfSight(Turret, Target), ETurretLineOfSight::Visible, "Completed clear trace should cache Visible");
+
+	Traces->SetMaxTracesPerFrame(Traces->GetTracesThisFrame() + 1);
+	TEST_EQUAL(Traces->RefreshLineOfSight(Turret, Target), ETurretLineOfSight::Visible, "Fresh result should be served from the cache");
+	TEST_EQUAL(Traces->GetPendingTraceCount(), 0, "Fresh result should not be traced again");
+
+	// World time does not advance inside a test, so a second turret behind a wall takes the blocked path
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	TEST_NOT_NULL(CubeMesh, "Engine cube mesh should load");
+	AStaticMeshActor* Wall = World->SpawnActor<AStaticMeshActor>(AStaticMeshActor::StaticClass(), TestOrigin - FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Wall, "Wall should be created");
+	Wall->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+	Wall->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+	Wall->SetActorScale3D(FVector(0.5f, 4.0f, 4.0f));
+
+	ATestTurret* BlockedTurret = CreateTestTurret();
+	TEST_NOT_NULL(BlockedTurret, "Blocked turret should be created");
+	BlockedTurret->SetActorLocation(TestOrigin - FVector(1000.0f, 0.0f, 0.0f));
+	Traces->RefreshLineOfSight(BlockedTurret, Target);
+	Traces->FlushPendingTraces();
+	TEST_EQUAL(Traces->GetLineOfSight(BlockedTurret, Target), ETurretLineOfSight::Blocked, "Completed trace through the wall should cache Blocked");
+	TEST_FALSE(BlockedTurret->IsTargetValid(Target), "Blocked line of sight should reject the target");
+
+	// A completed hitscan trace that reaches a pawn applies its hit
+	Traces->SetMaxTracesPerFrame(Traces->GetTracesThisFrame() + 1);
+	UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(World);
+	TEST_NOT_NULL(Projectiles, "World should provide the projectile subsystem");
+	const int32 HitsBefore = Projectiles->GetHitCount();
+	Traces->RequestHitscan(Turret, TestOrigin + FVector(0.0f, -500.0f, 0.0f), TestOrigin + FVector(0.0f, 500.0f, 0.0f), 10.0f);
+	Traces->FlushPendingTraces();
+	TEST_EQUAL(Projectiles->GetHitCount(), HitsBefore + 1, "Hitscan trace reaching the pawn should apply a hit");
+
+	// Hitscan shots over the cap are queued in order
+	const int32 QueuedBefore = Traces->GetQueuedHitscanCount();
+	TEST_EQUAL(QueuedBefore, 0, "No shots should be waiting at the start of the test");
+	Traces->SetMaxTracesPerFrame(Traces->GetTracesThisFrame() + 1);
+	const int32 SubmittedBeforeShots = Traces->GetSubmittedTraceCount();
+	for (int32 i = 0; i < 3; ++i)
+	{
+		Traces->RequestHitscan(Turret, TestOrigin + FVector(0.0f, 0.0f, 500.0f), TestOrigin + FVector(1000.0f, 0.0f, 500.0f), 10.0f);
+	}
+	TEST_EQUAL(Traces->GetSubmittedTraceCount(), SubmittedBeforeShots + 1, "Only the remaining budget should be submitted");
+	TEST_EQUAL(Traces->GetQueuedHitscanCount(), 2, "Shots over the cap should be queued");
+
+	// Budget is per frame: ticking again this frame submits nothing
+	Traces->TickTraces();
+	TEST_EQUAL(Traces->GetQueuedHitscanCount(), 2, "Queued shots should wait for a later frame's budget");
+	TEST_TRUE(Traces->GetPendingTraceCount() >= 1, "Submitted traces should be pending until the engine delivers them");
+
+	// The queue is bounded: the oldest shots are shed once it is full
+	const int32 DroppedBefore = Traces->GetDroppedHitscanCount();
+	for (int32 i = 0; i < UTurretTraceSubsystem::MaxQueuedHitscans; ++i)
+	{
+		Traces->RequestHitscan(Turret, TestOrigin + FVector(0.0f, 0.0f, 500.0f), TestOrigin + FVector(1000.0f, 0.0f, 500.0f), 10.0f);
+	}
+	TEST_EQUAL(Traces->GetQueuedHitscanCount(), UTurretTraceSubsystem::MaxQueuedHitscans, "Queue should not grow past its cap");
+	TEST_EQUAL(Traces->GetDroppedHitscanCount() - DroppedBefore, 2, "Shots over the queue cap should be dropped");
+
+	// Cleanup (queued shots drain harmlessly over empty space on later frames)
+	Traces->SetMaxTracesPerFrame(UTurretTraceSubsystem::DefaultMaxTracesPerFrame);
+	if (Wall) Wall->Destroy();
+	if (BlockedTurret) BlockedTurret->Destroy();
+	if (Target) Target->Destroy();
 	if (Turret) Turret->Destroy();
-	if (WarRig) WarRig->Destroy();
 
-	TEST_SUCCESS("TurretTest_AttributeInitialization");
+	TEST_SUCCESS("TurretTest_AsyncTraces");
 }
 
 /**
- * Test: Null Target Handling
- * Verify graceful handling when no targets are available
+ * Test: Fire Scheduler
+ * Verify scheduled turrets stop ticking and fire every shot due since their last wake, dropping only a stale backlog
  */
-static bool TurretTest_NullTargetHandling()
+static bool TurretTest_FireScheduler()
 {
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(World);
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(World);
+	UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(World);
+	TEST_NOT_NULL(FireScheduler, "World should provide the fire scheduler");
+	TEST_NOT_NULL(Targeting, "World should provide the turret targeting subsystem");
+	TEST_NOT_NULL(Projectiles, "World should provide the projectile subsystem");
+
+	// Well away from the level's own pawns
+	const FVector TestOrigin(20000.0f, 0.0f, 5000.0f);
+
+	AWarRigPawn* WarRig = CreateTestWarRig();
 	ATurretBase* Turret = CreateTestTurret();
 	TEST_NOT_NULL(Turret, "Turret should be created");
+	Turret->SetActorLocation(TestOrigin);
 
-	// Initialize turret
-	AWarRigPawn* WarRig = CreateTestWarRig();
 	FTurretData TurretData = CreateTestTurretData();
+	TurretData.FireRate = 20.0f;
 	Turret->Initialize(TurretData, 0, FRotator::ZeroRotator, WarRig);
 
-	// Try to find a target (should return nullptr since no enemies exist)
-	AActor* Target = Turret->FindTarget();
-	TEST_NULL(Target, "FindTarget should return null when no targets available");
-
-	// Verify current target is null
-	TEST_NULL(Turret->GetCurrentTarget(), "Current target should be null");
-
-	// Try to fire with null target (should handle gracefully without crashing)
-	Turret->Fire(); // Should not crash or throw error
-
-	// Verify turret is still valid after attempting to fire with null target
-	TEST_TRUE(IsValid(Turret), "Turret should still be valid after firing with null target");
+	TEST_TRUE(FireScheduler->IsTurretRegistered(Turret), "Turret should register with the fire scheduler when mounted");
+	TEST_FALSE(Turret->IsActorTickEnabled(), "Scheduled turret should not tick");
 
-	// Test IsTargetInFiringArc with null target's location (edge case)
-	// This tests that the function handles invalid input gracefully
-	FVector InvalidLocation = FVector::ZeroVector;
-	bool bResult = Turret->IsTargetInFiringArc(InvalidLocation);
-	// Should not crash (result doesn't matter as much as not crashing)
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ADefaultPawn* Target = World->SpawnActor<ADefaultPawn>(ADefaultPawn::StaticClass(), TestOrigin + FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+	TEST_NOT_NULL(Target, "Target pawn should be created");
+
+	// Earlier tests may have spent this frame's re-acquisition budget
+	Targeting->SetReacquisitionBudget(0);
+	Targeting->InvalidateCandidates();
+	Projectiles->ClearProjectiles();
+
+	// A wake 0.21s late at 20 shots/s owes five shots (due at -0.21, -0.16, -0.11, -0.06, -0.01)
+	const double Now = World->GetTimeSeconds();
+	double NextWake = Turret->ProcessScheduledFire(Now - 0.21, Now);
+	TEST_EQUAL(Turret->GetCurrentTarget(), static_cast<AActor*>(Target), "Woken turret should acquire the target");
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 5, "Every shot due since the last wake should fire");
+	TEST_NEARLY_EQUAL(NextWake - Now, 0.04, 0.001, "Next wake should keep the exact fire cadence");
+
+	// After a long hitch only shots due within MaxFireBacklog fire, on the original cadence
+	// (due at -10.02 + 0.05k: the kept shots are -0.22, -0.17, -0.12, -0.07, -0.02)
+	NextWake = Turret->ProcessScheduledFire(Now - 10.02, Now);
+	TEST_EQUAL(Projectiles->GetProjectileCount(), 10, "Only shots within the backlog window should fire");
+	TEST_NEARLY_EQUAL(NextWake - Now, 0.03, 0.001, "Next wake should stay on the cadence after a dropped backlog");
+
+	// Without a target nothing fires and the turret sleeps until it looks again
+	Target->Destroy();
+	const int32 ProjectilesBefore = Projectiles->GetProjectileCount();
+	NextWake = Turret->ProcessScheduledFire(Now, Now);
+	TEST_NULL(Turret->GetCurrentTarget(), "Destroyed target should be dropped");
+	TEST_EQUAL(Projectiles->GetProjectileCount(), ProjectilesBefore, "Turret without a target should not fire");
+	TEST_TRUE(NextWake > Now, "Idle turret should be woken again later");
 
 	// Cleanup
-	if (Turret) Turret->Destroy();
+	Targeting->SetReacquisitionBudget(UTurretTargetingSubsystem::DefaultReacquisitionBudget);
+	Projectiles->ClearProjectiles();
+	Turret->Destroy();
+	TEST_FALSE(FireScheduler->IsTurretRegistered(Turret), "Destroyed turret should unregister");
 	if (WarRig) WarRig->Destroy();
 
-	TEST_SUCCESS("TurretTest_NullTargetHandling");
+	TEST_SUCCESS("TurretTest_FireScheduler");
 }
 
 /**
- * Test: Attribute Clamping
- * Verify that health is clamped to [0, MaxHealth] range
+ * Test: Fire Scheduler Wheel
+ * Verify the timing wheel wakes turrets in their slot, across a full revolution, and drops stale registrations
  */
-static bool TurretTest_AttributeClamping()
+static bool TurretTest_FireSchedulerWheel()
 {
-	ATurretBase* Turret = CreateTestTurret();
-	TEST_NOT_NULL(Turret, "Turret should be created");
-
-	UCombatAttributeSet* Attributes = Turret->GetCombatAttributeSet();
-	TEST_NOT_NULL(Attributes, "Attributes should exist");
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
 
-	// Initialize with known values
-	float MaxHealth = 100.0f;
-	Attributes->InitMaxHealth(MaxHealth);
-	Attributes->InitHealth(MaxHealth);
+	// A private scheduler so the test can drive time without stalling the world's turrets
+	UTurretFireSchedulerSubsystem* Scheduler = NewObject<UTurretFireSchedulerSubsystem>(World);
+	TEST_NOT_NULL(Scheduler, "Scheduler should be created");
 
-	// Verify initial values
-	TEST_NEARLY_EQUAL(Attributes->GetHealth(), MaxHealth, 0.1f, "Health should be at max");
+	ATestTurret* Turret = CreateTestTurret();
+	ATestTurret* OtherTurret = CreateTestTurret();
+	TEST_NOT_NULL(Turret, "Turret should be created");
+	TEST_NOT_NULL(OtherTurret, "Other turret should be created");
+	Turret->ScriptedWakeInterval = 0.1;
+	OtherTurret->ScriptedWakeInterval = 0.1;
+
+	const double Start = World->GetTimeSeconds();
+	const double Frame = UTurretFireSchedulerSubsystem::SlotDuration;
+	const double Revolution = UTurretFireSchedulerSubsystem::WheelSlotCount * Frame;
+
+	Scheduler->RegisterTurret(Turret);
+	TEST_TRUE(Scheduler->IsTurretRegistered(Turret), "Turret should be registered");
+	Scheduler->AdvanceTo(Start);
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 1, "Registered turret should wake on the first advance");
+
+	// Slot visiting: the turret sleeps until the slot of its wake time comes up
+	Scheduler->AdvanceTo(Start + 0.05);
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 1, "Turret should sleep until its wake time");
+	Scheduler->AdvanceTo(Start + 0.1 + Frame);
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 2, "Turret should wake once its slot is visited");
+	TEST_NEARLY_EQUAL(Turret->ScheduledWakeDueTimes[1], Start + 0.1, 1e-6, "Wake should carry its exact due time");
+
+	// Wrap past the wheel: a wake further out than one revolution passes its slot once without waking
+	Turret->ScriptedWakeInterval = 5.0;
+	TEST_TRUE(Turret->ScriptedWakeInterval > Revolution, "Interval should exceed one revolution");
+	for (double Time = Start + 0.1 + 2.0 * Frame; Time <= Start + 5.3; Time += Frame)
+	{
+		Scheduler->AdvanceTo(Time);
+	}
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 4, "Long wake should fire once, on the later revolution");
+	TEST_NEARLY_EQUAL(Turret->ScheduledWakeDueTimes[2], Start + 0.2, 1e-6, "Short wake should still be on time");
+	TEST_NEARLY_EQUAL(Turret->ScheduledWakeDueTimes[3], Start + 5.2, 1e-6, "Long wake should carry its due time");
+	TEST_TRUE(Turret->ScheduledWakeTimes[3] >= Turret->ScheduledWakeDueTimes[3], "Wake should not be early");
+	TEST_TRUE(Turret->ScheduledWakeTimes[3] - Turret->ScheduledWakeDueTimes[3] < 2.0 * Frame, "Wake should come within a frame of its due time");
+
+	// A gap longer than a revolution visits the wheel once and wakes the turret once
+	const double AfterGap = Start + 30.0;
+	Scheduler->AdvanceTo(AfterGap);
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 5, "Gap longer than a revolution should wake the turret once");
+	Scheduler->UnregisterTurret(Turret);
+
+	// Lazy unregister: the entry stays in the wheel but is dropped when its slot comes up
+	Scheduler->RegisterTurret(OtherTurret);
+	Scheduler->UnregisterTurret(OtherTurret);
+	TEST_FALSE(Scheduler->IsTurretRegistered(OtherTurret), "Unregistered turret should not be registered");
+	Scheduler->AdvanceTo(AfterGap + 2.0 * Frame);
+	TEST_EQUAL(OtherTurret->ScheduledWakeDueTimes.Num(), 0, "Unregistered turret should not be woken");
+	TEST_EQUAL(Turret->ScheduledWakeDueTimes.Num(), 5, "Unregistered turret's pending wake should be dropped");
+
+	// Registration generation: re-registering leaves the old entry behind, which must not wake the turret twice
+	Scheduler->RegisterTurret(OtherTurret);
+	Scheduler->UnregisterTurret(OtherTurret);
+	Scheduler->RegisterTurret(OtherTurret);
+	Scheduler->AdvanceTo(AfterGap + 4.0 * Frame);
+	TEST_EQUAL(OtherTurret->ScheduledWakeDueTimes.Num(), 1, "Only the current registration should wake the turret");
+	TEST_EQUAL(Scheduler->GetRegisteredTurretCount(), 1, "One turret should remain registered");
 
-	// Try to set health above max (should be clamped)
-	Attributes->SetHealth(150.0f);
-	TEST_NEARLY_EQUAL(Attributes->GetHealth(), MaxHealth, 0.1f, "Health should be clamped to MaxHealth");
+	// Cleanup
+	Scheduler->UnregisterTurret(OtherTurret);
+	Turret->Destroy();
+	OtherTurret->Destroy();
 
-	// Try to set health below zero (should be clamped)
-	Attributes->SetHealth(-50.0f);
-	TEST_NEARLY_EQUAL(Attributes->GetHealth(), 0.0f, 0.1f, "Health should be clamped to 0");
+	TEST_SUCCESS("TurretTest_FireSchedulerWheel");
+}
 
-	// Set health to valid value
-	Attributes->SetHealth(50.0f);
-	TEST_NEARLY_EQUAL(Attributes->GetHealth(), 50.0f, 0.1f, "Health should be set to 50");
+/**
+ * Test: Lightweight Ability System
+ * Verify turrets on a lightweight rig keep their own ASC, with replication and tick off, and GAS stays per turret
+ */
+static bool TurretTest_LightweightAbilitySystem()
+{
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	TEST_NOT_NULL(WarRig, "War rig should be created");
+	WarRig->SetLightweightTurretAbilitySystems(true);
+
+	ATurretBase* FirstTurret = CreateTestTurret();
+	ATurretBase* SecondTurret = CreateTestTurret();
+	TEST_NOT_NULL(FirstTurret, "First turret should be created");
+	TEST_NOT_NULL(SecondTurret, "Second turret should be created");
+
+	FTurretData FirstData = CreateTestTurretData();
+	FTurretData SecondData = CreateTestTurretData();
+	SecondData.BaseDamage = 40.0f;
+	FirstTurret->Initialize(FirstData, 0, FRotator::ZeroRotator, WarRig);
+	SecondTurret->Initialize(SecondData, 1, FRotator::ZeroRotator, WarRig);
+
+	// Each turret keeps its own component, switched off the network and out of the tick
+	UAbilitySystemComponent* FirstASC = FirstTurret->GetAbilitySystemComponent();
+	UAbilitySystemComponent* SecondASC = SecondTurret->GetAbilitySystemComponent();
+	TEST_NOT_NULL(FirstASC, "First turret should have its own ASC");
+	TEST_NOT_NULL(SecondASC, "Second turret should have its own ASC");
+	TEST_TRUE(FirstASC != SecondASC, "Turrets should not share an ASC");
+	TEST_TRUE(FirstASC != WarRig->GetAbilitySystemComponent(), "Turret ASC should be separate from the rig's own ASC");
+	TEST_FALSE(FirstTurret->IsAbilitySystemActive(), "Turret on a lightweight rig should report its ASC inactive");
+	TEST_FALSE(FirstASC->GetIsReplicated(), "Turret ASC on a lightweight rig should not replicate");
+	TEST_FALSE(FirstASC->IsComponentTickEnabled(), "Turret ASC on a lightweight rig should not tick");
+	TEST_TRUE(FirstASC->IsRegistered(), "Turret ASC should stay registered");
+	TEST_EQUAL(FirstASC->GetSet<UCombatAttributeSet>(), static_cast<const UCombatAttributeSet*>(FirstTurret->GetCombatAttributeSet()), "ASC should resolve the turret's own attribute set");
+
+	UCombatAttributeSet* FirstAttributes = FirstTurret->GetCombatAttributeSet();
+	UCombatAttributeSet* SecondAttributes = SecondTurret->GetCombatAttributeSet();
+	TEST_NEARLY_EQUAL(FirstAttributes->GetDamage(), 25.0f, 0.01f, "First turret damage should be its own");
+	TEST_NEARLY_EQUAL(SecondAttributes->GetDamage(), 40.0f, 0.01f, "Second turret damage should be its own");
+
+	// Duration modifiers aggregate on the turret they were applied to
+	UGameplayEffect* Buff = NewObject<UGameplayEffect>(GetTransientPackage());
+	Buff->DurationPolicy = EGameplayEffectDurationType::Infinite;
+	FGameplayModifierInfo DamageBonus;
+	DamageBonus.Attribute = UCombatAttributeSet::GetDamageAttribute();
+	DamageBonus.ModifierOp = EGameplayModOp::Additive;
+	DamageBonus.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(10.0f));
+	Buff->Modifiers.Add(DamageBonus);
+
+	FGameplayEffectSpec BuffSpec(Buff, SecondASC->MakeEffectContext(), 1.0f);
+	const FActiveGameplayEffectHandle BuffHandle = SecondASC->ApplyGameplayEffectSpecToSelf(BuffSpec);
+	TEST_NEARLY_EQUAL(SecondAttributes->GetDamage(), 50.0f, 0.01f, "Buff should raise the second turret's damage");
+	TEST_NEARLY_EQUAL(FirstAttributes->GetDamage(), 25.0f, 0.01f, "Buff on the second turret should leave the first unchanged");
+	SecondASC->RemoveActiveGameplayEffect(BuffHandle);
+	TEST_NEARLY_EQUAL(SecondAttributes->GetDamage(), 40.0f, 0.01f, "Removing the buff should restore the second turret's damage");
+
+	// Instant effects and projectile hits land on the turret hit
+	FGameplayEffectSpecHandle DamageSpec = SecondASC->MakeOutgoingSpec(UGameplayEffect_Damage::StaticClass(), 1.0f, SecondASC->MakeEffectContext());
+	TEST_TRUE(DamageSpec.IsValid(), "Damage spec should be created");
+	DamageSpec.Data->SetSetByCallerMagnitude(UGameplayEffect_Damage::GetDamageDataTag(), -30.0f);
+	SecondASC->ApplyGameplayEffectSpecToSelf(*DamageSpec.Data.Get());
+	TEST_NEARLY_EQUAL(SecondAttributes->GetHealth(), 120.0f, 0.01f, "Damage effect should damage the second turret");
+	TEST_NEARLY_EQUAL(FirstAttributes->GetHealth(), 150.0f, 0.01f, "Damage effect should leave the first turret unchanged");
+
+	if (UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(SecondTurret))
+	{
+		Projectiles->ApplyHit(SecondTurret, 20.0f, nullptr, SecondTurret->GetActorLocation());
+		TEST_NEARLY_EQUAL(SecondAttributes->GetHealth(), 100.0f, 0.01f, "Hit should damage the second turret");
+		TEST_NEARLY_EQUAL(FirstAttributes->GetHealth(), 150.0f, 0.01f, "Hit should leave the first turret unchanged");
+	}
 
-	// Change MaxHealth to lower value - health should be re-clamped
-	Attributes->SetMaxHealth(40.0f);
-	// Note: This requires PostGameplayEffectExecute to handle properly
-	// For now, just verify MaxHealth changed
-	TEST_NEARLY_EQUAL(Attributes->GetMaxHealth(), 40.0f, 0.1f, "MaxHealth should be updated");
+	// Tags are the ASC's own, so GAS tag queries see them
+	const FGameplayTag DeadTag = FGameplayTag::RequestGameplayTag(FName("State.Dead"));
+	SecondASC->AddLooseGameplayTag(DeadTag);
+	TEST_TRUE(SecondASC->HasMatchingGameplayTag(DeadTag), "Second turret should own its tag");
+	TEST_FALSE(FirstASC->HasMatchingGameplayTag(DeadTag), "Second turret's tag should not apply to the first");
+	SecondASC->RemoveLooseGameplayTag(DeadTag);
+	TEST_FALSE(SecondASC->HasMatchingGameplayTag(DeadTag), "Removed tag should be gone");
+
+	// A rig that doesn't opt in keeps mounted turrets' ASCs replicating and ticking
+	WarRig->SetLightweightTurretAbilitySystems(false);
+	FirstTurret->Initialize(FirstData, 0, FRotator::ZeroRotator, WarRig);
+	TEST_TRUE(FirstTurret->IsAbilitySystemActive(), "Turret on a regular rig should report its ASC active");
+	TEST_TRUE(FirstASC->GetIsReplicated(), "Turret ASC on a regular rig should replicate");
+	TEST_TRUE(FirstASC->IsComponentTickEnabled(), "Turret ASC on a regular rig should tick");
 
 	// Cleanup
-	if (Turret) Turret->Destroy();
+	if (FirstTurret) FirstTurret->Destroy();
+	if (SecondTurret) SecondTurret->Destroy();
+	if (WarRig) WarRig->Destroy();
 
-	TEST_SUCCESS("TurretTest_AttributeClamping");
+	TEST_SUCCESS("TurretTest_LightweightAbilitySystem");
 }
 
 /**
- * Test: Mount Point Integration
- * Verify turret correctly stores and retrieves mount point information
+ * Test: Turret Pooling
+ * Verify a sold turret goes back to its pool with clean GAS state and is reused by the next placement
  */
-static bool TurretTest_MountPointIntegration()
+static bool TurretTest_Pooling()
 {
-	ATurretBase* Turret = CreateTestTurret();
-	TEST_NOT_NULL(Turret, "Turret should be created");
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(World);
+	UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(World);
+	TEST_NOT_NULL(Targeting, "World should provide the turret targeting subsystem");
+	TEST_NOT_NULL(FireScheduler, "World should provide the fire scheduler");
 
 	AWarRigPawn* WarRig = CreateTestWarRig();
 	TEST_NOT_NULL(WarRig, "War rig should be created");
+	WarRig->SetLightweightTurretAbilitySystems(true);
 
-	FTurretData TurretData = CreateTestTurretData();
+	// Create pool directly so the test doesn't leave a pool behind in the subsystem
+	AActor* PoolOwner = World->SpawnActor<AActor>();
+	TEST_NOT_NULL(PoolOwner, "Pool owner should be created");
 
-	// Test different mount indices
-	for (int32 MountIdx = 0; MountIdx < 10; ++MountIdx)
-	{
-		FRotator FacingDirection = FRotator(0.0f, MountIdx * 45.0f, 0.0f); // Different facing for each mount
-		Turret->Initialize(TurretData, MountIdx, FacingDirection, WarRig);
+	UObjectPoolComponent* Pool = NewObject<UObjectPoolComponent>(PoolOwner);
+	Pool->RegisterComponent();
 
-		TEST_EQUAL(Turret->GetMountIndex(), MountIdx, "Mount index should match initialization value");
-		TEST_NEARLY_EQUAL(Turret->GetFacingDirection().Yaw, FacingDirection.Yaw, 0.1f, "Facing direction should match");
-		TEST_EQUAL(Turret->GetOwnerWarRig(), WarRig, "Owner war rig should be consistent");
-	}
+	FObjectPoolConfig Config;
+	Config.PoolSize = 1;
+	Config.bAutoExpand = false;
+	TEST_TRUE(Pool->Initialize(ATestTurret::StaticClass(), Config), "Pool should initialize successfully");
+
+	// Idle pooled turrets stay out of the turret subsystems
+	ATurretBase* Turret = Cast<ATurretBase>(Pool->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator));
+	TEST_NOT_NULL(Turret, "Turret should come from the pool");
+	TEST_FALSE(FireScheduler->IsTurretRegistered(Turret), "Unmounted turret should not be scheduled");
+
+	// Buy: mount it with upgraded stats
+	FTurretData TurretData = CreateTestTurretData();
+	TurretData.BaseDamage = 99.0f;
+	Turret->AttachToActor(WarRig, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	Turret->Initialize(TurretData, 0, FRotator::ZeroRotator, WarRig);
+	TEST_TRUE(Targeting->IsTurretRegistered(Turret), "Mounted turret should register for targeting");
+	TEST_TRUE(FireScheduler->IsTurretRegistered(Turret), "Mounted turret should be scheduled");
+	TEST_NEARLY_EQUAL(Turret->GetCombatAttributeSet()->GetDamage(), 99.0f, 0.01f, "Mounted turret should use its data");
+
+	// A lasting effect on the mounted turret
+	UAbilitySystemComponent* TurretASC = Turret->GetAbilitySystemComponent();
+	TEST_NOT_NULL(TurretASC, "Mounted turret should have its own ASC");
+	UGameplayEffect* Buff = NewObject<UGameplayEffect>(GetTransientPackage());
+	Buff->DurationPolicy = EGameplayEffectDurationType::Infinite;
+	FGameplayEffectSpec BuffSpec(Buff, TurretASC->MakeEffectContext(), 1.0f);
+	const FActiveGameplayEffectHandle BuffHandle = TurretASC->ApplyGameplayEffectSpecToSelf(BuffSpec);
+	TEST_NOT_NULL(TurretASC->GetActiveGameplayEffect(BuffHandle), "Effect on the mounted turret should be active");
+
+	// Sell: the pool resets the turret on return
+	TEST_TRUE(Pool->ReturnToPool(Turret), "Turret should return to the pool");
+	TEST_NULL(TurretASC->GetActiveGameplayEffect(BuffHandle), "Effect on the sold turret should be removed");
+	const UCombatAttributeSet* Defaults = GetDefault<UCombatAttributeSet>();
+	TEST_EQUAL(Turret->GetMountIndex(), -1, "Returned turret should leave its mount");
+	TEST_NULL(Turret->GetOwnerWarRig(), "Returned turret should forget its war rig");
+	TEST_NULL(Turret->GetAttachParentActor(), "Returned turret should be detached");
+	TEST_NULL(Turret->GetCurrentTarget(), "Returned turret should drop its target");
+	TEST_FALSE(Targeting->IsTurretRegistered(Turret), "Returned turret should leave targeting");
+	TEST_FALSE(FireScheduler->IsTurretRegistered(Turret), "Returned turret should leave the fire scheduler");
+	TEST_FALSE(Turret->IsAbilitySystemActive(), "Pooled turret's ASC should be inactive");
+	TEST_FALSE(TurretASC->GetIsReplicated(), "Pooled turret's ASC should not replicate");
+	TEST_FALSE(TurretASC->IsComponentTickEnabled(), "Pooled turret's ASC should not tick");
+	TEST_EQUAL(TurretASC->GetNumActiveGameplayEffects(), 0, "Returned turret should have no active effects");
+	TEST_NEARLY_EQUAL(Turret->GetCombatAttributeSet()->GetDamage(), Defaults->GetDamage(), 0.01f, "Returned turret damage should be reset");
+	TEST_NEARLY_EQUAL(Turret->GetCombatAttributeSet()->GetHealth(), Defaults->GetMaxHealth(), 0.01f, "Returned turret health should be reset");
+
+	// Buy again: the same actor is reused
+	AActor* Reused = Pool->GetFromPool(FVector::ZeroVector, FRotator::ZeroRotator);
+	TEST_EQUAL(Reused, static_cast<AActor*>(Turret), "Next placement should reuse the pooled turret");
 
 	// Cleanup
-	if (Turret) Turret->Destroy();
+	Pool->ReturnToPool(Reused);
+	if (PoolOwner) PoolOwner->Destroy();
 	if (WarRig) WarRig->Destroy();
 
-	TEST_SUCCESS("TurretTest_MountPointIntegration");
+	TEST_SUCCESS("TurretTest_Pooling");
 }
 
 /**
- * Test: Ability System Component Integration
- * Verify ASC is properly integrated and accessible
+ * Test: Rig Swap With Mounted Turrets
+ * Verifies that swapping rigs re-homes turrets onto the rebuilt mounts and removes turrets whose mount is gone
  */
-static bool TurretTest_AbilitySystemIntegration()
+static bool TurretTest_RigSwapRehomesTurrets()
 {
-	ATurretBase* Turret = CreateTestTurret();
-	TEST_NOT_NULL(Turret, "Turret should be created");
-
-	// Verify ASC exists
-	UAbilitySystemComponent* ASC = Turret->GetAbilitySystemComponent();
-	TEST_NOT_NULL(ASC, "AbilitySystemComponent should exist");
+	AWarRigPawn* WarRig = CreateTestWarRig();
+	TEST_NOT_NULL(WarRig, "War rig should be created");
 
-	// Verify attribute set is added to ASC
-	const TArray<UAttributeSet*>& AttributeSets = ASC->GetSpawnedAttributes();
-	TEST_TRUE(AttributeSets.Num() > 0, "ASC should have at least one attribute set");
+	// Big rig keeps the default mounts; small rig keeps two and moves mount 1
+	FWarRigData BigRow;
+	FWarRigData SmallRow;
+	SmallRow.MountPoints.SetNum(2);
+	SmallRow.MountPoints[1].MountTransform = FTransform(FRotator(0.0f, 90.0f, 0.0f), FVector(300.0f, 50.0f, 100.0f));
+	TEST_TRUE(BigRow.MountPoints.Num() > 5, "Default rig should have a mount 5");
 
-	// Verify CombatAttributeSet is present
-	bool bHasCombatAttributes = false;
-	for (UAttributeSet* AttrSet : AttributeSets)
-	{
-		if (Cast<UCombatAttributeSet>(AttrSet))
-		{
-			bHasCombatAttributes = true;
-			break;
-		}
-	}
-	TEST_TRUE(bHasCombatAttributes, "ASC should have CombatAttributeSet");
+	UDataTable* RigTable = NewObject<UDataTable>();
+	RigTable->RowStruct = FWarRigData::StaticStruct();
+	RigTable->AddRow(FName(TEXT("Big")), BigRow);
+	RigTable->AddRow(FName(TEXT("Small")), SmallRow);
+	WarRig->SetWarRigDataTable(RigTable);
+	WarRig->SwapWarRig(FName(TEXT("Big")));
 
-	// Verify ASC replication is enabled
-	TEST_TRUE(ASC->GetIsReplicated(), "ASC should be replicated");
+	FTurretData TurretData = CreateTestTurretData();
+	TurretData.TurretClass = ATestTurret::StaticClass();
+	ATurretBase* KeptTurret = WarRig->PlaceTurret(TurretData, 1);
+	ATurretBase* LostTurret = WarRig->PlaceTurret(TurretData, 5);
+	TEST_NOT_NULL(KeptTurret, "Turret should mount at 1");
+	TEST_NOT_NULL(LostTurret, "Turret should mount at 5");
+
+	WarRig->SwapWarRig(FName(TEXT("Small")));
+
+	// Mount 5 is gone: its turret went back to the pool and released the mount
+	TEST_NULL(WarRig->GetTurretAtMount(5), "Turret on a missing mount should be removed");
+	TEST_EQUAL(LostTurret->GetMountIndex(), -1, "Removed turret should leave its mount");
+	TEST_NULL(LostTurret->GetAttachParentActor(), "Removed turret should be detached");
+	TEST_NULL(WarRig->GetTurretAttributeSet(5), "Rig should have no attributes for the dropped mount");
+
+	// Mount 1 survives: its turret rides the new mount component
+	USceneComponent* NewMount = WarRig->GetMountPointComponent(1);
+	TEST_NOT_NULL(NewMount, "Small rig should have mount 1");
+	TEST_EQUAL(WarRig->GetTurretAtMount(1), KeptTurret, "Turret on a kept mount should stay placed");
+	TEST_EQUAL(KeptTurret->GetMountIndex(), 1, "Kept turret should keep its mount index");
+	TEST_EQUAL(KeptTurret->GetRootComponent()->GetAttachParent(), NewMount, "Kept turret should attach to the rebuilt mount");
+	TEST_TRUE(KeptTurret->GetActorLocation().Equals(NewMount->GetComponentLocation(), 0.1f), "Kept turret should move to the rebuilt mount");
+	TEST_NEARLY_EQUAL(KeptTurret->GetFacingDirection().Yaw, NewMount->GetComponentRotation().Yaw, 0.1f, "Kept turret should face along the rebuilt mount");
 
 	// Cleanup
-	if (Turret) Turret->Destroy();
+	WarRig->RemoveTurret(1);
+	WarRig->Destroy();
 
-	TEST_SUCCESS("TurretTest_AbilitySystemIntegration");
+	TEST_SUCCESS("TurretTest_RigSwapRehomesTurrets");
 }
 
 // ============================================================================
@@ -1336,7 +3134,7 @@ static bool WorldScrollTest_ScrollPause()
 		ScrollComponent->TickComponent(DeltaTime, ELevelTick::LEVELTICK_All, nullptr);
 	}
 
-	const float DistanceAfterScrolling = ScrollComponent->GetDistanceTraveled();
+	const double DistanceAfterScrolling = ScrollComponent->GetDistanceTraveled();
 	TEST_TRUE(DistanceAfterScrolling > 0.0f, "Distance should increase while scrolling");
 
 	// Pause scrolling
@@ -1535,6 +3333,148 @@ static bool WorldScrollTest_DistanceReset()
 	TEST_SUCCESS("WorldScrollTest_DistanceReset");
 }
 
+/**
+ * Test: Scroll Mover Subsystem
+ * Verify registered movers are moved by the scroll offset in one pass and unregistered ones are not
+ */
+static bool WorldScrollTest_ScrollMoverSubsystem()
+{
+	UWorldScrollComponent* ScrollComponent = CreateTestWorldScrollComponent();
+	TEST_NOT_NULL(ScrollComponent, "Scroll component should be created");
+
+	UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(ScrollComponent);
+	TEST_NOT_NULL(ScrollMovers, "Scroll mover subsystem should exist");
+
+	// Drive movers from the test component for the duration of the test
+	UWorldScrollComponent* PreviousSource = ScrollMovers->GetScrollSource();
+	ScrollMovers->SetScrollSource(ScrollComponent);
+	ScrollComponent->SetScrollDirection(FVector(-1.0f, 0.0f, 0.0f));
+	ScrollComponent->SetScrollSpeed(1000.0f);
+	ScrollComponent->SetScrolling(true);
+
+	UWorld* World = ScrollComponent->GetWorld();
+	AActor* Mover = World->SpawnActor<ATestPoolableActor>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	AActor* Idle = World->SpawnActor<ATestPoolableActor>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(Mover, "Mover actor should be spawned");
+	TEST_NOT_NULL(Idle, "Idle actor should be spawned");
+
+	const int32 InitialCount = ScrollMovers->GetMoverCount();
+	ScrollMovers->RegisterMover(Mover);
+	ScrollMovers->RegisterMover(Mover);
+	TEST_EQUAL(ScrollMovers->GetMoverCount(), InitialCount + 1, "Registering twice should add the mover once");
+	TEST_TRUE(ScrollMovers->IsMoverRegistered(Mover), "Mover should be registered");
+
+	// 0.5s at 1000 units/s backward
+	ScrollMovers->TickMovers(0.5f);
+	TEST_NEARLY_EQUAL(Mover->GetActorLocation().X, 0.0f, 0.1f, "Mover should scroll back by 500 units");
+	TEST_NEARLY_EQUAL(Idle->GetActorLocation().X, 500.0f, 0.1f, "Unregistered actor should not move");
+
+	// Paused scrolling leaves movers in place
+	ScrollComponent->SetScrolling(false);
+	ScrollMovers->TickMovers(0.5f);
+	TEST_NEARLY_EQUAL(Mover->GetActorLocation().X, 0.0f, 0.1f, "Mover should not move while paused");
+
+	ScrollMovers->UnregisterMover(Mover);
+	TEST_FALSE(ScrollMovers->IsMoverRegistered(Mover), "Mover should be unregistered");
+	TEST_EQUAL(ScrollMovers->GetMoverCount(), InitialCount, "Mover count should be restored");
+
+	// A mover destroyed without unregistering is collected (GC nulls its entry) and dropped by key on the next tick
+	AActor* Doomed = World->SpawnActor<ATestPoolableActor>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(Doomed, "Doomed actor should be spawned");
+	ScrollMovers->RegisterMover(Doomed);
+	ScrollMovers->RegisterLaneEntity(Doomed, 0);
+	const int32 IndexedBefore = ScrollMovers->GetLaneIndex().Num();
+	Doomed->Destroy();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	ScrollComponent->SetScrolling(true);
+	ScrollMovers->TickMovers(0.1f);
+	TEST_EQUAL(ScrollMovers->GetMoverCount(), InitialCount, "Collected mover should be dropped");
+	TEST_EQUAL(ScrollMovers->GetLaneIndex().Num(), IndexedBefore - 1, "Collected mover should leave the lane index");
+
+	// Later actors (possibly at the dead one's address) register and unregister normally
+	AActor* Newcomer = World->SpawnActor<ATestPoolableActor>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TEST_NOT_NULL(Newcomer, "Newcomer actor should be spawned");
+	ScrollMovers->RegisterMover(Newcomer);
+	ScrollMovers->RegisterMover(Mover);
+	TEST_TRUE(ScrollMovers->IsMoverRegistered(Newcomer), "Newcomer should register");
+	ScrollMovers->UnregisterMover(Newcomer);
+	TEST_TRUE(ScrollMovers->IsMoverRegistered(Mover), "Unregistering the newcomer should leave other movers alone");
+	ScrollMovers->UnregisterMover(Mover);
+	TEST_EQUAL(ScrollMovers->GetMoverCount(), InitialCount, "Mover count should be restored again");
+	Newcomer->Destroy();
+
+	// Cleanup
+	ScrollMovers->SetScrollSource(PreviousSource);
+	Mover->Destroy();
+	Idle->Destroy();
+	if (ScrollComponent->GetOwner())
+	{
+		ScrollComponent->GetOwner()->Destroy();
+	}
+
+	TEST_SUCCESS("WorldScrollTest_ScrollMoverSubsystem");
+}
+
+/**
+ * Test: Lane Distance Index
+ * Verify entities are found by lane and distance range, moved on re-add and dropped on remove
+ */
+static bool WorldScrollTest_LaneDistanceIndex()
+{
+	UWorld* World = GetTestWorldForObjectPoolTests();
+	TEST_NOT_NULL(World, "World should exist");
+
+	// Small ring so the test also covers aliased buckets (4 x 1000 units)
+	FLaneDistanceIndex Index;
+	Index.Initialize(3, 1000.0f, 4);
+
+	TArray<AActor*> Entities;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		Entities.Add(World->SpawnActor<AActor>());
+		TEST_NOT_NULL(Entities[i], "Test entity should spawn");
+	}
+
+	Index.Add(Entities[0], 0, 500.0f);
+	Index.Add(Entities[1], 1, 1500.0f);
+	Index.Add(Entities[2], 1, 4500.0f); // Same ring slot as 500
+	Index.Add(Entities[3], 2, 2500.0f);
+	TEST_EQUAL(Index.Num(), 4, "All entities should be indexed");
+
+	TArray<AActor*> Found;
+	Index.Query(0, 1, 0.0f, 2000.0f, Found);
+	TEST_EQUAL(Found.Num(), 2, "Lanes 0-1 over 0-2000 should hold two entities");
+	TEST_TRUE(Found.Contains(Entities[0]) && Found.Contains(Entities[1]), "Query should return the entities in range");
+
+	Found.Reset();
+	Index.Query(0, 2, 4000.0f, 5000.0f, Found);
+	TEST_EQUAL(Found.Num(), 1, "Aliased bucket entries outside the range should be filtered");
+
+	// Re-adding moves the entity to its new lane/bucket
+	Index.Add(Entities[0], 2, 2600.0f);
+	Found.Reset();
+	Index.Query(2, 2, 2000.0f, 3000.0f, Found);
+	TEST_EQUAL(Found.Num(), 2, "Moved entity should be found in its new lane");
+	TEST_EQUAL(Index.Num(), 4, "Moving should not duplicate the entity");
+
+	// Removing patches the swapped entry so it can still be removed later
+	TEST_TRUE(Index.Remove(Entities[3]), "Indexed entity should be removed");
+	TEST_TRUE(Index.Remove(Entities[0]), "Swapped entity should still be removable");
+	TEST_FALSE(Index.Remove(Entities[0]), "Removing twice should be a no-op");
+	TEST_EQUAL(Index.Num(), 2, "Two entities should remain");
+
+	// Cleanup
+	for (AActor* Entity : Entities)
+	{
+		if (Entity)
+		{
+			Entity->Destroy();
+		}
+	}
+
+	TEST_SUCCESS("WorldScrollTest_LaneDistanceIndex");
+}
+
 /**
  * Test: Run All World Scroll Tests
  * Comprehensive test that runs all world scroll tests and provides a detailed summary
@@ -1565,7 +3505,9 @@ static bool WorldScrollTest_TestAll()
 		{ TEXT("Scroll Velocity Calculation"), &WorldScrollTest_ScrollVelocity, false },
 		{ TEXT("Runtime Speed Changes"), &WorldScrollTest_ScrollSpeedChange, false },
 		{ TEXT("Direction Normalization"), &WorldScrollTest_DirectionNormalization, false },
-		{ TEXT("Distance Counter Reset"), &WorldScrollTest_DistanceReset, false }
+		{ TEXT("Distance Counter Reset"), &WorldScrollTest_DistanceReset, false },
+		{ TEXT("Scroll Mover Subsystem"), &WorldScrollTest_ScrollMoverSubsystem, false },
+		{ TEXT("Lane Distance Index"), &WorldScrollTest_LaneDistanceIndex, false }
 	};
 
 	TotalTests = Tests.Num();
@@ -1653,6 +3595,17 @@ void RegisterObjectPoolTests(UTestManager* TestManager)
 	TestManager->RegisterTest(TEXT("ObjectPool_ActiveCount"), ETestCategory::ObjectPool, &ObjectPoolTest_ActiveCount);
 	TestManager->RegisterTest(TEXT("ObjectPool_AutoExpand"), ETestCategory::ObjectPool, &ObjectPoolTest_AutoExpand);
 	TestManager->RegisterTest(TEXT("ObjectPool_ResetPool"), ETestCategory::ObjectPool, &ObjectPoolTest_ResetPool);
+	TestManager->RegisterTest(TEXT("ObjectPool_OutOfOrderReturn"), ETestCategory::ObjectPool, &ObjectPoolTest_OutOfOrderReturn);
+	TestManager->RegisterTest(TEXT("ObjectPool_TimeSlicedPrewarm"), ETestCategory::ObjectPool, &ObjectPoolTest_TimeSlicedPrewarm);
+	TestManager->RegisterTest(TEXT("ObjectPool_PoolStats"), ETestCategory::ObjectPool, &ObjectPoolTest_PoolStats);
+	TestManager->RegisterTest(TEXT("ObjectPool_PooledActorHandles"), ETestCategory::ObjectPool, &ObjectPoolTest_PooledActorHandles);
+	TestManager->RegisterTest(TEXT("ObjectPool_AdaptiveTargetSize"), ETestCategory::ObjectPool, &ObjectPoolTest_AdaptiveTargetSize);
+	TestManager->RegisterTest(TEXT("ObjectPool_SubsystemSharing"), ETestCategory::ObjectPool, &ObjectPoolTest_SubsystemSharing);
+	TestManager->RegisterTest(TEXT("ObjectPool_BatchAcquireRelease"), ETestCategory::ObjectPool, &ObjectPoolTest_BatchAcquireRelease);
+	TestManager->RegisterTest(TEXT("ObjectPool_DeferredStateChanges"), ETestCategory::ObjectPool, &ObjectPoolTest_DeferredStateChanges);
+	TestManager->RegisterTest(TEXT("ObjectPool_PoolCacheAcrossLevels"), ETestCategory::ObjectPool, &ObjectPoolTest_PoolCacheAcrossLevels);
+	TestManager->RegisterTest(TEXT("ObjectPool_RestartRunState"), ETestCategory::Economy, &ObjectPoolTest_RestartRunState);
+	TestManager->RegisterTest(TEXT("ObjectPool_AssetPreload"), ETestCategory::ObjectPool, &ObjectPoolTest_AssetPreload);
 
 	// Register ground tile tests
 	TestManager->RegisterTest(TEXT("GroundTile_PoolRecycling"), ETestCategory::ObjectPool, &GroundTileTest_TilePoolRecycling);
@@ -1660,6 +3613,8 @@ void RegisterObjectPoolTests(UTestManager* TestManager)
 	TestManager->RegisterTest(TEXT("GroundTile_Positioning"), ETestCategory::Movement, &GroundTileTest_TilePositioning);
 	TestManager->RegisterTest(TEXT("GroundTile_PoolSize"), ETestCategory::ObjectPool, &GroundTileTest_PoolSize);
 	TestManager->RegisterTest(TEXT("GroundTile_Despawn"), ETestCategory::Movement, &GroundTileTest_TileDespawn);
+	TestManager->RegisterTest(TEXT("GroundTile_InstancedRoadRecycling"), ETestCategory::Movement, &GroundTileTest_InstancedRoadRecycling);
+	TestManager->RegisterTest(TEXT("GroundTile_AnalyticPlacement"), ETestCategory::Movement, &GroundTileTest_AnalyticPlacement);
 
 	// Register turret tests
 	TestManager->RegisterTest(TEXT("Turret_Spawn"), ETestCategory::Combat, &TurretTest_TurretSpawn);
@@ -1670,6 +3625,17 @@ void RegisterObjectPoolTests(UTestManager* TestManager)
 	TestManager->RegisterTest(TEXT("Turret_AttributeClamping"), ETestCategory::GAS, &TurretTest_AttributeClamping);
 	TestManager->RegisterTest(TEXT("Turret_MountPointIntegration"), ETestCategory::Combat, &TurretTest_MountPointIntegration);
 	TestManager->RegisterTest(TEXT("Turret_AbilitySystemIntegration"), ETestCategory::GAS, &TurretTest_AbilitySystemIntegration);
+	TestManager->RegisterTest(TEXT("Turret_SharedTargeting"), ETestCategory::Combat, &TurretTest_SharedTargeting);
+	TestManager->RegisterTest(TEXT("Turret_TargetStickiness"), ETestCategory::Combat, &TurretTest_TargetStickiness);
+	TestManager->RegisterTest(TEXT("Turret_TargetingKernel"), ETestCategory::Combat, &TurretTest_TargetingKernel);
+	TestManager->RegisterTest(TEXT("Turret_ProjectileSystem"), ETestCategory::Combat, &TurretTest_ProjectileSystem);
+	TestManager->RegisterTest(TEXT("Turret_LaneIndexCandidates"), ETestCategory::Combat, &TurretTest_LaneIndexCandidates);
+	TestManager->RegisterTest(TEXT("Turret_AsyncTraces"), ETestCategory::Combat, &TurretTest_AsyncTraces);
+	TestManager->RegisterTest(TEXT("Turret_FireScheduler"), ETestCategory::Combat, &TurretTest_FireScheduler);
+	TestManager->RegisterTest(TEXT("Turret_FireSchedulerWheel"), ETestCategory::Combat, &TurretTest_FireSchedulerWheel);
+	TestManager->RegisterTest(TEXT("Turret_LightweightAbilitySystem"), ETestCategory::GAS, &TurretTest_LightweightAbilitySystem);
+	TestManager->RegisterTest(TEXT("Turret_Pooling"), ETestCategory::GAS, &TurretTest_Pooling);
+	TestManager->RegisterTest(TEXT("Turret_RigSwap"), ETestCategory::Combat, &TurretTest_RigSwapRehomesTurrets);
 
 	// Register world scroll tests
 	TestManager->RegisterTest(TEXT("WorldScroll_ScrollSpeedConsistency"), ETestCategory::Movement, &WorldScrollTest_ScrollSpeedConsistency);
@@ -1679,6 +3645,8 @@ void RegisterObjectPoolTests(UTestManager* TestManager)
 	TestManager->RegisterTest(TEXT("WorldScroll_ScrollSpeedChange"), ETestCategory::Movement, &WorldScrollTest_ScrollSpeedChange);
 	TestManager->RegisterTest(TEXT("WorldScroll_DirectionNormalization"), ETestCategory::Movement, &WorldScrollTest_DirectionNormalization);
 	TestManager->RegisterTest(TEXT("WorldScroll_DistanceReset"), ETestCategory::Movement, &WorldScrollTest_DistanceReset);
+	TestManager->RegisterTest(TEXT("WorldScroll_ScrollMoverSubsystem"), ETestCategory::Movement, &WorldScrollTest_ScrollMoverSubsystem);
+	TestManager->RegisterTest(TEXT("WorldScroll_LaneDistanceIndex"), ETestCategory::Movement, &WorldScrollTest_LaneDistanceIndex);
 	TestManager->RegisterTest(TEXT("WorldScroll_TestAll"), ETestCategory::Movement, &WorldScrollTest_TestAll);
 }
 
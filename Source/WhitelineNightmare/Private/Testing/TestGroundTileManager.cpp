@@ -0,0 +1,80 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Testing/TestGroundTileManager.h"
+#include "World/GroundTile.h"
+#include "Core/ObjectPoolComponent.h"
+#include "Core/ObjectPoolTypes.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+UTestGroundTileManager::UTestGroundTileManager()
+{
+	// Tests step the road themselves
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UTestGroundTileManager::ConfigureRoad(bool bInstanced, bool bAnalytic, float InTileSize, float InSpawnDistance, float InDespawnDistance)
+{
+	bUseInstancedRoad = bInstanced;
+	bAnalyticTilePlacement = bAnalytic;
+	TileClass = AGroundTile::StaticClass();
+	TileSize = InTileSize;
+	TileSpawnDistance = InSpawnDistance;
+	TileDespawnDistance = InDespawnDistance;
+}
+
+float UTestGroundTileManager::GetRoadInstanceWorldX(int32 Offset) const
+{
+	const int32 NumInstances = RoadInstanceLocalX.Num();
+	if (!RoadInstances || NumInstances == 0)
+	{
+		return 0.0f;
+	}
+
+	return RoadInstances->GetComponentLocation().X + RoadInstanceLocalX[(RoadRingHead + Offset) % NumInstances];
+}
+
+float UTestGroundTileManager::GetRoadInstanceRenderedX(int32 Offset) const
+{
+	const int32 NumInstances = RoadInstanceLocalX.Num();
+	if (!RoadInstances || NumInstances == 0)
+	{
+		return 0.0f;
+	}
+
+	FTransform InstanceTransform;
+	RoadInstances->GetInstanceTransform((RoadRingHead + Offset) % NumInstances, InstanceTransform, true);
+	return InstanceTransform.GetLocation().X - RoadInstanceBaseTransform.GetLocation().X;
+}
+
+float UTestGroundTileManager::GetTileWorldX(int32 Offset) const
+{
+	if (Offset < 0 || Offset >= ActiveTileCount)
+	{
+		return 0.0f;
+	}
+
+	const AGroundTile* Tile = ActiveTiles[(ActiveTileHead + Offset) % ActiveTiles.Num()];
+	return Tile ? Tile->GetActorLocation().X : 0.0f;
+}
+
+void UTestGroundTileManager::ReleaseTestTiles()
+{
+	for (int32 i = 0; i < ActiveTileCount; ++i)
+	{
+		const int32 RingIndex = (ActiveTileHead + i) % ActiveTiles.Num();
+		if (AGroundTile* Tile = ActiveTiles[RingIndex])
+		{
+			IPoolableActor::Execute_OnDeactivated(Tile);
+		}
+		if (TilePool)
+		{
+			TilePool->ReturnToPoolByHandle(ActiveTileHandles[RingIndex]);
+		}
+		ActiveTiles[RingIndex] = nullptr;
+		ActiveTileHandles[RingIndex] = FPooledActorHandle();
+	}
+
+	ActiveTileHead = 0;
+	ActiveTileCount = 0;
+	bAnalyticRoadAnchored = false;
+}
@@ -12,3 +12,15 @@ void ATestTurret::Fire()
 	// Call base class implementation for testing
 	Super::Fire();
 }
+
+double ATestTurret::ProcessScheduledFire(double DueTime, double Now)
+{
+	if (ScriptedWakeInterval <= 0.0)
+	{
+		return Super::ProcessScheduledFire(DueTime, Now);
+	}
+
+	ScheduledWakeDueTimes.Add(DueTime);
+	ScheduledWakeTimes.Add(Now);
+	return DueTime + ScriptedWakeInterval;
+}
@@ -0,0 +1,478 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Turrets/ProjectileSubsystem.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "Core/WorldScrollComponent.h"
+#include "GAS/Attributes/CombatAttributeSet.h"
+#include "GAS/GameplayEffect_Damage.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+
+void FProjectileTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->TickProjectiles(DeltaTime);
+	}
+}
+
+FString FProjectileTickFunction::DiagnosticMessage()
+{
+	return TEXT("UProjectileSubsystem::TickProjectiles");
+}
+
+void FProjectileBatch::Add(const FProjectileSpawnParams& Params, const FQuat4f& InRotation)
+{
+	const FVector Velocity = Params.Direction * Params.Speed;
+
+	PositionX.Add(Params.Origin.X);
+	PositionY.Add(Params.Origin.Y);
+	PositionZ.Add(Params.Origin.Z);
+	VelocityX.Add(Velocity.X);
+	VelocityY.Add(Velocity.Y);
+	VelocityZ.Add(Velocity.Z);
+	ScrollScale.Add(Params.bMovesWithRoad ? 1.0f : 0.0f);
+	Damage.Add(Params.Damage);
+	Radius.Add(FMath::Max(Params.Radius, 0.0f));
+	TimeRemaining.Add(Params.Lifetime);
+	HeadStart.Add(FMath::Max(Params.HeadStart, 0.0f));
+	MeshScale.Add(Params.MeshScale);
+	Rotation.Add(InRotation);
+	Instigator.Add(Params.Instigator);
+	IgnoredActor.Add(Params.IgnoredActor);
+	PreviousX.Add(Params.Origin.X);
+	PreviousY.Add(Params.Origin.Y);
+	PreviousZ.Add(Params.Origin.Z);
+}
+
+void FProjectileBatch::RemoveAtSwap(int32 Index)
+{
+	PositionX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VelocityX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VelocityY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VelocityZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ScrollScale.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damage.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radius.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TimeRemaining.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HeadStart.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MeshScale.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Rotation.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigator.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	IgnoredActor.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PreviousX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PreviousY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PreviousZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FProjectileBatch::Reset()
+{
+	PositionX.Reset();
+	PositionY.Reset();
+	PositionZ.Reset();
+	VelocityX.Reset();
+	VelocityY.Reset();
+	VelocityZ.Reset();
+	ScrollScale.Reset();
+	Damage.Reset();
+	Radius.Reset();
+	TimeRemaining.Reset();
+	HeadStart.Reset();
+	MeshScale.Reset();
+	Rotation.Reset();
+	Instigator.Reset();
+	IgnoredActor.Reset();
+	PreviousX.Reset();
+	PreviousY.Reset();
+	PreviousZ.Reset();
+}
+
+void UProjectileSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Post-physics so hits are tested against this frame's final target positions
+	ProjectileTickFunction.Target = this;
+	ProjectileTickFunction.bCanEverTick = true;
+	ProjectileTickFunction.bStartWithTickEnabled = true;
+	ProjectileTickFunction.TickGroup = TG_PostPhysics;
+	ProjectileTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UProjectileSubsystem::Deinitialize()
+{
+	if (ProjectileTickFunction.IsTickFunctionRegistered())
+	{
+		ProjectileTickFunction.UnRegisterTickFunction();
+	}
+	ProjectileTickFunction.Target = nullptr;
+
+	Batches.Empty();
+	HitCandidateActors.Empty();
+	HitCandidateLocations.Empty();
+	HitCandidateRadii.Empty();
+	RenderActor = nullptr;
+	ProjectileCount = 0;
+
+	Super::Deinitialize();
+}
+
+bool UProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UProjectileSubsystem* UProjectileSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UProjectileSubsystem>() : nullptr;
+}
+
+bool UProjectileSubsystem::FireProjectile(const FProjectileSpawnParams& Params)
+{
+	if (ProjectileCount >= MaxProjectiles)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ProjectileSubsystem: Projectile limit (%d) reached, shot dropped"), MaxProjectiles);
+		return false;
+	}
+
+	const FVector Direction = Params.Direction.GetSafeNormal();
+	if (Direction.IsZero() || Params.Speed <= 0.0f || Params.Lifetime <= 0.0f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProjectileSubsystem: Invalid projectile (direction %s, speed %.1f, lifetime %.2f)"),
+			*Params.Direction.ToString(), Params.Speed, Params.Lifetime);
+		return false;
+	}
+
+	FProjectileSpawnParams Normalized = Params;
+	Normalized.Direction = Direction;
+
+	const int32 BatchIndex = GetOrCreateBatch(Params.Mesh);
+	Batches[BatchIndex].Add(Normalized, FQuat4f(Direction.ToOrientationQuat()));
+	++ProjectileCount;
+	return true;
+}
+
+void UProjectileSubsystem::ClearProjectiles()
+{
+	for (FProjectileBatch& Batch : Batches)
+	{
+		Batch.Reset();
+		UpdateBatchInstances(Batch);
+	}
+	ProjectileCount = 0;
+}
+
+void UProjectileSubsystem::TickProjectiles(float DeltaTime)
+{
+	if (ProjectileCount == 0)
+	{
+		return;
+	}
+
+	// Rounds that move with the road pick up the world scroll velocity
+	FVector3f ScrollVelocity = FVector3f::ZeroVector;
+	if (const UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		if (const UWorldScrollComponent* ScrollSource = ScrollMovers->GetScrollSource())
+		{
+			ScrollVelocity = FVector3f(ScrollSource->GetScrollVelocity());
+		}
+	}
+
+	// Pass 1: integrate every projectile and bound the swept segments
+	FBox SweepBounds(ForceInit);
+	float MaxRadius = 0.0f;
+
+	for (FProjectileBatch& Batch : Batches)
+	{
+		const int32 Num = Batch.Num();
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Batch.PreviousX[i] = Batch.PositionX[i];
+			Batch.PreviousY[i] = Batch.PositionY[i];
+			Batch.PreviousZ[i] = Batch.PositionZ[i];
+
+			// A round launched late in its frame catches up on its first update (still swept from its origin)
+			const float StepTime = DeltaTime + Batch.HeadStart[i];
+			Batch.HeadStart[i] = 0.0f;
+
+			Batch.PositionX[i] += (Batch.VelocityX[i] + ScrollVelocity.X * Batch.ScrollScale[i]) * StepTime;
+			Batch.PositionY[i] += (Batch.VelocityY[i] + ScrollVelocity.Y * Batch.ScrollScale[i]) * StepTime;
+			Batch.PositionZ[i] += (Batch.VelocityZ[i] + ScrollVelocity.Z * Batch.ScrollScale[i]) * StepTime;
+			Batch.TimeRemaining[i] -= StepTime;
+
+			SweepBounds += FVector(Batch.PreviousX[i], Batch.PreviousY[i], Batch.PreviousZ[i]);
+			SweepBounds += FVector(Batch.PositionX[i], Batch.PositionY[i], Batch.PositionZ[i]);
+			MaxRadius = FMath::Max(MaxRadius, Batch.Radius[i]);
+		}
+	}
+
+	// One candidate gather for every projectile
+	GatherHitCandidates(SweepBounds.ExpandBy(MaxRadius));
+
+	// Pass 2: resolve hits and expiry (backwards so swap-removal is safe)
+	for (FProjectileBatch& Batch : Batches)
+	{
+		for (int32 i = Batch.Num() - 1; i >= 0; --i)
+		{
+			FVector HitLocation;
+			const int32 HitIndex = FindHitCandidate(Batch, i, HitLocation);
+			if (HitIndex != INDEX_NONE)
+			{
+				ApplyHit(HitCandidateActors[HitIndex], Batch.Damage[i], Batch.Instigator[i].Get(), HitLocation);
+			}
+			else if (Batch.TimeRemaining[i] > 0.0f)
+			{
+				continue;
+			}
+
+			Batch.RemoveAtSwap(i);
+			--ProjectileCount;
+		}
+
+		// Pass 3: render
+		UpdateBatchInstances(Batch);
+	}
+}
+
+int32 UProjectileSubsystem::GetOrCreateBatch(UStaticMesh* Mesh)
+{
+	const int32 Existing = Batches.IndexOfByPredicate([Mesh](const FProjectileBatch& Batch)
+	{
+		return Batch.Mesh == Mesh;
+	});
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	FProjectileBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Mesh = Mesh;
+
+	UWorld* World = GetWorld();
+	if (Mesh && World)
+	{
+		if (!RenderActor)
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.Name = MakeUniqueObjectName(World, AActor::StaticClass(), TEXT("ProjectileRenderer"));
+			SpawnParams.ObjectFlags |= RF_Transient;
+			RenderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		}
+
+		if (RenderActor)
+		{
+			Batch.Instances = NewObject<UInstancedStaticMeshComponent>(RenderActor);
+			Batch.Instances->SetMobility(EComponentMobility::Movable);
+			Batch.Instances->SetStaticMesh(Mesh);
+			Batch.Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Hits are resolved by the subsystem
+			Batch.Instances->SetCastShadow(false);
+			Batch.Instances->RegisterComponent();
+			RenderActor->AddInstanceComponent(Batch.Instances);
+		}
+	}
+
+	return Batches.Num() - 1;
+}
+
+void UProjectileSubsystem::GatherHitCandidates(const FBox& SweepBounds)
+{
+	HitCandidateActors.Reset();
+	HitCandidateLocations.Reset();
+	HitCandidateRadii.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World || !SweepBounds.IsValid)
+	{
+		return;
+	}
+
+	// One entry per actor: lane-indexed pawns are also found by the overlap
+	TSet<const AActor*> SeenActors;
+
+	// Lane-indexed pawns: walk the buckets covering the swept X range, including pawns without collision
+	if (const UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		TArray<AActor*> LaneActors;
+		ScrollMovers->QueryAllLanes(SweepBounds.Min.X, SweepBounds.Max.X, LaneActors);
+
+		for (AActor* Actor : LaneActors)
+		{
+			if (IsValid(Actor) && Actor->IsA<APawn>()
+				&& SweepBounds.ExpandBy(Actor->GetSimpleCollisionRadius()).IsInside(Actor->GetActorLocation()))
+			{
+				SeenActors.Add(Actor);
+				AddHitCandidate(Actor);
+			}
+		}
+	}
+
+	// Not every pawn is lane-indexed, so the overlap always runs
+	++OverlapQueryCount;
+	TArray<FOverlapResult> OverlapResults;
+	World->OverlapMultiByChannel(
+		OverlapResults,
+		SweepBounds.GetCenter(),
+		FQuat::Identity,
+		ECC_Pawn, // Look for pawns (enemies)
+		FCollisionShape::MakeBox(SweepBounds.GetExtent()),
+		FCollisionQueryParams(SCENE_QUERY_STAT(ProjectileHits), false)
+	);
+
+	SeenActors.Reserve(SeenActors.Num() + OverlapResults.Num());
+	for (const FOverlapResult& Result : OverlapResults)
+	{
+		AActor* Actor = Result.GetActor();
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		SeenActors.Add(Actor, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		AddHitCandidate(Actor);
+	}
+}
+
+void UProjectileSubsystem::AddHitCandidate(AActor* Actor)
+{
+	HitCandidateActors.Add(Actor);
+	HitCandidateLocations.Add(FVector3f(Actor->GetActorLocation()));
+	HitCandidateRadii.Add(Actor->GetSimpleCollisionRadius());
+}
+
+int32 UProjectileSubsystem::FindHitCandidate(const FProjectileBatch& Batch, int32 Index, FVector& OutHitLocation) const
+{
+	const FVector3f Start(Batch.PreviousX[Index], Batch.PreviousY[Index], Batch.PreviousZ[Index]);
+	const FVector3f End(Batch.PositionX[Index], Batch.PositionY[Index], Batch.PositionZ[Index]);
+	const FVector3f Segment = End - Start;
+	const float SegmentLengthSquared = Segment.SizeSquared();
+	const AActor* Instigator = Batch.Instigator[Index].Get();
+	const AActor* IgnoredActor = Batch.IgnoredActor[Index].Get();
+
+	int32 HitIndex = INDEX_NONE;
+	float FirstHitTime = 2.0f;
+
+	for (int32 c = 0; c < HitCandidateActors.Num(); ++c)
+	{
+		const AActor* Candidate = HitCandidateActors[c];
+		if (Candidate == Instigator || Candidate == IgnoredActor)
+		{
+			continue;
+		}
+
+		// Closest point on this frame's segment to the candidate
+		const FVector3f ToCandidate = HitCandidateLocations[c] - Start;
+		const float Time = SegmentLengthSquared > UE_SMALL_NUMBER
+			? FMath::Clamp(FVector3f::DotProduct(ToCandidate, Segment) / SegmentLengthSquared, 0.0f, 1.0f)
+			: 0.0f;
+		if (Time >= FirstHitTime)
+		{
+			continue;
+		}
+
+		const float HitDistance = Batch.Radius[Index] + HitCandidateRadii[c];
+		if ((ToCandidate - Segment * Time).SizeSquared() <= HitDistance * HitDistance)
+		{
+			FirstHitTime = Time;
+			HitIndex = c;
+		}
+	}
+
+	if (HitIndex != INDEX_NONE)
+	{
+		OutHitLocation = FVector(Start + Segment * FirstHitTime);
+	}
+	return HitIndex;
+}
+
+void UProjectileSubsystem::ApplyHit(AActor* HitActor, float Damage, AActor* Instigator, const FVector& HitLocation)
+{
+	if (!IsValid(HitActor))
+	{
+		return;
+	}
+
+	++HitCount;
+
+	UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
+	if (TargetASC && TargetASC->HasAttributeSetForAttribute(UCombatAttributeSet::GetHealthAttribute()))
+	{
+		// Route through a damage effect so attribute callbacks, tags and immunities apply
+		FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
+		EffectContext.AddInstigator(Instigator, Instigator);
+		EffectContext.AddHitResult(FHitResult(HitActor, nullptr, HitLocation, FVector::ZeroVector));
+
+		FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(UGameplayEffect_Damage::StaticClass(), 1.0f, EffectContext);
+		if (SpecHandle.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(UGameplayEffect_Damage::GetDamageDataTag(), -Damage);
+			TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		}
+	}
+	else
+	{
+		UGameplayStatics::ApplyDamage(HitActor, Damage, nullptr, Instigator, nullptr);
+	}
+
+	OnProjectileHit.Broadcast(HitActor, Damage, HitLocation);
+}
+
+void UProjectileSubsystem::UpdateBatchInstances(FProjectileBatch& Batch)
+{
+	UInstancedStaticMeshComponent* Instances = Batch.Instances;
+	if (!Instances)
+	{
+		return;
+	}
+
+	const int32 Num = Batch.Num();
+
+	// Grow the instance list when needed; shrinking only hides instances so the buffer isn't reallocated
+	const int32 InstanceCount = Instances->GetInstanceCount();
+	if (InstanceCount < Num)
+	{
+		TArray<FTransform> NewInstances;
+		NewInstances.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), Num - InstanceCount);
+		Instances->AddInstances(NewInstances, false);
+	}
+
+	const int32 NumToWrite = FMath::Max(Num, Batch.VisibleInstanceCount);
+	if (NumToWrite == 0)
+	{
+		return;
+	}
+
+	InstanceTransforms.Reset(NumToWrite);
+	for (int32 i = 0; i < Num; ++i)
+	{
+		InstanceTransforms.Emplace(
+			FQuat(Batch.Rotation[i]),
+			FVector(Batch.PositionX[i], Batch.PositionY[i], Batch.PositionZ[i]),
+			FVector(Batch.MeshScale[i]));
+	}
+	for (int32 i = Num; i < NumToWrite; ++i)
+	{
+		InstanceTransforms.Emplace(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	}
+
+	Instances->BatchUpdateInstancesTransforms(0, InstanceTransforms, false, true, true);
+	Batch.VisibleInstanceCount = Num;
+}
@@ -1,10 +1,15 @@
 // Copyright Flatlander81. All Rights Reserved.
 
 #include "Turrets/TurretBase.h"
+#include "Turrets/TurretTargetingSubsystem.h"
+#include "Turrets/ProjectileSubsystem.h"
+#include "Turrets/TurretTraceSubsystem.h"
+#include "Turrets/TurretFireSchedulerSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "GAS/Attributes/CombatAttributeSet.h"
 #include "Core/WarRigPawn.h"
 #include "Core/GameDataStructs.h"
+#include "Core/AssetPreloadSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "DrawDebugHelpers.h"
@@ -34,6 +39,7 @@ ATurretBase::ATurretBase()
 		TurretMesh->SetStaticMesh(SphereMeshAsset.Object);
 		TurretMesh->SetRelativeScale3D(FVector(0.5f)); // Make it smaller (50cm radius instead of 100cm)
 	}
+	ProjectileMesh = SphereMeshAsset.Succeeded() ? SphereMeshAsset.Object : nullptr;
 
 	// Create Ability System Component
 	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
@@ -49,6 +55,13 @@ ATurretBase::ATurretBase()
 	OwnerWarRig = nullptr;
 	CurrentTarget = nullptr;
 	TimeSinceLastFire = 0.0f;
+	ShotTimeOffset = 0.0f;
+	LastScheduledWakeTime = -1.0;
+	TargetReevaluationInterval = 0.25f;
+	bRequireLineOfSight = true;
+	ProjectileSpeed = 5000.0f;
+	ProjectileRadius = 10.0f;
+	TimeUntilTargetReevaluation = 0.0f;
 
 	// Debug visualization defaults
 	bShowDebugVisualization = false;
@@ -74,33 +87,131 @@ void ATurretBase::BeginPlay()
 	{
 		UE_LOG(LogTemp, Error, TEXT("ATurretBase::BeginPlay: Turret setup validation failed for %s"), *GetName());
 	}
+
+	// Turret subsystems pick the turret up once Initialize mounts it (idle pooled turrets stay out of them)
+}
+
+void ATurretBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromTurretSubsystems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATurretBase::OnActivated_Implementation()
+{
+	// Taken from the pool unmounted: stay idle until Initialize mounts the turret
+	SetActorTickEnabled(false);
+}
+
+void ATurretBase::OnDeactivated_Implementation()
+{
+	// A sold turret goes back to the pool clean
+	IPoolableActor::Execute_ResetState(this);
+}
+
+void ATurretBase::ResetState_Implementation()
+{
+	DetachFromMount();
+
+	// Effects applied while mounted (buffs, damage over time) don't follow the turret into the pool,
+	// and an idle turret's ability system doesn't replicate or tick
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+	}
+	SetAbilitySystemActive(false);
+
+	// Restore the attribute set's defaults (Initialize applies the data table values on the next placement)
+	if (CombatAttributes)
+	{
+		const UCombatAttributeSet* Defaults = GetDefault<UCombatAttributeSet>(CombatAttributes->GetClass());
+		CombatAttributes->InitMaxHealth(Defaults->GetMaxHealth());
+		CombatAttributes->InitHealth(Defaults->GetMaxHealth());
+		CombatAttributes->InitDamage(Defaults->GetDamage());
+		CombatAttributes->InitFireRate(Defaults->GetFireRate());
+		CombatAttributes->InitRange(Defaults->GetRange());
+	}
+
+	CurrentTarget = nullptr;
+	TimeSinceLastFire = 0.0f;
+	TimeUntilTargetReevaluation = 0.0f;
+	ShotTimeOffset = 0.0f;
+	LastScheduledWakeTime = -1.0;
+}
+
+void ATurretBase::DetachFromMount()
+{
+	UnregisterFromTurretSubsystems();
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	MountIndex = -1;
+	FacingDirection = FRotator::ZeroRotator;
+	OwnerWarRig = nullptr;
+}
+
+void ATurretBase::RegisterWithTurretSubsystems()
+{
+	// Share the per-frame candidate query with every other turret
+	if (UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this))
+	{
+		Targeting->RegisterTurret(this);
+	}
+
+	// The fire scheduler wakes the turret when a shot is due; the actor only ticks to draw debug
+	UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(this);
+	if (FireScheduler)
+	{
+		FireScheduler->RegisterTurret(this);
+	}
+	SetActorTickEnabled(!FireScheduler || bShowDebugVisualization);
+}
+
+void ATurretBase::UnregisterFromTurretSubsystems()
+{
+	if (UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this))
+	{
+		Targeting->UnregisterTurret(this);
+	}
+
+	if (UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(this))
+	{
+		FireScheduler->UnregisterTurret(this);
+	}
 }
 
 void ATurretBase::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Update time since last fire
-	TimeSinceLastFire += DeltaTime;
+	// Keep or re-acquire target
+	UpdateTarget(DeltaTime);
 
-	// Find and track target
-	AActor* NewTarget = FindTarget();
-	if (NewTarget != CurrentTarget)
+	// Scheduled turrets are fired by the fire scheduler; firing here is the fallback for worlds without one
+	const UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(this);
+	const bool bScheduled = FireScheduler && FireScheduler->IsTurretRegistered(this);
+	if (bScheduled && !bShowDebugVisualization)
 	{
-		CurrentTarget = NewTarget;
+		// Something (e.g. pool activation) switched the tick back on; nothing to do here
+		SetActorTickEnabled(false);
 	}
-
-	// Auto-fire if we have a target and fire rate allows
-	if (CurrentTarget && CombatAttributes)
+	else if (!bScheduled)
 	{
-		const float FireRate = CombatAttributes->GetFireRate();
-		if (FireRate > 0.0f)
+		// Update time since last fire
+		TimeSinceLastFire += DeltaTime;
+
+		// Auto-fire if we have a target and fire rate allows
+		if (CurrentTarget && CombatAttributes)
 		{
-			const float FireInterval = 1.0f / FireRate;
-			if (TimeSinceLastFire >= FireInterval)
+			const float FireRate = CombatAttributes->GetFireRate();
+			if (FireRate > 0.0f)
 			{
-				Fire();
-				TimeSinceLastFire = 0.0f;
+				const float FireInterval = 1.0f / FireRate;
+				if (TimeSinceLastFire >= FireInterval)
+				{
+					Fire();
+					TimeSinceLastFire = 0.0f;
+				}
 			}
 		}
 	}
@@ -117,6 +228,23 @@ UAbilitySystemComponent* ATurretBase::GetAbilitySystemComponent() const
 	return AbilitySystemComponent;
 }
 
+bool ATurretBase::IsAbilitySystemActive() const
+{
+	return AbilitySystemComponent && AbilitySystemComponent->GetIsReplicated() && AbilitySystemComponent->IsComponentTickEnabled();
+}
+
+void ATurretBase::SetAbilitySystemActive(bool bActive)
+{
+	if (!AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Effect durations and periods run on world timers, so attributes and effects don't need the tick
+	AbilitySystemComponent->SetIsReplicated(bActive);
+	AbilitySystemComponent->SetComponentTickEnabled(bActive);
+}
+
 void ATurretBase::Initialize(const FTurretData& TurretData, int32 InMountIndex, const FRotator& InFacingDirection, AWarRigPawn* InOwnerWarRig)
 {
 	// Validate inputs
@@ -137,10 +265,13 @@ void ATurretBase::Initialize(const FTurretData& TurretData, int32 InMountIndex,
 	FacingDirection = InFacingDirection;
 	OwnerWarRig = InOwnerWarRig;
 
+	// Stagger target re-evaluation across mounts so a full rig doesn't re-acquire on the same frame
+	TimeUntilTargetReevaluation = TargetReevaluationInterval * FMath::Frac(InMountIndex * UE_GOLDEN_RATIO);
+
 	// Set turret mesh if provided
 	if (TurretData.TurretMesh.IsValid() || !TurretData.TurretMesh.IsNull())
 	{
-		if (UStaticMesh* Mesh = TurretData.TurretMesh.LoadSynchronous())
+		if (UStaticMesh* Mesh = UAssetPreloadSubsystem::ResolveAsset(this, TurretData.TurretMesh))
 		{
 			TurretMesh->SetStaticMesh(Mesh);
 		}
@@ -150,6 +281,17 @@ void ATurretBase::Initialize(const FTurretData& TurretData, int32 InMountIndex,
 		}
 	}
 
+	// Projectile settings (the mesh is instanced by the projectile subsystem, so resolve it once here)
+	ProjectileSpeed = TurretData.ProjectileSpeed;
+	ProjectileRadius = TurretData.ProjectileRadius;
+	if (!TurretData.ProjectileMesh.IsNull())
+	{
+		if (UStaticMesh* Mesh = UAssetPreloadSubsystem::ResolveAsset(this, TurretData.ProjectileMesh))
+		{
+			ProjectileMesh = Mesh;
+		}
+	}
+
 	// Initialize attributes from data table
 	if (CombatAttributes && AbilitySystemComponent)
 	{
@@ -171,6 +313,18 @@ void ATurretBase::Initialize(const FTurretData& TurretData, int32 InMountIndex,
 	{
 		UE_LOG(LogTemp, Error, TEXT("ATurretBase::Initialize: Missing CombatAttributes or AbilitySystemComponent for turret %s"), *GetName());
 	}
+
+	// Lightweight rigs keep mounted turrets' ability systems off the network and out of the tick
+	SetAbilitySystemActive(!OwnerWarRig->UsesLightweightTurretAbilitySystems());
+
+	// Range and owner feed the shared candidate query
+	if (UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this))
+	{
+		Targeting->InvalidateCandidates();
+	}
+
+	// Mounted: join the shared targeting query and the fire scheduler
+	RegisterWithTurretSubsystems();
 }
 
 void ATurretBase::Fire()
@@ -187,16 +341,89 @@ void ATurretBase::Fire()
 		return;
 	}
 
-	// Log fire event (subclasses will implement actual projectile/damage logic)
-	UE_LOG(LogTemp, Log, TEXT("ATurretBase::Fire: Turret firing at target %s (Damage: %.1f)"),
+	UE_LOG(LogTemp, Verbose, TEXT("ATurretBase::Fire: Turret firing at target %s (Damage: %.1f)"),
 		*CurrentTarget->GetName(),
 		CombatAttributes->GetDamage());
 
+	const FVector Origin = GetActorLocation();
+	const FVector Direction = (CurrentTarget->GetActorLocation() - Origin).GetSafeNormal();
+
+	// Hitscan weapons trace asynchronously; damage lands when the trace completes
+	if (ProjectileSpeed <= 0.0f)
+	{
+		if (UTurretTraceSubsystem* Traces = UTurretTraceSubsystem::Get(this))
+		{
+			Traces->RequestHitscan(this, Origin, Origin + Direction * CombatAttributes->GetRange(), CombatAttributes->GetDamage());
+		}
+		return;
+	}
+
+	// Rounds are data in the projectile subsystem, not actors
+	UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(this);
+	if (!Projectiles)
+	{
+		return;
+	}
+
+	FProjectileSpawnParams Params;
+	Params.Origin = Origin;
+	Params.Direction = Direction;
+	Params.Speed = ProjectileSpeed;
+	Params.Damage = CombatAttributes->GetDamage();
+	Params.Radius = ProjectileRadius;
+	Params.Lifetime = 1.1f * CombatAttributes->GetRange() / ProjectileSpeed; // Expire just past max range
+	Params.HeadStart = ShotTimeOffset; // Shot due earlier in the frame
+	Params.Mesh = ProjectileMesh;
+	Params.Instigator = this;
+	Params.IgnoredActor = OwnerWarRig;
+	Projectiles->FireProjectile(Params);
+
 	// Future implementation will:
-	// 1. Spawn projectile
-	// 2. Apply damage via gameplay effect
-	// 3. Play firing animation/sound
-	// 4. Apply recoil/visual feedback
+	// 1. Play firing animation/sound
+	// 2. Apply recoil/visual feedback
+}
+
+double ATurretBase::ProcessScheduledFire(double DueTime, double Now)
+{
+	const float Elapsed = LastScheduledWakeTime >= 0.0 ? static_cast<float>(Now - LastScheduledWakeTime) : 0.0f;
+	LastScheduledWakeTime = Now;
+	TimeSinceLastFire += Elapsed;
+
+	// A turret ticking for debug drawing already updates its target every frame
+	if (!IsActorTickEnabled())
+	{
+		UpdateTarget(Elapsed);
+	}
+
+	const float FireRate = CombatAttributes ? CombatAttributes->GetFireRate() : 0.0f;
+	if (!CurrentTarget || FireRate <= 0.0f)
+	{
+		// Nothing to shoot: look again after the re-evaluation interval
+		return Now + FMath::Max<double>(TargetReevaluationInterval, UTurretFireSchedulerSubsystem::SlotDuration);
+	}
+
+	// A backlog older than MaxFireBacklog (a long hitch) is dropped rather than fired as a burst;
+	// the shots kept stay on the original cadence
+	const double FireInterval = 1.0 / FireRate;
+	double ShotTime = DueTime;
+	const double OldestShotTime = Now - UTurretFireSchedulerSubsystem::MaxFireBacklog;
+	if (ShotTime < OldestShotTime)
+	{
+		ShotTime += FMath::CeilToDouble((OldestShotTime - ShotTime) / FireInterval) * FireInterval;
+	}
+
+	// Fire every remaining shot due since the last wake, each at its own time
+	while (ShotTime <= Now && IsValid(CurrentTarget))
+	{
+		ShotTimeOffset = static_cast<float>(Now - ShotTime);
+		Fire();
+		TimeSinceLastFire = ShotTimeOffset;
+		ShotTime += FireInterval;
+	}
+	ShotTimeOffset = 0.0f;
+
+	// Losing the target mid-backlog drops the rest of it
+	return ShotTime > Now ? ShotTime : Now + FireInterval;
 }
 
 AActor* ATurretBase::FindTarget()
@@ -206,6 +433,13 @@ AActor* ATurretBase::FindTarget()
 		return nullptr; // Graceful null handling
 	}
 
+	// Resolve from the shared per-frame candidates when registered
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this);
+	if (Targeting && Targeting->IsTurretRegistered(this))
+	{
+		return Targeting->FindBestTarget(this);
+	}
+
 	// Get all potential targets in range
 	TArray<AActor*> PotentialTargets = GetPotentialTargets();
 
@@ -238,6 +472,64 @@ AActor* ATurretBase::FindTarget()
 	return BestTarget; // Returns nullptr if no valid targets
 }
 
+void ATurretBase::UpdateTarget(float DeltaTime)
+{
+	TimeUntilTargetReevaluation -= DeltaTime;
+
+	// The one line-of-sight refresh of this update; validity checks below only read the cache
+	if (bRequireLineOfSight && IsValid(CurrentTarget))
+	{
+		if (UTurretTraceSubsystem* Traces = UTurretTraceSubsystem::Get(this))
+		{
+			Traces->RefreshLineOfSight(this, CurrentTarget);
+		}
+	}
+
+	// A lost target is dropped immediately and re-acquisition is due right away
+	const bool bTargetLost = CurrentTarget && !IsTargetEngageable(CurrentTarget);
+	if (bTargetLost)
+	{
+		CurrentTarget = nullptr;
+		TimeUntilTargetReevaluation = 0.0f;
+	}
+
+	UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this);
+
+	if (TimeUntilTargetReevaluation > 0.0f)
+	{
+		if (CurrentTarget && Targeting && Targeting->IsQualitySamplingEnabled())
+		{
+			Targeting->RecordQualitySample(this, CurrentTarget);
+		}
+		return;
+	}
+
+	// Over budget: keep what we have and try again next frame
+	if (Targeting && !Targeting->TryConsumeReacquisitionBudget())
+	{
+		return;
+	}
+
+	CurrentTarget = FindTarget();
+	TimeUntilTargetReevaluation = TargetReevaluationInterval;
+}
+
+bool ATurretBase::IsTargetEngageable(AActor* Target) const
+{
+	if (!IsTargetValid(Target) || !CombatAttributes)
+	{
+		return false;
+	}
+
+	const FVector TargetLocation = Target->GetActorLocation();
+	if (FVector::DistSquared(GetActorLocation(), TargetLocation) > FMath::Square(CombatAttributes->GetRange()))
+	{
+		return false;
+	}
+
+	return IsTargetInFiringArc(TargetLocation);
+}
+
 bool ATurretBase::IsTargetInFiringArc(const FVector& TargetLocation) const
 {
 	// Get turret forward vector from facing direction
@@ -388,6 +680,14 @@ void ATurretBase::DrawDebugVisualization() const
 void ATurretBase::ToggleDebugVisualization()
 {
 	bShowDebugVisualization = !bShowDebugVisualization;
+
+	// Scheduled turrets only need their actor tick to draw
+	const UTurretFireSchedulerSubsystem* FireScheduler = UTurretFireSchedulerSubsystem::Get(this);
+	if (FireScheduler && FireScheduler->IsTurretRegistered(this))
+	{
+		SetActorTickEnabled(bShowDebugVisualization);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ATurretBase::ToggleDebugVisualization: Debug visualization %s for %s"),
 		bShowDebugVisualization ? TEXT("ENABLED") : TEXT("DISABLED"),
 		*GetName());
@@ -418,6 +718,18 @@ void ATurretBase::DebugShowTurretInfo()
 	UE_LOG(LogTemp, Display, TEXT("========================"));
 }
 
+void ATurretBase::DebugShowTargetingStats()
+{
+	if (const UTurretTargetingSubsystem* Targeting = UTurretTargetingSubsystem::Get(this))
+	{
+		Targeting->LogStats();
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ATurretBase::DebugShowTargetingStats: No targeting subsystem in this world"));
+	}
+}
+
 bool ATurretBase::ValidateTurretSetup() const
 {
 	bool bIsValid = true;
@@ -473,11 +785,21 @@ bool ATurretBase::IsTargetValid(AActor* Target) const
 		return false;
 	}
 
+	// Line of sight is read from the async trace cache (refreshed once per UpdateTarget);
+	// until a trace completes the target counts as visible
+	if (bRequireLineOfSight)
+	{
+		const UTurretTraceSubsystem* Traces = UTurretTraceSubsystem::Get(this);
+		if (Traces && Traces->GetLineOfSight(this, Target) == ETurretLineOfSight::Blocked)
+		{
+			return false;
+		}
+	}
+
 	// Future implementation will check:
 	// 1. Is target an enemy?
 	// 2. Is target alive? (check health attribute)
 	// 3. Is target on a valid team?
-	// 4. Is target visible (line of sight)?
 
 	return true;
 }
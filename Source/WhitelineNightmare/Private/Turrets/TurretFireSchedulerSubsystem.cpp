@@ -0,0 +1,149 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Turrets/TurretFireSchedulerSubsystem.h"
+#include "Turrets/TurretBase.h"
+#include "Engine/World.h"
+
+static_assert((UTurretFireSchedulerSubsystem::WheelSlotCount & (UTurretFireSchedulerSubsystem::WheelSlotCount - 1)) == 0,
+	"WheelSlotCount must be a power of two");
+
+void FTurretFireTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && TickType != LEVELTICK_ViewportsOnly)
+	{
+		if (const UWorld* World = Target->GetWorld())
+		{
+			Target->AdvanceTo(World->GetTimeSeconds());
+		}
+	}
+}
+
+FString FTurretFireTickFunction::DiagnosticMessage()
+{
+	return TEXT("UTurretFireSchedulerSubsystem::AdvanceTo");
+}
+
+UTurretFireSchedulerSubsystem::UTurretFireSchedulerSubsystem()
+{
+	Wheel.SetNum(WheelSlotCount);
+}
+
+void UTurretFireSchedulerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Before physics, like the actor ticks it replaces
+	FireTickFunction.Target = this;
+	FireTickFunction.bCanEverTick = true;
+	FireTickFunction.bStartWithTickEnabled = true;
+	FireTickFunction.TickGroup = TG_PrePhysics;
+	FireTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UTurretFireSchedulerSubsystem::Deinitialize()
+{
+	if (FireTickFunction.IsTickFunctionRegistered())
+	{
+		FireTickFunction.UnRegisterTickFunction();
+	}
+	FireTickFunction.Target = nullptr;
+
+	Wheel.Empty();
+	DueScratch.Empty();
+	RegisteredTurrets.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTurretFireSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UTurretFireSchedulerSubsystem* UTurretFireSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTurretFireSchedulerSubsystem>() : nullptr;
+}
+
+void UTurretFireSchedulerSubsystem::RegisterTurret(ATurretBase* Turret)
+{
+	if (!Turret || RegisteredTurrets.Contains(Turret))
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : LastAdvanceTime;
+
+	FScheduledTurret Entry;
+	Entry.Turret = Turret;
+	Entry.WakeTime = Now;
+	Entry.Registration = NextRegistration++;
+	RegisteredTurrets.Add(Turret, Entry.Registration);
+	Insert(Entry);
+}
+
+void UTurretFireSchedulerSubsystem::UnregisterTurret(ATurretBase* Turret)
+{
+	// The wheel entry is dropped when its slot comes up
+	RegisteredTurrets.Remove(Turret);
+}
+
+void UTurretFireSchedulerSubsystem::AdvanceTo(double Now)
+{
+	const int64 NowSlot = TimeToSlot(Now);
+	if (NowSlot <= LastVisitedSlot || Wheel.Num() != WheelSlotCount)
+	{
+		LastAdvanceTime = FMath::Max(LastAdvanceTime, Now);
+		return;
+	}
+
+	// Visit each elapsed slot once (a gap longer than a revolution visits the whole wheel once)
+	const int64 FirstSlot = LastVisitedSlot + 1;
+	const int64 SlotsToVisit = FMath::Min<int64>(NowSlot - LastVisitedSlot, WheelSlotCount);
+	LastVisitedSlot = NowSlot;
+	LastAdvanceTime = Now;
+
+	for (int64 Step = 0; Step < SlotsToVisit; ++Step)
+	{
+		const int32 SlotIndex = static_cast<int32>((FirstSlot + Step) & (WheelSlotCount - 1));
+
+		// Take the slot's entries first: waking turrets re-insert into the wheel
+		DueScratch.Reset();
+		Swap(DueScratch, Wheel[SlotIndex]);
+
+		for (FScheduledTurret& Entry : DueScratch)
+		{
+			ATurretBase* Turret = Entry.Turret.Get();
+			const uint32* Registration = Turret ? RegisteredTurrets.Find(Turret) : nullptr;
+			if (!Registration || *Registration != Entry.Registration)
+			{
+				continue;
+			}
+
+			// Due on a later revolution
+			if (Entry.WakeTime > Now)
+			{
+				Insert(Entry);
+				continue;
+			}
+
+			++WakeCount;
+			Entry.WakeTime = Turret->ProcessScheduledFire(Entry.WakeTime, Now);
+			Insert(Entry);
+		}
+	}
+}
+
+void UTurretFireSchedulerSubsystem::Insert(const FScheduledTurret& Entry)
+{
+	if (Wheel.Num() != WheelSlotCount)
+	{
+		return;
+	}
+
+	// Wake times inside already visited slots go to the next frame's first slot
+	const int64 Slot = FMath::Max(TimeToSlot(Entry.WakeTime), LastVisitedSlot + 1);
+	Wheel[static_cast<int32>(Slot & (WheelSlotCount - 1))].Add(Entry);
+}
@@ -0,0 +1,121 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Turrets/TurretTargetingKernel.h"
+
+int32 FTurretTargetingKernel::FindClosest(const float* X, const float* Y, const float* Z, int32 Num,
+	const FVector3f& Origin, const FVector3f& Forward, float RangeSquared, float* OutDistanceSquared)
+{
+	const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+	const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+	const VectorRegister4Float OriginZ = VectorSetFloat1(Origin.Z);
+	const VectorRegister4Float ForwardX = VectorSetFloat1(Forward.X);
+	const VectorRegister4Float ForwardY = VectorSetFloat1(Forward.Y);
+	const VectorRegister4Float ForwardZ = VectorSetFloat1(Forward.Z);
+	const VectorRegister4Float Range = VectorSetFloat1(RangeSquared);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float IndexStep = VectorSetFloat1(4.0f);
+
+	// Per-lane best distance and index (indices as floats are exact far beyond any candidate count)
+	VectorRegister4Float BestDistance = VectorSetFloat1(FLT_MAX);
+	VectorRegister4Float BestIndex = VectorSetFloat1(-1.0f);
+	VectorRegister4Float LaneIndex = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+
+	const int32 NumVectorized = Num & ~3;
+	for (int32 i = 0; i < NumVectorized; i += 4)
+	{
+		const VectorRegister4Float DeltaX = VectorSubtract(VectorLoad(X + i), OriginX);
+		const VectorRegister4Float DeltaY = VectorSubtract(VectorLoad(Y + i), OriginY);
+		const VectorRegister4Float DeltaZ = VectorSubtract(VectorLoad(Z + i), OriginZ);
+
+		const VectorRegister4Float DistanceSquared = VectorMultiplyAdd(DeltaZ, DeltaZ,
+			VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaX, DeltaX)));
+		const VectorRegister4Float Dot = VectorMultiplyAdd(DeltaZ, ForwardZ,
+			VectorMultiplyAdd(DeltaY, ForwardY, VectorMultiply(DeltaX, ForwardX)));
+
+		// In range, in arc, and strictly closer than the lane's best (keeps the first of equal distances)
+		const VectorRegister4Float Accept = VectorBitwiseAnd(
+			VectorBitwiseAnd(VectorCompareLE(DistanceSquared, Range), VectorCompareGT(Dot, Zero)),
+			VectorCompareLT(DistanceSquared, BestDistance));
+
+		BestDistance = VectorSelect(Accept, DistanceSquared, BestDistance);
+		BestIndex = VectorSelect(Accept, LaneIndex, BestIndex);
+		LaneIndex = VectorAdd(LaneIndex, IndexStep);
+	}
+
+	// Reduce the four lanes, lowest index on ties
+	alignas(16) float LaneDistances[4];
+	alignas(16) float LaneIndices[4];
+	VectorStoreAligned(BestDistance, LaneDistances);
+	VectorStoreAligned(BestIndex, LaneIndices);
+
+	int32 Result = INDEX_NONE;
+	float ResultDistance = FLT_MAX;
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		const int32 Index = static_cast<int32>(LaneIndices[Lane]);
+		if (Index < 0)
+		{
+			continue;
+		}
+
+		if (LaneDistances[Lane] < ResultDistance || (LaneDistances[Lane] == ResultDistance && Index < Result))
+		{
+			ResultDistance = LaneDistances[Lane];
+			Result = Index;
+		}
+	}
+
+	// Remainder
+	if (NumVectorized < Num)
+	{
+		float TailDistance = FLT_MAX;
+		const int32 TailResult = FindClosestScalar(X + NumVectorized, Y + NumVectorized, Z + NumVectorized, Num - NumVectorized,
+			Origin, Forward, RangeSquared, &TailDistance);
+		if (TailResult != INDEX_NONE && TailDistance < ResultDistance)
+		{
+			ResultDistance = TailDistance;
+			Result = NumVectorized + TailResult;
+		}
+	}
+
+	if (OutDistanceSquared && Result != INDEX_NONE)
+	{
+		*OutDistanceSquared = ResultDistance;
+	}
+	return Result;
+}
+
+int32 FTurretTargetingKernel::FindClosestScalar(const float* X, const float* Y, const float* Z, int32 Num,
+	const FVector3f& Origin, const FVector3f& Forward, float RangeSquared, float* OutDistanceSquared)
+{
+	int32 Result = INDEX_NONE;
+	float ResultDistance = FLT_MAX;
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float DeltaX = X[i] - Origin.X;
+		const float DeltaY = Y[i] - Origin.Y;
+		const float DeltaZ = Z[i] - Origin.Z;
+
+		const float DistanceSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+		if (DistanceSquared > RangeSquared || DistanceSquared >= ResultDistance)
+		{
+			continue;
+		}
+
+		// 180° arc: only the sign of the dot product matters
+		if (DeltaX * Forward.X + DeltaY * Forward.Y + DeltaZ * Forward.Z <= 0.0f)
+		{
+			continue;
+		}
+
+		ResultDistance = DistanceSquared;
+		Result = i;
+	}
+
+	if (OutDistanceSquared && Result != INDEX_NONE)
+	{
+		*OutDistanceSquared = ResultDistance;
+	}
+	return Result;
+}
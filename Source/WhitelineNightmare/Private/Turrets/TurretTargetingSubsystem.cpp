@@ -0,0 +1,322 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Turrets/TurretTargetingSubsystem.h"
+#include "Turrets/TurretBase.h"
+#include "Turrets/TurretTargetingKernel.h"
+#include "GAS/Attributes/CombatAttributeSet.h"
+#include "Core/WarRigPawn.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+
+void UTurretTargetingSubsystem::Deinitialize()
+{
+	Turrets.Empty();
+	CandidateActors.Empty();
+	CandidateX.Empty();
+	CandidateY.Empty();
+	CandidateZ.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTurretTargetingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UTurretTargetingSubsystem* UTurretTargetingSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTurretTargetingSubsystem>() : nullptr;
+}
+
+void UTurretTargetingSubsystem::RegisterTurret(ATurretBase* Turret)
+{
+	if (!Turret || IsTurretRegistered(Turret))
+	{
+		return;
+	}
+
+	Turrets.Add(Turret);
+	bCandidatesDirty = true;
+}
+
+void UTurretTargetingSubsystem::UnregisterTurret(const ATurretBase* Turret)
+{
+	const int32 Index = Turrets.IndexOfByPredicate([Turret](const TWeakObjectPtr<ATurretBase>& Entry)
+	{
+		return Entry.Get() == Turret;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		Turrets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		bCandidatesDirty = true;
+	}
+}
+
+bool UTurretTargetingSubsystem::IsTurretRegistered(const ATurretBase* Turret) const
+{
+	return Turret && Turrets.ContainsByPredicate([Turret](const TWeakObjectPtr<ATurretBase>& Entry)
+	{
+		return Entry.Get() == Turret;
+	});
+}
+
+AActor* UTurretTargetingSubsystem::FindBestTarget(const ATurretBase* Turret)
+{
+	const UCombatAttributeSet* CombatAttributes = Turret ? Turret->GetCombatAttributeSet() : nullptr;
+	if (!CombatAttributes)
+	{
+		return nullptr;
+	}
+
+	EnsureCandidates();
+
+	const FVector3f Origin(Turret->GetActorLocation());
+	const FVector3f Forward(Turret->GetFacingDirection().Vector());
+	const float RangeSquared = FMath::Square(CombatAttributes->GetRange());
+
+	// Batch arc/range filter over the shared candidate arrays
+	const int32 BestIndex = FTurretTargetingKernel::FindClosest(CandidateX.GetData(), CandidateY.GetData(), CandidateZ.GetData(),
+		CandidateActors.Num(), Origin, Forward, RangeSquared);
+	if (BestIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	AActor* Candidate = CandidateActors[BestIndex];
+	if (Candidate != Turret->GetOwnerWarRig() && Turret->IsTargetValid(Candidate))
+	{
+		return Candidate;
+	}
+
+	// The closest candidate was rejected (e.g. destroyed this frame): validate each candidate instead
+	AActor* BestTarget = nullptr;
+	float ClosestDistanceSquared = FLT_MAX;
+
+	for (int32 i = 0; i < CandidateActors.Num(); ++i)
+	{
+		const float DeltaX = CandidateX[i] - Origin.X;
+		const float DeltaY = CandidateY[i] - Origin.Y;
+		const float DeltaZ = CandidateZ[i] - Origin.Z;
+
+		const float DistanceSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+		if (DistanceSquared > RangeSquared || DistanceSquared >= ClosestDistanceSquared)
+		{
+			continue;
+		}
+
+		if (DeltaX * Forward.X + DeltaY * Forward.Y + DeltaZ * Forward.Z <= 0.0f)
+		{
+			continue;
+		}
+
+		Candidate = CandidateActors[i];
+		if (Candidate == Turret->GetOwnerWarRig() || !Turret->IsTargetValid(Candidate))
+		{
+			continue;
+		}
+
+		ClosestDistanceSquared = DistanceSquared;
+		BestTarget = Candidate;
+	}
+
+	return BestTarget;
+}
+
+bool UTurretTargetingSubsystem::TryConsumeReacquisitionBudget()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		ReacquisitionsThisFrame = 0;
+	}
+
+	if (ReacquisitionBudget > 0 && ReacquisitionsThisFrame >= ReacquisitionBudget)
+	{
+		++Stats.DeferredReacquisitions;
+		return false;
+	}
+
+	++ReacquisitionsThisFrame;
+	++Stats.Reacquisitions;
+	return true;
+}
+
+void UTurretTargetingSubsystem::RecordQualitySample(const ATurretBase* Turret, const AActor* KeptTarget)
+{
+	if (!Turret || !KeptTarget || !IsTurretRegistered(Turret))
+	{
+		return;
+	}
+
+	++Stats.QualitySamples;
+
+	const AActor* BestTarget = FindBestTarget(Turret);
+	if (BestTarget && BestTarget != KeptTarget)
+	{
+		const FVector Origin = Turret->GetActorLocation();
+		const float KeptDistance = FVector::Dist(Origin, KeptTarget->GetActorLocation());
+		const float BestDistance = FVector::Dist(Origin, BestTarget->GetActorLocation());
+
+		++Stats.SuboptimalSamples;
+		Stats.TotalExtraDistance += FMath::Max(KeptDistance - BestDistance, 0.0f);
+	}
+}
+
+void UTurretTargetingSubsystem::LogStats() const
+{
+	const float SuboptimalPercent = Stats.QualitySamples > 0 ? 100.0f * Stats.SuboptimalSamples / Stats.QualitySamples : 0.0f;
+	const float AverageExtraDistance = Stats.SuboptimalSamples > 0 ? Stats.TotalExtraDistance / Stats.SuboptimalSamples : 0.0f;
+
+	UE_LOG(LogTemp, Display, TEXT("=== TURRET TARGETING STATS ==="));
+	UE_LOG(LogTemp, Display, TEXT("Registered Turrets: %d"), Turrets.Num());
+	UE_LOG(LogTemp, Display, TEXT("Candidate Queries: %d"), QueryCount);
+	UE_LOG(LogTemp, Display, TEXT("Reacquisitions: %d (Deferred: %d, Budget: %d/frame)"), Stats.Reacquisitions, Stats.DeferredReacquisitions, ReacquisitionBudget);
+	UE_LOG(LogTemp, Display, TEXT("Quality Samples: %d (Suboptimal: %.1f%%, Avg Extra Distance: %.1f)"), Stats.QualitySamples, SuboptimalPercent, AverageExtraDistance);
+	UE_LOG(LogTemp, Display, TEXT("=============================="));
+}
+
+void UTurretTargetingSubsystem::EnsureCandidates()
+{
+	if (bCandidatesDirty || GatheredFrame != GFrameCounter)
+	{
+		GatherCandidates();
+	}
+}
+
+void UTurretTargetingSubsystem::GatherCandidates()
+{
+	GatheredFrame = GFrameCounter;
+	bCandidatesDirty = false;
+
+	CandidateActors.Reset();
+	CandidateX.Reset();
+	CandidateY.Reset();
+	CandidateZ.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Bound every turret's range sphere with one sphere, ignoring the turrets and their rigs
+	FBox TurretBounds(ForceInit);
+	float MaxRange = 0.0f;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TurretTargeting), false);
+	TArray<const AActor*, TInlineAllocator<16>> IgnoredActors;
+
+	for (int32 i = Turrets.Num() - 1; i >= 0; --i)
+	{
+		const ATurretBase* Turret = Turrets[i].Get();
+		if (!Turret)
+		{
+			Turrets.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const UCombatAttributeSet* CombatAttributes = Turret->GetCombatAttributeSet();
+		if (!CombatAttributes || CombatAttributes->GetRange() <= 0.0f)
+		{
+			continue;
+		}
+
+		TurretBounds += Turret->GetActorLocation();
+		MaxRange = FMath::Max(MaxRange, CombatAttributes->GetRange());
+
+		QueryParams.AddIgnoredActor(Turret);
+		IgnoredActors.Add(Turret);
+		if (Turret->GetOwnerWarRig())
+		{
+			QueryParams.AddIgnoredActor(Turret->GetOwnerWarRig());
+			IgnoredActors.AddUnique(Turret->GetOwnerWarRig());
+		}
+	}
+
+	if (!TurretBounds.IsValid)
+	{
+		return;
+	}
+
+	const FVector QueryCenter = TurretBounds.GetCenter();
+	const float QueryRadius = TurretBounds.GetExtent().Size() + MaxRange;
+
+	// One entry per actor: lane-indexed pawns are also found by the overlap, and an actor with
+	// several overlapping components is reported once per component
+	TSet<const AActor*> SeenActors;
+
+	// Lane-indexed pawns: walk the buckets covering the sphere's X extent, including pawns without collision
+	if (const UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		TArray<AActor*> LaneActors;
+		ScrollMovers->QueryAllLanes(QueryCenter.X - QueryRadius, QueryCenter.X + QueryRadius, LaneActors);
+
+		const float QueryRadiusSquared = FMath::Square(QueryRadius);
+		for (AActor* Actor : LaneActors)
+		{
+			if (IsValid(Actor) && Actor->IsA<APawn>() && !IgnoredActors.Contains(Actor)
+				&& FVector::DistSquared(Actor->GetActorLocation(), QueryCenter) <= QueryRadiusSquared)
+			{
+				SeenActors.Add(Actor);
+				AddCandidate(Actor);
+			}
+		}
+
+		if (CandidateActors.Num() > 0)
+		{
+			++LaneQueryCount;
+		}
+	}
+
+	// Not every pawn is lane-indexed, so the overlap always runs
+	TArray<FOverlapResult> OverlapResults;
+	++QueryCount;
+	World->OverlapMultiByChannel(
+		OverlapResults,
+		QueryCenter,
+		FQuat::Identity,
+		ECC_Pawn, // Look for pawns (enemies)
+		FCollisionShape::MakeSphere(QueryRadius),
+		QueryParams
+	);
+
+	const int32 MaxCandidates = CandidateActors.Num() + OverlapResults.Num();
+	SeenActors.Reserve(MaxCandidates);
+	CandidateActors.Reserve(MaxCandidates);
+	CandidateX.Reserve(MaxCandidates);
+	CandidateY.Reserve(MaxCandidates);
+	CandidateZ.Reserve(MaxCandidates);
+
+	for (const FOverlapResult& Result : OverlapResults)
+	{
+		AActor* Actor = Result.GetActor();
+		if (!Actor)
+		{
+			continue;
+		}
+
+		bool bAlreadySeen = false;
+		SeenActors.Add(Actor, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		AddCandidate(Actor);
+	}
+}
+
+void UTurretTargetingSubsystem::AddCandidate(AActor* Actor)
+{
+	const FVector Location = Actor->GetActorLocation();
+	CandidateActors.Add(Actor);
+	CandidateX.Add(Location.X);
+	CandidateY.Add(Location.Y);
+	CandidateZ.Add(Location.Z);
+}
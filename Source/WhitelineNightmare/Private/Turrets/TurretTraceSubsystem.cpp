@@ -0,0 +1,316 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#include "Turrets/TurretTraceSubsystem.h"
+#include "Turrets/TurretBase.h"
+#include "Turrets/ProjectileSubsystem.h"
+#include "Core/WarRigPawn.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+
+namespace
+{
+	// Cached line of sight not queried for this long is dropped
+	constexpr double LineOfSightCacheLifetime = 1.0;
+}
+
+void FTurretTraceTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Target->TickTraces();
+	}
+}
+
+FString FTurretTraceTickFunction::DiagnosticMessage()
+{
+	return TEXT("UTurretTraceSubsystem::TickTraces");
+}
+
+void UTurretTraceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TraceDoneDelegate.BindUObject(this, &UTurretTraceSubsystem::HandleTraceDone);
+
+	// Early in the frame so queued shots get this frame's budget before turrets tick
+	TraceTickFunction.Target = this;
+	TraceTickFunction.bCanEverTick = true;
+	TraceTickFunction.bStartWithTickEnabled = true;
+	TraceTickFunction.TickGroup = TG_PrePhysics;
+	TraceTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UTurretTraceSubsystem::Deinitialize()
+{
+	if (TraceTickFunction.IsTickFunctionRegistered())
+	{
+		TraceTickFunction.UnRegisterTickFunction();
+	}
+	TraceTickFunction.Target = nullptr;
+	TraceDoneDelegate.Unbind();
+
+	LineOfSightCache.Empty();
+	PendingTraces.Empty();
+	QueuedHitscans.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UTurretTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UTurretTraceSubsystem* UTurretTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTurretTraceSubsystem>() : nullptr;
+}
+
+ETurretLineOfSight UTurretTraceSubsystem::GetLineOfSight(const ATurretBase* Turret, const AActor* Target) const
+{
+	const FLineOfSightEntry* Entry = LineOfSightCache.Find(TPair<const ATurretBase*, const AActor*>(Turret, Target));
+	return Entry ? Entry->Result : ETurretLineOfSight::Unknown;
+}
+
+ETurretLineOfSight UTurretTraceSubsystem::RefreshLineOfSight(const ATurretBase* Turret, const AActor* Target)
+{
+	const UWorld* World = GetWorld();
+	if (!Turret || !Target || !World)
+	{
+		return ETurretLineOfSight::Unknown;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	FLineOfSightEntry& Entry = LineOfSightCache.FindOrAdd(TPair<const ATurretBase*, const AActor*>(Turret, Target));
+	Entry.LastQueryTime = Now;
+
+	const bool bStale = Entry.LastUpdateTime < 0.0 || Now - Entry.LastUpdateTime >= LineOfSightRefreshInterval;
+	if (bStale && !Entry.bPending && TryConsumeTraceBudget())
+	{
+		FTurretTrace Trace;
+		Trace.Kind = ETraceKind::LineOfSight;
+		Trace.TurretKey = Turret;
+		Trace.TargetKey = Target;
+		Trace.IgnoredActors = { Turret, Turret->GetOwnerWarRig(), Target };
+		Trace.Start = Turret->GetActorLocation();
+		Trace.End = Target->GetActorLocation();
+
+		Entry.bPending = true;
+		SubmitTrace(Trace);
+	}
+
+	return Entry.Result;
+}
+
+void UTurretTraceSubsystem::RequestHitscan(ATurretBase* Turret, const FVector& Start, const FVector& End, float Damage)
+{
+	FTurretTrace Trace;
+	Trace.Kind = ETraceKind::Hitscan;
+	Trace.Turret = Turret;
+	if (Turret)
+	{
+		Trace.IgnoredActors = { Turret, Turret->GetOwnerWarRig() };
+	}
+	Trace.Start = Start;
+	Trace.End = End;
+	Trace.Damage = Damage;
+	if (const UWorld* World = GetWorld())
+	{
+		Trace.RequestTime = World->GetTimeSeconds();
+	}
+
+	// Keep shot order: nothing jumps the queue
+	if (QueuedHitscans.Num() == 0 && TryConsumeTraceBudget())
+	{
+		SubmitTrace(Trace);
+		return;
+	}
+
+	// A full queue sheds its oldest shot rather than growing without bound
+	if (QueuedHitscans.Num() >= MaxQueuedHitscans)
+	{
+		const int32 NumDropped = QueuedHitscans.Num() - MaxQueuedHitscans + 1;
+		QueuedHitscans.RemoveAt(0, NumDropped, EAllowShrinking::No);
+		DroppedHitscanCount += NumDropped;
+	}
+	QueuedHitscans.Add(MoveTemp(Trace));
+}
+
+void UTurretTraceSubsystem::TickTraces()
+{
+	// Shots that waited too long would land where their target used to be
+	int32 NumProcessed = 0;
+	if (const UWorld* World = GetWorld())
+	{
+		const double OldestRequestTime = World->GetTimeSeconds() - MaxHitscanQueueAge;
+		while (NumProcessed < QueuedHitscans.Num() && QueuedHitscans[NumProcessed].RequestTime < OldestRequestTime)
+		{
+			++NumProcessed;
+		}
+		DroppedHitscanCount += NumProcessed;
+	}
+
+	while (NumProcessed < QueuedHitscans.Num() && TryConsumeTraceBudget())
+	{
+		SubmitTrace(QueuedHitscans[NumProcessed]);
+		++NumProcessed;
+	}
+	QueuedHitscans.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+
+	PruneLineOfSight();
+}
+
+void UTurretTraceSubsystem::FlushPendingTraces()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	TMap<uint32, FTurretTrace> Traces = MoveTemp(PendingTraces);
+	PendingTraces.Reset();
+
+	for (const TPair<uint32, FTurretTrace>& Pair : Traces)
+	{
+		const FTurretTrace& Trace = Pair.Value;
+		FHitResult Hit;
+		bool bHit;
+		if (Trace.Kind == ETraceKind::LineOfSight)
+		{
+			bHit = World->LineTraceSingleByChannel(Hit, Trace.Start, Trace.End, ECC_Visibility, MakeQueryParams(Trace));
+		}
+		else
+		{
+			FCollisionObjectQueryParams ObjectParams;
+			ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+			ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+			ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+			bHit = World->LineTraceSingleByObjectType(Hit, Trace.Start, Trace.End, ObjectParams, MakeQueryParams(Trace));
+		}
+		CompleteTrace(Trace, bHit ? &Hit : nullptr);
+	}
+}
+
+bool UTurretTraceSubsystem::TryConsumeTraceBudget()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		TracesThisFrame = 0;
+	}
+
+	if (TracesThisFrame >= MaxTracesPerFrame)
+	{
+		return false;
+	}
+
+	++TracesThisFrame;
+	return true;
+}
+
+void UTurretTraceSubsystem::SubmitTrace(const FTurretTrace& Trace)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const FCollisionQueryParams QueryParams = MakeQueryParams(Trace);
+
+	const uint32 TraceId = NextTraceId++;
+	PendingTraces.Add(TraceId, Trace);
+	++SubmittedTraceCount;
+
+	if (Trace.Kind == ETraceKind::LineOfSight)
+	{
+		// Pawns ignore the visibility channel, so only level geometry blocks line of sight
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Test, Trace.Start, Trace.End, ECC_Visibility,
+			QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDoneDelegate, TraceId);
+	}
+	else
+	{
+		// First pawn or piece of level geometry along the shot
+		FCollisionObjectQueryParams ObjectParams;
+		ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+		ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+		ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+		World->AsyncLineTraceByObjectType(EAsyncTraceType::Single, Trace.Start, Trace.End, ObjectParams,
+			QueryParams, &TraceDoneDelegate, TraceId);
+	}
+}
+
+void UTurretTraceSubsystem::HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FTurretTrace Trace;
+	if (!PendingTraces.RemoveAndCopyValue(Datum.UserData, Trace))
+	{
+		return;
+	}
+
+	const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit)
+	{
+		return Hit.bBlockingHit;
+	});
+
+	CompleteTrace(Trace, BlockingHit);
+}
+
+void UTurretTraceSubsystem::CompleteTrace(const FTurretTrace& Trace, const FHitResult* BlockingHit)
+{
+	if (Trace.Kind == ETraceKind::LineOfSight)
+	{
+		if (FLineOfSightEntry* Entry = LineOfSightCache.Find(TPair<const ATurretBase*, const AActor*>(Trace.TurretKey, Trace.TargetKey)))
+		{
+			const UWorld* World = GetWorld();
+			Entry->Result = BlockingHit ? ETurretLineOfSight::Blocked : ETurretLineOfSight::Visible;
+			Entry->LastUpdateTime = World ? World->GetTimeSeconds() : 0.0;
+			Entry->bPending = false;
+		}
+		return;
+	}
+
+	// Hitscan: only pawns take damage, level geometry just stops the shot
+	const UPrimitiveComponent* HitComponent = BlockingHit ? BlockingHit->GetComponent() : nullptr;
+	if (HitComponent && HitComponent->GetCollisionObjectType() == ECC_Pawn)
+	{
+		if (UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(this))
+		{
+			Projectiles->ApplyHit(BlockingHit->GetActor(), Trace.Damage, Trace.Turret.Get(), BlockingHit->ImpactPoint);
+		}
+	}
+}
+
+FCollisionQueryParams UTurretTraceSubsystem::MakeQueryParams(const FTurretTrace& Trace)
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TurretTrace), false);
+	for (const TWeakObjectPtr<const AActor>& IgnoredActor : Trace.IgnoredActors)
+	{
+		if (const AActor* Actor = IgnoredActor.Get())
+		{
+			QueryParams.AddIgnoredActor(Actor);
+		}
+	}
+	return QueryParams;
+}
+
+void UTurretTraceSubsystem::PruneLineOfSight()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	for (auto It = LineOfSightCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().bPending && Now - It.Value().LastQueryTime > LineOfSightCacheLifetime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -1,10 +1,8 @@
 // Copyright Flatlander81. All Rights Reserved.
 
 #include "World/GroundTile.h"
-#include "Core/WorldScrollComponent.h"
-#include "Core/WhitelineNightmareGameMode.h"
+#include "Core/ScrollMoverSubsystem.h"
 #include "Components/StaticMeshComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "UObject/ConstructorHelpers.h"
 
@@ -15,7 +13,9 @@ AGroundTile::AGroundTile()
 	: bShowDebugBounds(false)
 	, TileLength(2000.0f)
 {
+	// Scrolling is done by UScrollMoverSubsystem; the tile only ticks to draw debug bounds
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	// Create root component
 	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
@@ -49,9 +49,6 @@ void AGroundTile::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Update position based on scroll velocity
-	UpdateScrollPosition(DeltaTime);
-
 	// Debug visualization
 	if (bShowDebugBounds)
 	{
@@ -64,7 +61,13 @@ void AGroundTile::OnActivated_Implementation()
 	// Make visible
 	SetActorHiddenInGame(false);
 	SetActorEnableCollision(true);
-	SetActorTickEnabled(true);
+	SetActorTickEnabled(bShowDebugBounds);
+
+	// Scroll with the world
+	if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		ScrollMovers->RegisterMover(this);
+	}
 
 	UE_LOG(LogGroundTile, Verbose, TEXT("GroundTile activated at: %s"), *GetActorLocation().ToString());
 }
@@ -76,6 +79,11 @@ void AGroundTile::OnDeactivated_Implementation()
 	SetActorEnableCollision(false);
 	SetActorTickEnabled(false);
 
+	if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+	{
+		ScrollMovers->UnregisterMover(this);
+	}
+
 	UE_LOG(LogGroundTile, Verbose, TEXT("GroundTile deactivated"));
 }
 
@@ -89,41 +97,6 @@ void AGroundTile::ResetState_Implementation()
 	UE_LOG(LogGroundTile, Verbose, TEXT("GroundTile state reset"));
 }
 
-void AGroundTile::UpdateScrollPosition(float DeltaTime)
-{
-	// Get scroll component
-	UWorldScrollComponent* ScrollComponent = GetWorldScrollComponent();
-	if (!ScrollComponent)
-	{
-		UE_LOG(LogGroundTile, Warning, TEXT("UpdateScrollPosition: WorldScrollComponent not found"));
-		return;
-	}
-
-	// Get scroll velocity
-	FVector ScrollVelocity = ScrollComponent->GetScrollVelocity();
-
-	// Move tile by scroll velocity
-	FVector DeltaLocation = ScrollVelocity * DeltaTime;
-	AddActorWorldOffset(DeltaLocation);
-
-	UE_LOG(LogGroundTile, VeryVerbose, TEXT("Tile position: %s, Velocity: %s"),
-		*GetActorLocation().ToString(), *ScrollVelocity.ToString());
-}
-
-UWorldScrollComponent* AGroundTile::GetWorldScrollComponent() const
-{
-	// Get game mode
-	AWhitelineNightmareGameMode* GameMode = Cast<AWhitelineNightmareGameMode>(
-		UGameplayStatics::GetGameMode(this));
-
-	if (!GameMode)
-	{
-		return nullptr;
-	}
-
-	return GameMode->WorldScrollComponent;
-}
-
 void AGroundTile::DrawDebugInfo()
 {
 	UWorld* World = GetWorld();
@@ -5,9 +5,13 @@
 #include "Core/WorldScrollComponent.h"
 #include "Core/WhitelineNightmareGameMode.h"
 #include "Core/ObjectPoolComponent.h"
+#include "Core/ObjectPoolSubsystem.h"
+#include "Core/ScrollMoverSubsystem.h"
+#include "Core/AssetPreloadSubsystem.h"
 #include "Core/ObjectPoolTypes.h"
 #include "Core/GameDataStructs.h"
 #include "Kismet/GameplayStatics.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 
@@ -17,6 +21,9 @@ DEFINE_LOG_CATEGORY_STATIC(LogGroundTileManager, Log, All);
 // Extra back margin for initial tile spawning (ensures road looks complete from any camera angle)
 static constexpr float EXTRA_BACK_MARGIN = 10000.0f;
 
+// Instanced road component distance from the origin at which instances are shifted back towards it (float precision)
+static constexpr float INSTANCED_ROAD_REBASE_DISTANCE = 1000000.0f;
+
 // Enable verbose tile recycling logs (set to 1 to see detailed pool recycling info every tick)
 #define GROUND_TILE_VERBOSE_LOGGING 0
 
@@ -30,7 +37,22 @@ UGroundTileManager::UGroundTileManager()
 	, TilePoolSize(15)
 	, TileSpawnDistance(10000.0f)  // Spawn 10000 units ahead (5 tiles)
 	, TileDespawnDistance(5000.0f)  // Despawn 5000 units behind (2.5 tiles)
+	, ResolvedTileMesh(nullptr)
+	, ResolvedTileMaterial(nullptr)
 	, bShowDebugVisualization(false)
+	, ActiveTileHead(0)
+	, ActiveTileCount(0)
+	, bAnalyticTilePlacement(false)
+	, ActiveTileRearRoadIndex(0)
+	, AnalyticAnchorX(0.0f)
+	, AnalyticAnchorDistance(0.0)
+	, bAnalyticRoadAnchored(false)
+	, bUseInstancedRoad(false)
+	, RoadInstances(nullptr)
+	, RoadRingHead(0)
+	, RoadAnchorDistance(0.0)
+	, bWaitingForTileAssets(false)
+	, ScrollSource(nullptr)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
@@ -53,6 +75,42 @@ void UGroundTileManager::BeginPlay()
 	UE_LOG(LogGroundTileManager, Log, TEXT("After config load: TileSize=%.0f, PoolSize=%d, SpawnDist=%.0f, DespawnDist=%.0f"),
 		TileSize, TilePoolSize, TileSpawnDistance, TileDespawnDistance);
 
+	// Instanced and analytic roads are placed from the scroll distance, so read it after the scroll component has advanced it this frame
+	if (bUseInstancedRoad || bAnalyticTilePlacement)
+	{
+		if (UWorldScrollComponent* ScrollComponent = GetWorldScrollComponent())
+		{
+			AddTickPrerequisiteComponent(ScrollComponent);
+		}
+	}
+
+	// Build the road once the configured mesh/material are resident instead of loading them synchronously
+	UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this);
+	if (Preloader && !Preloader->IsPreloadComplete())
+	{
+		bWaitingForTileAssets = true;
+		Preloader->OnPreloadComplete.AddDynamic(this, &UGroundTileManager::HandleTileAssetsPreloaded);
+		UE_LOG(LogGroundTileManager, Log, TEXT("Road setup waiting for tile assets to finish streaming"));
+		return;
+	}
+
+	StartRoad();
+}
+
+void UGroundTileManager::StartRoad()
+{
+	ResolveTileAssets();
+
+	// Instanced road needs no tile pool
+	if (bUseInstancedRoad)
+	{
+		WarRig = GetWarRig();
+		BuildInstancedRoad();
+		UE_LOG(LogGroundTileManager, Log, TEXT("=== GroundTileManager Initialization Complete (instanced road, %d instances) ==="),
+			RoadInstanceLocalX.Num());
+		return;
+	}
+
 	// Initialize tile pool
 	if (!InitializeTilePool())
 	{
@@ -71,10 +129,17 @@ void UGroundTileManager::BeginPlay()
 		UE_LOG(LogGroundTileManager, Log, TEXT("War rig found at position: %s"), *WarRig->GetActorLocation().ToString());
 	}
 
-	// Spawn initial tiles
-	SpawnInitialTiles();
+	// Spawn initial tiles (analytic placement fills the road from the scroll distance instead)
+	if (bAnalyticTilePlacement)
+	{
+		UpdateAnalyticTiles();
+	}
+	else
+	{
+		SpawnInitialTiles();
+	}
 
-	UE_LOG(LogGroundTileManager, Log, TEXT("GroundTileManager initialized: %d tiles spawned"), ActiveTiles.Num());
+	UE_LOG(LogGroundTileManager, Log, TEXT("GroundTileManager initialized: %d tiles spawned"), ActiveTileCount);
 	UE_LOG(LogGroundTileManager, Log, TEXT("Pool state: Active=%d, Available=%d, Total=%d"),
 		TilePool ? TilePool->GetActiveCount() : 0,
 		TilePool ? TilePool->GetAvailableCount() : 0,
@@ -82,10 +147,28 @@ void UGroundTileManager::BeginPlay()
 	UE_LOG(LogGroundTileManager, Log, TEXT("=== GroundTileManager Initialization Complete ==="));
 }
 
+void UGroundTileManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// The shared tile pool outlives this manager; stop counting as one of its consumers
+	if (UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this))
+	{
+		PoolSubsystem->ReleasePool(TilePool);
+	}
+	TilePool = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UGroundTileManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// Nothing to update until the road has been set up
+	if (bWaitingForTileAssets)
+	{
+		return;
+	}
+
 	// FIX 2: Retry finding WarRig if it spawned late
 	if (!WarRig)
 	{
@@ -95,7 +178,16 @@ void UGroundTileManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 			UE_LOG(LogGroundTileManager, Log, TEXT("War rig found on retry at position: %s"), *WarRig->GetActorLocation().ToString());
 
 			// Spawn initial tiles now that we have a war rig
-			if (ActiveTiles.Num() == 0)
+			if (bUseInstancedRoad)
+			{
+				BuildInstancedRoad();
+			}
+			else if (bAnalyticTilePlacement)
+			{
+				// Re-anchor the road to the war rig on the next update
+				bAnalyticRoadAnchored = false;
+			}
+			else if (ActiveTileCount == 0)
 			{
 				UE_LOG(LogGroundTileManager, Log, TEXT("Spawning initial tiles after finding war rig..."));
 				SpawnInitialTiles();
@@ -104,7 +196,18 @@ void UGroundTileManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 	}
 
 	// Check for tiles that need recycling
-	CheckForTileRecycling();
+	if (bUseInstancedRoad)
+	{
+		UpdateInstancedRoad();
+	}
+	else if (bAnalyticTilePlacement)
+	{
+		UpdateAnalyticTiles();
+	}
+	else
+	{
+		CheckForTileRecycling();
+	}
 
 	// Debug visualization
 	if (bShowDebugVisualization)
@@ -115,25 +218,26 @@ void UGroundTileManager::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 
 float UGroundTileManager::GetFurthestTilePosition() const
 {
-	if (ActiveTiles.Num() == 0)
+	// Front of the ring is the instance just before the rear one
+	if (bUseInstancedRoad)
 	{
-		return 0.0f;
+		if (!RoadInstances || RoadInstanceLocalX.Num() == 0)
+		{
+			return 0.0f;
+		}
+
+		const int32 FrontIndex = (RoadRingHead + RoadInstanceLocalX.Num() - 1) % RoadInstanceLocalX.Num();
+		return RoadInstances->GetComponentLocation().X + RoadInstanceLocalX[FrontIndex];
 	}
 
-	float FurthestX = -MAX_FLT;
-	for (const AGroundTile* Tile : ActiveTiles)
+	if (ActiveTileCount == 0)
 	{
-		if (Tile)
-		{
-			float TileX = Tile->GetActorLocation().X;
-			if (TileX > FurthestX)
-			{
-				FurthestX = TileX;
-			}
-		}
+		return 0.0f;
 	}
 
-	return FurthestX;
+	// Tiles are pushed in front of each other, so the furthest is always the last in the ring
+	const AGroundTile* FurthestTile = ActiveTiles[GetActiveTileRingIndex(ActiveTileCount - 1)];
+	return FurthestTile ? FurthestTile->GetActorLocation().X : -MAX_FLT;
 }
 
 void UGroundTileManager::CheckForTileRecycling()
@@ -151,7 +255,7 @@ void UGroundTileManager::CheckForTileRecycling()
 		if (CurrentTime - LastWarningTime > 5.0f)
 		{
 			UE_LOG(LogGroundTileManager, Warning, TEXT("WarRig is null - using world origin (0,0,0) for tile management. Active tiles: %d, Pool: %d/%d"),
-				ActiveTiles.Num(),
+				ActiveTileCount,
 				TilePool ? TilePool->GetActiveCount() : 0,
 				TilePool ? TilePool->GetTotalPoolSize() : 0);
 			LastWarningTime = CurrentTime;
@@ -171,36 +275,37 @@ void UGroundTileManager::CheckForTileRecycling()
 		UE_LOG(LogGroundTileManager, Warning, TEXT("Pool running low! Available: %d/%d, Active tiles: %d, WarRigX: %.0f, Despawn threshold: %.0f"),
 			TilePool->GetAvailableCount(),
 			TilePool->GetTotalPoolSize(),
-			ActiveTiles.Num(),
+			ActiveTileCount,
 			WarRigX,
 			DespawnThreshold);
 	}
 
-	// Check for tiles that passed behind war rig
+	// Pop tiles that passed behind war rig off the rear of the ring (the first tile still ahead of the threshold ends the scan)
 	int32 RecycledCount = 0;
-	for (int32 i = ActiveTiles.Num() - 1; i >= 0; --i)
+	while (ActiveTileCount > 0)
 	{
-		AGroundTile* Tile = ActiveTiles[i];
-		if (!Tile)
+		const int32 RearIndex = ActiveTileHead;
+		AGroundTile* Tile = ActiveTiles[RearIndex];
+		if (!Tile || !TilePool || !TilePool->IsHandleValid(ActiveTileHandles[RearIndex]))
 		{
-			// FIX 3: Log and remove null tiles from active list
-			UE_LOG(LogGroundTileManager, Warning, TEXT("Found null tile in ActiveTiles at index %d - removing"), i);
-			ActiveTiles.RemoveAt(i);
+			// FIX 3: Log and remove null or already-returned tiles from active list
+			UE_LOG(LogGroundTileManager, Warning, TEXT("Found null or stale tile at the rear of ActiveTiles (ring index %d) - removing"), RearIndex);
+			PopBackTile();
 			continue;
 		}
 
 		const float TileX = Tile->GetActorLocation().X;
-
-		// If tile passed behind war rig, recycle it
-		if (TileX < DespawnThreshold)
+		if (TileX >= DespawnThreshold)
 		{
-			UE_LOG(LogGroundTileManager, Verbose, TEXT("Recycling tile at X=%.0f (threshold=%.0f, behind by %.0f)"),
-				TileX, DespawnThreshold, DespawnThreshold - TileX);
-
-			RecycleTile(Tile);
-			ActiveTiles.RemoveAt(i);
-			RecycledCount++;
+			break;
 		}
+
+		UE_LOG(LogGroundTileManager, Verbose, TEXT("Recycling tile at X=%.0f (threshold=%.0f, behind by %.0f)"),
+			TileX, DespawnThreshold, DespawnThreshold - TileX);
+
+		RecycleTile(Tile, ActiveTileHandles[RearIndex]);
+		PopBackTile();
+		RecycledCount++;
 	}
 
 	// FIX 3: Log when tiles are recycled (only if verbose logging enabled)
@@ -211,7 +316,7 @@ void UGroundTileManager::CheckForTileRecycling()
 			RecycledCount,
 			TilePool ? TilePool->GetAvailableCount() : 0,
 			TilePool ? TilePool->GetTotalPoolSize() : 0,
-			ActiveTiles.Num());
+			ActiveTileCount);
 	}
 #endif
 
@@ -248,6 +353,118 @@ void UGroundTileManager::CheckForTileRecycling()
 	}
 }
 
+void UGroundTileManager::UpdateAnalyticTiles()
+{
+	if (!TilePool || TileSize <= 0.0f)
+	{
+		return;
+	}
+
+	const float WarRigX = WarRig ? WarRig->GetActorLocation().X : 0.0f;
+	const UWorldScrollComponent* ScrollComponent = GetWorldScrollComponent();
+	const double DistanceTraveled = ScrollComponent ? ScrollComponent->GetDistanceTraveled() : 0.0;
+	const float ScrollDirectionX = ScrollComponent ? ScrollComponent->GetScrollDirection().X : -1.0f;
+
+	const bool bJustAnchored = !bAnalyticRoadAnchored;
+	if (bJustAnchored)
+	{
+		AnalyticAnchorX = WarRigX - TileDespawnDistance;
+		AnalyticAnchorDistance = DistanceTraveled;
+		bAnalyticRoadAnchored = true;
+	}
+
+	// Road scrolled towards -X since anchoring, split into whole tiles and a shared phase in [0, TileSize)
+	const double Scrolled = -static_cast<double>(ScrollDirectionX) * (DistanceTraveled - AnalyticAnchorDistance);
+	const int64 BaseRoadIndex = FMath::FloorToInt64(Scrolled / TileSize);
+	const float Phase = static_cast<float>(Scrolled - static_cast<double>(BaseRoadIndex) * TileSize);
+
+	// Tile at road index BaseRoadIndex + j sits at FirstTileX + j * TileSize
+	const float FirstTileX = AnalyticAnchorX - Phase;
+	const int64 RearRoadIndex = BaseRoadIndex + FMath::CeilToInt64((WarRigX - TileDespawnDistance - FirstTileX) / TileSize);
+	const int64 FrontRoadIndex = BaseRoadIndex + FMath::CeilToInt64((WarRigX + TileSpawnDistance - FirstTileX) / TileSize);
+
+	if (bJustAnchored)
+	{
+		ActiveTileRearRoadIndex = RearRoadIndex;
+	}
+
+	// Road moved backwards (distance reset or reversed direction): start the ring over
+	if (ActiveTileCount > 0 && RearRoadIndex < ActiveTileRearRoadIndex)
+	{
+		while (ActiveTileCount > 0)
+		{
+			RecycleTile(ActiveTiles[ActiveTileHead], ActiveTileHandles[ActiveTileHead]);
+			PopBackTile();
+		}
+	}
+
+	// Whole ring fell behind (frame hitch or extreme speed): relabel it in place, every tile is repositioned below anyway
+	if (ActiveTileCount == 0 || ActiveTileRearRoadIndex + ActiveTileCount <= RearRoadIndex)
+	{
+		ActiveTileRearRoadIndex = RearRoadIndex;
+	}
+
+	// Move rear tiles that fell behind straight to the front; recycle only what the front doesn't need
+	int32 MovedCount = 0;
+	int32 RecycledCount = 0;
+	while (ActiveTileCount > 0 && ActiveTileRearRoadIndex < RearRoadIndex)
+	{
+		AGroundTile* Tile = ActiveTiles[ActiveTileHead];
+		const FPooledActorHandle Handle = ActiveTileHandles[ActiveTileHead];
+		PopBackTile();
+		++ActiveTileRearRoadIndex;
+
+		if (!Tile || !TilePool->IsHandleValid(Handle))
+		{
+			UE_LOG(LogGroundTileManager, Warning, TEXT("Found null or stale tile at the rear of ActiveTiles - removing"));
+			continue;
+		}
+
+		if (ActiveTileRearRoadIndex + ActiveTileCount <= FrontRoadIndex)
+		{
+			PushFrontTile(Tile, Handle);
+			MovedCount++;
+		}
+		else
+		{
+			RecycleTile(Tile, Handle);
+			RecycledCount++;
+		}
+	}
+
+	// Spawn as many tiles as the front needs this frame
+	int32 SpawnedCount = 0;
+	while (ActiveTileRearRoadIndex + ActiveTileCount <= FrontRoadIndex)
+	{
+		const int64 NewRoadIndex = ActiveTileRearRoadIndex + ActiveTileCount;
+		const FVector NewPosition(FirstTileX + static_cast<float>(NewRoadIndex - BaseRoadIndex) * TileSize, 0.0f, 0.0f);
+		if (!SpawnTile(NewPosition))
+		{
+			break;
+		}
+		SpawnedCount++;
+	}
+
+	// Place every tile from the shared phase so no tile accumulates its own offset error
+	for (int32 i = 0; i < ActiveTileCount; ++i)
+	{
+		if (AGroundTile* Tile = ActiveTiles[GetActiveTileRingIndex(i)])
+		{
+			const float TileX = FirstTileX + static_cast<float>(ActiveTileRearRoadIndex + i - BaseRoadIndex) * TileSize;
+			const FVector TileLocation = Tile->GetActorLocation();
+			Tile->SetActorLocation(FVector(TileX, TileLocation.Y, TileLocation.Z));
+		}
+	}
+
+#if GROUND_TILE_VERBOSE_LOGGING
+	if (MovedCount > 0 || RecycledCount > 0 || SpawnedCount > 0)
+	{
+		UE_LOG(LogGroundTileManager, Log, TEXT("Analytic road: moved %d, recycled %d, spawned %d tiles (road index %lld..%lld, phase %.1f)"),
+			MovedCount, RecycledCount, SpawnedCount, ActiveTileRearRoadIndex, ActiveTileRearRoadIndex + ActiveTileCount - 1, Phase);
+	}
+#endif
+}
+
 void UGroundTileManager::DebugShowTiles()
 {
 	bShowDebugVisualization = !bShowDebugVisualization;
@@ -255,11 +472,13 @@ void UGroundTileManager::DebugShowTiles()
 		bShowDebugVisualization ? TEXT("ENABLED") : TEXT("DISABLED"));
 
 	// Also enable/disable debug on tiles
-	for (AGroundTile* Tile : ActiveTiles)
+	for (int32 i = 0; i < ActiveTileCount; ++i)
 	{
+		AGroundTile* Tile = ActiveTiles[GetActiveTileRingIndex(i)];
 		if (Tile)
 		{
 			Tile->bShowDebugBounds = bShowDebugVisualization;
+			Tile->SetActorTickEnabled(bShowDebugVisualization); // Tiles only tick to draw debug bounds
 		}
 	}
 }
@@ -305,9 +524,13 @@ bool UGroundTileManager::LoadConfigFromDataTable()
 	TileSpawnDistance = RowData->TileSpawnDistance;
 	TileDespawnDistance = RowData->TileDespawnDistance;
 
-	// Load optional visual overrides
+	// Load optional visual overrides, resolved once here instead of on every tile spawn
 	ConfiguredTileMesh = RowData->TileMesh;
 	ConfiguredTileMaterial = RowData->TileMaterial;
+	if (UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this))
+	{
+		Preloader->PreloadDataTable(TileDataTable);
+	}
 
 	UE_LOG(LogGroundTileManager, Log, TEXT("Loaded config: TileSize=%.0f, PoolSize=%d, SpawnDist=%.0f, DespawnDist=%.0f"),
 		TileSize, TilePoolSize, TileSpawnDistance, TileDespawnDistance);
@@ -381,6 +604,29 @@ bool UGroundTileManager::LoadConfigFromDataTable()
 	return true;
 }
 
+void UGroundTileManager::ResolveTileAssets()
+{
+	ResolvedTileMesh = UAssetPreloadSubsystem::ResolveAsset(this, ConfiguredTileMesh);
+	ResolvedTileMaterial = UAssetPreloadSubsystem::ResolveAsset(this, ConfiguredTileMaterial);
+}
+
+void UGroundTileManager::HandleTileAssetsPreloaded()
+{
+	if (UAssetPreloadSubsystem* Preloader = UAssetPreloadSubsystem::Get(this))
+	{
+		Preloader->OnPreloadComplete.RemoveDynamic(this, &UGroundTileManager::HandleTileAssetsPreloaded);
+	}
+
+	if (!bWaitingForTileAssets)
+	{
+		return;
+	}
+	bWaitingForTileAssets = false;
+
+	UE_LOG(LogGroundTileManager, Log, TEXT("Tile assets streamed in, setting up the road"));
+	StartRoad();
+}
+
 bool UGroundTileManager::InitializeTilePool()
 {
 	// Validate tile class
@@ -396,26 +642,6 @@ bool UGroundTileManager::InitializeTilePool()
 		UE_LOG(LogGroundTileManager, Warning, TEXT("TileClass does not implement IPoolableActor interface. Pool lifecycle callbacks may not work correctly."));
 	}
 
-	// Create pool component if not exists
-	if (!TilePool)
-	{
-		AActor* Owner = GetOwner();
-		if (!Owner)
-		{
-			UE_LOG(LogGroundTileManager, Error, TEXT("No owner actor"));
-			return false;
-		}
-
-		TilePool = NewObject<UObjectPoolComponent>(Owner, UObjectPoolComponent::StaticClass());
-		if (!TilePool)
-		{
-			UE_LOG(LogGroundTileManager, Error, TEXT("Failed to create tile pool component"));
-			return false;
-		}
-
-		TilePool->RegisterComponent();
-	}
-
 	// Calculate max pool size based on actual coverage requirements
 	// This ensures pool can expand to handle full coverage even if initial size is small
 	const float TotalCoverage = EXTRA_BACK_MARGIN + TileDespawnDistance + TileSpawnDistance;
@@ -428,10 +654,18 @@ bool UGroundTileManager::InitializeTilePool()
 	PoolConfig.bAutoExpand = true;
 	PoolConfig.MaxPoolSize = CalculatedMaxSize;
 
+	// Spread pool creation across frames; SpawnInitialTiles pulls the tiles it needs on demand
+	PoolConfig.bTimeSlicedPrewarm = true;
+	PoolConfig.PrewarmActorsPerFrame = 2;
+
+	// Restarts and map changes start from the size the previous level grew to
+	PoolConfig.bPersistAcrossLevels = true;
+
 	UE_LOG(LogGroundTileManager, Log, TEXT("=== Pool Configuration ==="));
 	UE_LOG(LogGroundTileManager, Log, TEXT("Initial Size: %d"), PoolConfig.PoolSize);
 	UE_LOG(LogGroundTileManager, Log, TEXT("Auto-Expand: %s"), PoolConfig.bAutoExpand ? TEXT("Yes") : TEXT("No"));
 	UE_LOG(LogGroundTileManager, Log, TEXT("Max Size: %d (max of 2x initial or coverage requirement)"), PoolConfig.MaxPoolSize);
+	UE_LOG(LogGroundTileManager, Log, TEXT("Time-Sliced Prewarm: %d per frame"), PoolConfig.PrewarmActorsPerFrame);
 	UE_LOG(LogGroundTileManager, Log, TEXT("  - 2x initial: %d tiles"), TilePoolSize * 2);
 	UE_LOG(LogGroundTileManager, Log, TEXT("  - Coverage requirement: %d tiles (%.0f units coverage)"), MaxRequiredTiles, TotalCoverage);
 
@@ -441,9 +675,18 @@ bool UGroundTileManager::InitializeTilePool()
 		UE_LOG(LogGroundTileManager, Warning, TEXT("Pool size is %d, minimum recommended is 3 for seamless scrolling"), PoolConfig.PoolSize);
 	}
 
-	// Initialize pool
-	bool bSuccess = TilePool->Initialize(TileClass, PoolConfig);
-	if (!bSuccess)
+	// Get the shared tile pool from the world pool subsystem (created and initialized on first use)
+	UObjectPoolSubsystem* PoolSubsystem = UObjectPoolSubsystem::Get(this);
+	if (!PoolSubsystem)
+	{
+		UE_LOG(LogGroundTileManager, Error, TEXT("No object pool subsystem in this world"));
+		return false;
+	}
+
+	// Re-initializing hands back the pool we drew from before
+	PoolSubsystem->ReleasePool(TilePool);
+	TilePool = PoolSubsystem->GetOrCreatePool(TileClass, PoolConfig);
+	if (!TilePool)
 	{
 		UE_LOG(LogGroundTileManager, Error, TEXT("Failed to initialize tile pool"));
 		return false;
@@ -492,36 +735,42 @@ void UGroundTileManager::SpawnInitialTiles()
 	UE_LOG(LogGroundTileManager, Log, TEXT("Attempting to spawn %d tiles (Pool max: %d)"),
 		NumTilesToSpawn, TilePool ? TilePool->GetTotalPoolSize() : 0);
 
-	int32 SuccessCount = 0;
-	int32 FailCount = 0;
+	if (!TilePool)
+	{
+		UE_LOG(LogGroundTileManager, Error, TEXT("Tile pool not initialized"));
+		return;
+	}
 
+	// Acquire the whole initial road in one batch
+	TArray<FTransform> TileTransforms;
+	TileTransforms.Reserve(NumTilesToSpawn);
 	for (int32 i = 0; i < NumTilesToSpawn; ++i)
 	{
-		FVector TilePosition(StartX + (i * TileSize), 0.0f, 0.0f);
-
-		if (TilePool)
-		{
-			UE_LOG(LogGroundTileManager, Verbose, TEXT("  [%d/%d] Attempting spawn at X=%.0f (Pool: %d/%d available)"),
-				i + 1, NumTilesToSpawn, TilePosition.X,
-				TilePool->GetAvailableCount(), TilePool->GetTotalPoolSize());
-		}
+		TileTransforms.Add(FTransform(FVector(StartX + (i * TileSize), 0.0f, 0.0f)));
+	}
 
-		AGroundTile* Tile = SpawnTile(TilePosition);
+	TArray<AActor*> TileActors;
+	TArray<FPooledActorHandle> TileHandles;
+	TilePool->GetFromPoolBatch(TileTransforms, TileActors, &TileHandles);
 
-		if (!Tile)
-		{
-			FailCount++;
-			UE_LOG(LogGroundTileManager, Warning, TEXT("  [%d/%d] FAILED to spawn tile at X=%.0f"), i + 1, NumTilesToSpawn, TilePosition.X);
-		}
-		else
+	int32 SuccessCount = 0;
+	for (int32 i = 0; i < TileActors.Num(); ++i)
+	{
+		if (SetupSpawnedTile(TileActors[i], TileHandles[i]))
 		{
 			SuccessCount++;
 		}
 	}
 
+	const int32 FailCount = NumTilesToSpawn - SuccessCount;
+	if (FailCount > 0)
+	{
+		UE_LOG(LogGroundTileManager, Warning, TEXT("FAILED to spawn %d of %d initial tiles"), FailCount, NumTilesToSpawn);
+	}
+
 	UE_LOG(LogGroundTileManager, Log, TEXT("=== Spawn Results ==="));
 	UE_LOG(LogGroundTileManager, Log, TEXT("Attempted: %d, Success: %d, Failed: %d"), NumTilesToSpawn, SuccessCount, FailCount);
-	UE_LOG(LogGroundTileManager, Log, TEXT("Active tiles: %d"), ActiveTiles.Num());
+	UE_LOG(LogGroundTileManager, Log, TEXT("Active tiles: %d"), ActiveTileCount);
 	if (TilePool)
 	{
 		UE_LOG(LogGroundTileManager, Log, TEXT("Pool: Active=%d, Available=%d, Total=%d"),
@@ -545,7 +794,8 @@ AGroundTile* UGroundTileManager::SpawnTile(const FVector& Position)
 		TilePool->GetTotalPoolSize());
 
 	// Get tile from pool
-	AActor* TileActor = TilePool->GetFromPool(Position, FRotator::ZeroRotator);
+	FPooledActorHandle TileHandle;
+	AActor* TileActor = TilePool->GetFromPoolWithHandle(Position, FRotator::ZeroRotator, TileHandle);
 	if (!TileActor)
 	{
 		UE_LOG(LogGroundTileManager, Error, TEXT("Failed to get tile from pool at X=%.0f! Pool exhausted. Active=%d, Available=%d, Total=%d, ActiveTiles array size=%d"),
@@ -553,15 +803,29 @@ AGroundTile* UGroundTileManager::SpawnTile(const FVector& Position)
 			TilePool->GetActiveCount(),
 			TilePool->GetAvailableCount(),
 			TilePool->GetTotalPoolSize(),
-			ActiveTiles.Num());
+			ActiveTileCount);
 		return nullptr;
 	}
 
+	AGroundTile* Tile = SetupSpawnedTile(TileActor, TileHandle);
+
+	// FIX 3: Log when tile is successfully added to active tiles
+	UE_LOG(LogGroundTileManager, VeryVerbose, TEXT("SpawnTile: Tile successfully spawned and added to ActiveTiles. New ActiveTiles count: %d, Pool state AFTER: Active=%d, Available=%d"),
+		ActiveTileCount,
+		TilePool->GetActiveCount(),
+		TilePool->GetAvailableCount());
+
+	return Tile;
+}
+
+AGroundTile* UGroundTileManager::SetupSpawnedTile(AActor* TileActor, const FPooledActorHandle& TileHandle)
+{
 	// Cast to ground tile
 	AGroundTile* Tile = Cast<AGroundTile>(TileActor);
 	if (!Tile)
 	{
 		UE_LOG(LogGroundTileManager, Error, TEXT("Pooled actor is not a GroundTile"));
+		TilePool->ReturnToPoolByHandle(TileHandle);
 		return nullptr;
 	}
 
@@ -569,44 +833,88 @@ AGroundTile* UGroundTileManager::SpawnTile(const FVector& Position)
 	Tile->SetTileLength(TileSize);
 	IPoolableActor::Execute_OnActivated(Tile);
 	Tile->bShowDebugBounds = bShowDebugVisualization;
+	Tile->SetActorTickEnabled(bShowDebugVisualization); // Scrolling is handled by UScrollMoverSubsystem
+
+	// Analytic placement positions tiles itself
+	if (bAnalyticTilePlacement)
+	{
+		if (UScrollMoverSubsystem* ScrollMovers = UScrollMoverSubsystem::Get(this))
+		{
+			ScrollMovers->UnregisterMover(Tile);
+		}
+	}
 
 	// Apply mesh override from data table if configured
-	if (!ConfiguredTileMesh.IsNull())
+	if (ResolvedTileMesh)
 	{
-		UStaticMesh* MeshToApply = ConfiguredTileMesh.LoadSynchronous();
 		UStaticMeshComponent* MeshComponent = Tile->GetTileMesh();
-		if (MeshToApply && MeshComponent)
+		if (MeshComponent)
 		{
-			MeshComponent->SetStaticMesh(MeshToApply);
-			UE_LOG(LogGroundTileManager, Verbose, TEXT("Applied mesh override to tile: %s"), *MeshToApply->GetName());
+			MeshComponent->SetStaticMesh(ResolvedTileMesh);
+			UE_LOG(LogGroundTileManager, Verbose, TEXT("Applied mesh override to tile: %s"), *ResolvedTileMesh->GetName());
 		}
 	}
 
 	// Apply material override from data table if configured
-	if (!ConfiguredTileMaterial.IsNull())
+	if (ResolvedTileMaterial)
 	{
-		UMaterialInterface* MaterialToApply = ConfiguredTileMaterial.LoadSynchronous();
 		UStaticMeshComponent* MeshComponent = Tile->GetTileMesh();
-		if (MaterialToApply && MeshComponent)
+		if (MeshComponent)
 		{
-			MeshComponent->SetMaterial(0, MaterialToApply);
-			UE_LOG(LogGroundTileManager, Verbose, TEXT("Applied material override to tile: %s"), *MaterialToApply->GetName());
+			MeshComponent->SetMaterial(0, ResolvedTileMaterial);
+			UE_LOG(LogGroundTileManager, Verbose, TEXT("Applied material override to tile: %s"), *ResolvedTileMaterial->GetName());
 		}
 	}
 
-	// Add to active tiles
-	ActiveTiles.Add(Tile);
-
-	// FIX 3: Log when tile is successfully added to active tiles
-	UE_LOG(LogGroundTileManager, VeryVerbose, TEXT("SpawnTile: Tile successfully spawned and added to ActiveTiles. New ActiveTiles count: %d, Pool state AFTER: Active=%d, Available=%d"),
-		ActiveTiles.Num(),
-		TilePool->GetActiveCount(),
-		TilePool->GetAvailableCount());
+	// Tiles are always spawned in front of the current furthest tile
+	PushFrontTile(Tile, TileHandle);
 
 	return Tile;
 }
 
-void UGroundTileManager::RecycleTile(AGroundTile* Tile)
+void UGroundTileManager::PushFrontTile(AGroundTile* Tile, const FPooledActorHandle& Handle)
+{
+	// Grow the ring (pool expanded past its configured size), unrolling it so the rear tile is at index 0
+	if (ActiveTileCount == ActiveTiles.Num())
+	{
+		const int32 NewCapacity = FMath::Max(FMath::Max(TilePoolSize, 4), ActiveTiles.Num() * 2);
+
+		TArray<AGroundTile*> NewTiles;
+		TArray<FPooledActorHandle> NewHandles;
+		NewTiles.SetNumZeroed(NewCapacity);
+		NewHandles.SetNum(NewCapacity);
+		for (int32 i = 0; i < ActiveTileCount; ++i)
+		{
+			const int32 OldIndex = GetActiveTileRingIndex(i);
+			NewTiles[i] = ActiveTiles[OldIndex];
+			NewHandles[i] = ActiveTileHandles[OldIndex];
+		}
+
+		ActiveTiles = MoveTemp(NewTiles);
+		ActiveTileHandles = MoveTemp(NewHandles);
+		ActiveTileHead = 0;
+	}
+
+	const int32 FrontIndex = GetActiveTileRingIndex(ActiveTileCount);
+	ActiveTiles[FrontIndex] = Tile;
+	ActiveTileHandles[FrontIndex] = Handle;
+	++ActiveTileCount;
+}
+
+void UGroundTileManager::PopBackTile()
+{
+	if (ActiveTileCount == 0)
+	{
+		return;
+	}
+
+	ActiveTiles[ActiveTileHead] = nullptr;
+	ActiveTileHandles[ActiveTileHead] = FPooledActorHandle();
+	ActiveTileHead = (ActiveTileHead + 1) % ActiveTiles.Num();
+	--ActiveTileCount;
+}
+
+void UGroundTileManager::RecycleTile(AGroundTile* Tile, const FPooledActorHandle& Handle)
 {
 	if (!Tile || !TilePool)
 	{
@@ -616,12 +924,172 @@ void UGroundTileManager::RecycleTile(AGroundTile* Tile)
 	// Deactivate tile
 	IPoolableActor::Execute_OnDeactivated(Tile);
 
-	// Return to pool
-	TilePool->ReturnToPool(Tile);
+	// Return to pool (handle rejects tiles that were already returned)
+	TilePool->ReturnToPoolByHandle(Handle);
 
 	UE_LOG(LogGroundTileManager, VeryVerbose, TEXT("Tile recycled"));
 }
 
+void UGroundTileManager::BuildInstancedRoad()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	// Mesh, material and mesh offset come from the tile class defaults, with data table overrides
+	const AGroundTile* TileDefaults = TileClass ? TileClass->GetDefaultObject<AGroundTile>() : GetDefault<AGroundTile>();
+	const UStaticMeshComponent* TemplateMesh = TileDefaults ? TileDefaults->GetTileMesh() : nullptr;
+
+	UStaticMesh* RoadMesh = ResolvedTileMesh ? ResolvedTileMesh.Get()
+		: (TemplateMesh ? TemplateMesh->GetStaticMesh().Get() : nullptr);
+	UMaterialInterface* RoadMaterial = ResolvedTileMaterial ? ResolvedTileMaterial.Get()
+		: (TemplateMesh ? TemplateMesh->GetMaterial(0) : nullptr);
+	RoadInstanceBaseTransform = TemplateMesh ? TemplateMesh->GetRelativeTransform() : FTransform::Identity;
+
+	if (!RoadMesh)
+	{
+		UE_LOG(LogGroundTileManager, Error, TEXT("Instanced road has no mesh (set TileClass or a TileMesh override)"));
+		return;
+	}
+
+	if (!RoadInstances)
+	{
+		RoadInstances = NewObject<UInstancedStaticMeshComponent>(Owner, TEXT("InstancedRoad"));
+		RoadInstances->SetMobility(EComponentMobility::Movable);
+		RoadInstances->SetUsingAbsoluteLocation(true);
+		RoadInstances->SetUsingAbsoluteRotation(true);
+		RoadInstances->SetUsingAbsoluteScale(true);
+		RoadInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision); // Purely visual, like AGroundTile
+		RoadInstances->RegisterComponent();
+	}
+
+	RoadInstances->SetStaticMesh(RoadMesh);
+	if (RoadMaterial)
+	{
+		RoadInstances->SetMaterial(0, RoadMaterial);
+	}
+	RoadInstances->SetWorldLocation(FVector::ZeroVector);
+	RoadInstances->ClearInstances();
+
+	// Same coverage as the pooled road: extra back margin + despawn distance + spawn distance
+	const float WarRigX = WarRig ? WarRig->GetActorLocation().X : 0.0f;
+	const float StartX = WarRigX - TileDespawnDistance - EXTRA_BACK_MARGIN;
+	const float TotalCoverage = EXTRA_BACK_MARGIN + TileDespawnDistance + TileSpawnDistance;
+	const int32 NumInstances = FMath::Max(3, FMath::CeilToInt(TotalCoverage / TileSize) + 2);
+
+	TArray<FTransform> InstanceTransforms;
+	InstanceTransforms.Reserve(NumInstances);
+	RoadInstanceLocalX.Reset(NumInstances);
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		const float LocalX = StartX + (i * TileSize);
+		RoadInstanceLocalX.Add(LocalX);
+		InstanceTransforms.Add(MakeRoadInstanceTransform(LocalX));
+	}
+
+	RoadInstances->AddInstances(InstanceTransforms, false);
+	RoadRingHead = 0;
+
+	// The component sits at X = 0 at the current scroll distance and follows it from there
+	const UWorldScrollComponent* ScrollComponent = GetWorldScrollComponent();
+	RoadAnchorDistance = ScrollComponent ? ScrollComponent->GetDistanceTraveled() : 0.0;
+
+	UE_LOG(LogGroundTileManager, Log, TEXT("Instanced road built: %d instances of %s from X=%.0f"),
+		NumInstances, *RoadMesh->GetName(), StartX);
+}
+
+void UGroundTileManager::UpdateInstancedRoad()
+{
+	if (!RoadInstances || RoadInstanceLocalX.Num() == 0 || TileSize <= 0.0f)
+	{
+		return;
+	}
+
+	// Place the component from the scroll distance (same source and tick order as every other scrolled actor)
+	const UWorldScrollComponent* ScrollComponent = GetWorldScrollComponent();
+	const double DistanceTraveled = ScrollComponent ? ScrollComponent->GetDistanceTraveled() : RoadAnchorDistance;
+	const float ScrollDirectionX = ScrollComponent ? ScrollComponent->GetScrollDirection().X : -1.0f;
+
+	// Road moved backwards (distance reset or reversed direction): start the ring over around the war rig
+	// (the difference is small between rebases, so it fits a float)
+	const float ScrolledSinceAnchor = static_cast<float>(-static_cast<double>(ScrollDirectionX) * (DistanceTraveled - RoadAnchorDistance));
+	if (ScrolledSinceAnchor < 0.0f)
+	{
+		BuildInstancedRoad();
+		return;
+	}
+
+	const int32 NumInstances = RoadInstanceLocalX.Num();
+	float ComponentX = -ScrolledSinceAnchor;
+
+	// Keep instance coordinates small: fold the component offset into the instances and re-anchor at the current distance
+	const bool bRebase = FMath::Abs(ComponentX) > INSTANCED_ROAD_REBASE_DISTANCE;
+	if (bRebase)
+	{
+		for (float& LocalX : RoadInstanceLocalX)
+		{
+			LocalX += ComponentX;
+		}
+		RoadAnchorDistance = DistanceTraveled;
+		ComponentX = 0.0f;
+	}
+
+	RoadInstances->SetWorldLocation(FVector(ComponentX, 0.0f, 0.0f));
+
+	const float WarRigX = WarRig ? WarRig->GetActorLocation().X : 0.0f;
+	const float DespawnThreshold = WarRigX - TileDespawnDistance;
+
+	// Whole ring fell behind (frame hitch or extreme speed): advance every instance by whole ring lengths first
+	const int32 FrontIndex = (RoadRingHead + NumInstances - 1) % NumInstances;
+	const float RingLength = NumInstances * TileSize;
+	const float FrontBehind = DespawnThreshold - (ComponentX + RoadInstanceLocalX[FrontIndex]);
+	const bool bRingJumped = FrontBehind > 0.0f;
+	if (bRingJumped)
+	{
+		const float RingShift = FMath::CeilToFloat(FrontBehind / RingLength) * RingLength;
+		for (float& LocalX : RoadInstanceLocalX)
+		{
+			LocalX += RingShift;
+		}
+	}
+
+	// Move rear instances that passed the despawn threshold to the front of the ring
+	int32 RecycledCount = 0;
+	while (RecycledCount < NumInstances && ComponentX + RoadInstanceLocalX[RoadRingHead] < DespawnThreshold)
+	{
+		const int32 PrevFrontIndex = (RoadRingHead + NumInstances - 1) % NumInstances;
+		RoadInstanceLocalX[RoadRingHead] = RoadInstanceLocalX[PrevFrontIndex] + TileSize;
+		if (!bRebase && !bRingJumped)
+		{
+			RoadInstances->UpdateInstanceTransform(RoadRingHead, MakeRoadInstanceTransform(RoadInstanceLocalX[RoadRingHead]), false, true, true);
+		}
+
+		RoadRingHead = (RoadRingHead + 1) % NumInstances;
+		++RecycledCount;
+	}
+
+	// Every instance moved: rewrite them in one batch
+	if (bRebase || bRingJumped)
+	{
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.Reserve(NumInstances);
+		for (const float LocalX : RoadInstanceLocalX)
+		{
+			InstanceTransforms.Add(MakeRoadInstanceTransform(LocalX));
+		}
+		RoadInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, false, true, true);
+	}
+}
+
+FTransform UGroundTileManager::MakeRoadInstanceTransform(float LocalX) const
+{
+	FTransform InstanceTransform = RoadInstanceBaseTransform;
+	InstanceTransform.AddToTranslation(FVector(LocalX, 0.0f, 0.0f));
+	return InstanceTransform;
+}
+
 AActor* UGroundTileManager::GetWarRig()
 {
 	// Try to get war rig from player controller
@@ -653,6 +1121,11 @@ AActor* UGroundTileManager::GetWarRig()
 
 UWorldScrollComponent* UGroundTileManager::GetWorldScrollComponent() const
 {
+	if (ScrollSource)
+	{
+		return ScrollSource;
+	}
+
 	AWhitelineNightmareGameMode* GameMode = Cast<AWhitelineNightmareGameMode>(
 		UGameplayStatics::GetGameMode(this));
 
@@ -696,14 +1169,15 @@ void UGroundTileManager::DrawDebugVisualization()
 
 	// Draw tile count
 	DrawDebugString(World, WarRig->GetActorLocation() + FVector(0.0f, 0.0f, 500.0f),
-		FString::Printf(TEXT("Active Tiles: %d"), ActiveTiles.Num()),
+		FString::Printf(TEXT("Active Tiles: %d"), GetActiveTileCount()),
 		nullptr, FColor::White, 0.0f, true);
 }
 
 void UGroundTileManager::LogManagerState() const
 {
 	UE_LOG(LogGroundTileManager, Log, TEXT("=== Ground Tile Manager State ==="));
-	UE_LOG(LogGroundTileManager, Log, TEXT("Active Tiles: %d"), ActiveTiles.Num());
+	UE_LOG(LogGroundTileManager, Log, TEXT("Active Tiles: %d%s"), GetActiveTileCount(),
+		bUseInstancedRoad ? TEXT(" (instanced road)") : (bAnalyticTilePlacement ? TEXT(" (analytic placement)") : TEXT("")));
 	UE_LOG(LogGroundTileManager, Log, TEXT("Tile Size: %.0f"), TileSize);
 	UE_LOG(LogGroundTileManager, Log, TEXT("Spawn Distance: %.0f"), TileSpawnDistance);
 	UE_LOG(LogGroundTileManager, Log, TEXT("Despawn Distance: %.0f"), TileDespawnDistance);
@@ -721,15 +1195,15 @@ void UGroundTileManager::LogManagerState() const
 			TilePool->GetActiveCount(), TilePool->GetAvailableCount(), TilePool->GetTotalPoolSize());
 	}
 
-	// List all active tile positions
-	if (ActiveTiles.Num() > 0)
+	// List all active tile positions, rear to front
+	if (ActiveTileCount > 0)
 	{
 		UE_LOG(LogGroundTileManager, Log, TEXT("Active Tile Positions:"));
-		for (int32 i = 0; i < ActiveTiles.Num(); ++i)
+		for (int32 i = 0; i < ActiveTileCount; ++i)
 		{
-			if (ActiveTiles[i])
+			if (const AGroundTile* Tile = ActiveTiles[GetActiveTileRingIndex(i)])
 			{
-				FVector Pos = ActiveTiles[i]->GetActorLocation();
+				FVector Pos = Tile->GetActorLocation();
 				UE_LOG(LogGroundTileManager, Log, TEXT("  [%d] X: %.0f, Y: %.0f, Z: %.0f"),
 					i, Pos.X, Pos.Y, Pos.Z);
 			}
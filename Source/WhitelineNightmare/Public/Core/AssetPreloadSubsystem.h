@@ -0,0 +1,156 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/SoftObjectPtr.h"
+#include "AssetPreloadSubsystem.generated.h"
+
+class UDataTable;
+struct FStreamableHandle;
+struct FWarRigData;
+struct FTurretData;
+struct FEnemyData;
+struct FPickupData;
+struct FWorldTileData;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAssetPreloadProgress, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAssetPreloadComplete);
+
+/**
+ * Asset Preload Subsystem - Streams data table soft references at level start
+ *
+ * Walks FWorldTileData, FTurretData, FPickupData, FWarRigData and FEnemyData rows, collects
+ * every soft asset reference and requests them in one async streaming batch per table. The
+ * streaming handles keep the assets resident for the lifetime of the world, so gameplay code
+ * resolves soft pointers to hard pointers with ResolveAsset without touching the disk.
+ *
+ * Usage:
+ * 1. UAssetPreloadSubsystem::Get(this)->PreloadDataTable(MyTable) as early as possible
+ *    (AWhitelineNightmareGameMode::InitGame does this for the tables its consumers read)
+ * 2. Consumers defer asset-dependent setup until IsPreloadComplete() / OnPreloadComplete
+ * 3. UAssetPreloadSubsystem::ResolveAsset(this, Row.SomeMesh) where the asset is needed
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UAssetPreloadSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the preload subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UAssetPreloadSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Stream every soft asset referenced by a data table's rows (no-op for tables already preloaded)
+	 * @param DataTable - Table with a supported row struct
+	 * @return Number of assets requested (0 if all were already resident or the row struct is unsupported)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asset Preload")
+	int32 PreloadDataTable(const UDataTable* DataTable);
+
+	/**
+	 * Stream a list of assets
+	 * @param AssetPaths - Assets to load (already resident assets are skipped)
+	 * @return Number of assets requested
+	 */
+	int32 PreloadAssets(const TArray<FSoftObjectPath>& AssetPaths);
+
+	/**
+	 * Get overall progress of every preload requested so far
+	 * @return Progress from 0 to 1 (1 when nothing is pending)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Asset Preload")
+	float GetPreloadProgress() const;
+
+	/**
+	 * Check whether every requested preload has finished
+	 * @return True if nothing is still streaming
+	 */
+	UFUNCTION(BlueprintPure, Category = "Asset Preload")
+	bool IsPreloadComplete() const;
+
+	/**
+	 * Get the number of assets that had to be loaded synchronously because they were not preloaded
+	 * @return Sync fallback count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Asset Preload")
+	int32 GetSyncFallbackCount() const { return SyncFallbackCount; }
+
+	/**
+	 * Resolve a soft reference to a hard pointer. Preloaded assets return immediately; anything
+	 * else is loaded synchronously with a warning so missing preloads show up in the log.
+	 * @param WorldContextObject - Any object living in the target world (may be null)
+	 * @param SoftAsset - Asset to resolve
+	 * @return Loaded asset or nullptr if the reference is null or fails to load
+	 */
+	template<typename T>
+	static T* ResolveAsset(const UObject* WorldContextObject, const TSoftObjectPtr<T>& SoftAsset)
+	{
+		if (SoftAsset.IsNull())
+		{
+			return nullptr;
+		}
+
+		if (T* Resident = SoftAsset.Get())
+		{
+			return Resident;
+		}
+
+		NoteSyncFallback(WorldContextObject, SoftAsset.ToSoftObjectPath());
+		return SoftAsset.LoadSynchronous();
+	}
+
+	// Broadcast whenever streaming progress changes
+	UPROPERTY(BlueprintAssignable, Category = "Asset Preload")
+	FOnAssetPreloadProgress OnPreloadProgress;
+
+	// Broadcast when every requested preload has finished
+	UPROPERTY(BlueprintAssignable, Category = "Asset Preload")
+	FOnAssetPreloadComplete OnPreloadComplete;
+
+	// Row gatherers (append the soft references of one row)
+	static void GatherRowAssets(const FWorldTileData& Row, TArray<FSoftObjectPath>& OutPaths);
+	static void GatherRowAssets(const FTurretData& Row, TArray<FSoftObjectPath>& OutPaths);
+	static void GatherRowAssets(const FPickupData& Row, TArray<FSoftObjectPath>& OutPaths);
+	static void GatherRowAssets(const FWarRigData& Row, TArray<FSoftObjectPath>& OutPaths);
+	static void GatherRowAssets(const FEnemyData& Row, TArray<FSoftObjectPath>& OutPaths);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Record and log a soft reference that had to be loaded synchronously
+	 * @param WorldContextObject - Any object living in the target world (may be null)
+	 * @param AssetPath - Asset that was not preloaded
+	 */
+	static void NoteSyncFallback(const UObject* WorldContextObject, const FSoftObjectPath& AssetPath);
+
+	/**
+	 * Streaming update/complete callback: broadcast progress and completion
+	 */
+	void HandleStreamingUpdate();
+
+	// In-flight and completed streaming requests (completed handles keep their assets resident)
+	TArray<TSharedPtr<FStreamableHandle>> PreloadHandles;
+
+	// Tables already walked
+	TSet<TWeakObjectPtr<const UDataTable>> PreloadedTables;
+
+	// Assets already requested
+	TSet<FSoftObjectPath> RequestedAssets;
+
+	// Soft references loaded synchronously because they were not preloaded
+	int32 SyncFallbackCount = 0;
+
+	// True once OnPreloadComplete has fired for the current requests
+	bool bCompleteBroadcast = true;
+};
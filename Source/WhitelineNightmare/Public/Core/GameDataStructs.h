@@ -354,6 +354,18 @@ struct FTurretData : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Combat")
 	float BaseHealth;
 
+	// Projectile speed in units per second (0 = hitscan)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	float ProjectileSpeed;
+
+	// Projectile collision radius
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	float ProjectileRadius;
+
+	// Mesh rendered for each projectile (instanced by the projectile subsystem)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	TSoftObjectPtr<UStaticMesh> ProjectileMesh;
+
 	// Cost in scrap to build
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Economy")
 	int32 BuildCost;
@@ -370,6 +382,8 @@ struct FTurretData : public FTableRowBase
 		, FireRate(1.0f)
 		, Range(1000.0f)
 		, BaseHealth(100.0f)
+		, ProjectileSpeed(5000.0f)
+		, ProjectileRadius(10.0f)
 		, BuildCost(50)
 		, UpgradeCost(25)
 	{
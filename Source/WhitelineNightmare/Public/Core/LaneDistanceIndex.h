@@ -0,0 +1,127 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+
+/**
+ * Lane Distance Index - Bucket grid of scrolling entities by lane and road distance
+ *
+ * Each lane owns a ring of fixed-length distance buckets. An entity lives in exactly one
+ * bucket, so insert/update/remove are O(1) and a query visits only the buckets covering the
+ * requested lanes and distance range. Entries keep their exact distance, so buckets that
+ * alias in the ring are filtered per entry; the ring only has to be long enough to keep
+ * aliasing rare, not to cover the whole road.
+ *
+ * Road distance is expected to stay constant for an entity that scrolls with the world (see
+ * UScrollMoverSubsystem::GetRoadDistanceAtWorldX), so most entities are registered once.
+ */
+class WHITELINENIGHTMARE_API FLaneDistanceIndex
+{
+public:
+	FLaneDistanceIndex();
+
+	/**
+	 * Configure the grid (clears all entries)
+	 * @param InNumLanes - Initial lane count (grows on demand)
+	 * @param InBucketLength - Road length covered by one bucket
+	 * @param InNumBuckets - Buckets per lane ring
+	 */
+	void Initialize(int32 InNumLanes, float InBucketLength, int32 InNumBuckets);
+
+	/**
+	 * Add an entity, or move it if it is already indexed
+	 * @param Actor - Entity to index
+	 * @param Lane - Lane index (>= 0)
+	 * @param RoadDistance - Distance along the road
+	 * @return False if the actor is null or the lane is negative
+	 */
+	bool Add(AActor* Actor, int32 Lane, float RoadDistance);
+
+	/**
+	 * Remove an entity (no-op if not indexed)
+	 * @param Actor - Entity to remove
+	 * @return True if the actor was indexed
+	 */
+	bool Remove(const AActor* Actor);
+
+	/**
+	 * Remove an entity by key (works after the actor has been destroyed and collected)
+	 * @param Key - Key of the entity to remove
+	 * @return True if the entity was indexed
+	 */
+	bool Remove(const TObjectKey<AActor>& Key);
+
+	/**
+	 * Collect every entity in lanes LaneMin..LaneMax with road distance in [DistanceMin, DistanceMax]
+	 * @param LaneMin - First lane (inclusive)
+	 * @param LaneMax - Last lane (inclusive)
+	 * @param DistanceMin - Start of the distance range (inclusive)
+	 * @param DistanceMax - End of the distance range (inclusive)
+	 * @param OutActors - Receives matching entities (appended)
+	 * @return Number of entities appended
+	 */
+	int32 Query(int32 LaneMin, int32 LaneMax, float DistanceMin, float DistanceMax, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Check whether an entity is indexed
+	 * @param Actor - Entity to check
+	 * @return True if indexed
+	 */
+	bool Contains(const AActor* Actor) const { return Locations.Contains(TObjectKey<AActor>(Actor)); }
+
+	/**
+	 * Get the lane and road distance an entity was indexed with
+	 * @param Actor - Entity to look up
+	 * @param OutLane - Receives the lane
+	 * @param OutRoadDistance - Receives the road distance
+	 * @return False if the actor is not indexed
+	 */
+	bool GetEntry(const AActor* Actor, int32& OutLane, float& OutRoadDistance) const;
+
+	/** Number of indexed entities */
+	int32 Num() const { return Locations.Num(); }
+
+	/** Number of lanes currently in the grid */
+	int32 GetNumLanes() const { return Lanes.Num(); }
+
+	/** Remove every entity (keeps the grid) */
+	void Reset();
+
+private:
+	struct FEntry
+	{
+		// Lookup key (unique per object, so a later actor at the same address never matches)
+		TObjectKey<AActor> Key;
+		TWeakObjectPtr<AActor> Actor;
+		float RoadDistance;
+	};
+
+	struct FLocation
+	{
+		int32 Lane;
+		int32 Bucket;
+		int32 EntryIndex;
+	};
+
+	/** Ring bucket slot for a road distance */
+	int32 GetBucketSlot(float RoadDistance) const;
+
+	/** Remove the entry at a location and patch the entry swapped into its place */
+	void RemoveAt(const FLocation& Location);
+
+	// Lanes[Lane][BucketSlot] -> entries
+	TArray<TArray<TArray<FEntry>>> Lanes;
+
+	// Entity -> where it is stored
+	TMap<TObjectKey<AActor>, FLocation> Locations;
+
+	// Road length covered by one bucket
+	float BucketLength;
+
+	// Buckets per lane ring
+	int32 NumBuckets;
+};
@@ -0,0 +1,120 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ObjectPoolTypes.h"
+#include "ObjectPoolCacheSubsystem.generated.h"
+
+class UObjectPoolComponent;
+
+/**
+ * Cached Pool Entry - Pooled actors of one class parked between levels
+ */
+USTRUCT()
+struct FCachedPoolEntry
+{
+	GENERATED_BODY()
+
+	// Inactive actors waiting for the next level's pool (weak: a hard travel still destroys them)
+	UPROPERTY()
+	TArray<TWeakObjectPtr<AActor>> ParkedActors;
+};
+
+/**
+ * Object Pool Cache Subsystem - Carries pooled actors across level loads
+ *
+ * Pools initialized with FObjectPoolConfig::bPersistAcrossLevels hand their actors over
+ * here when the level is left through seamless travel. The game mode lists the parked
+ * actors in GetSeamlessTravelActorList, so the engine moves them into the next world
+ * instead of destroying them, and the next level's pool of the same class adopts them in
+ * Initialize() before spawning anything. Later loads of a run skip the respawn cost for
+ * every parked actor.
+ *
+ * A hard travel (OpenLevel, or seamless travel disabled in PIE) still destroys parked
+ * actors with their world; pools then simply spawn as usual.
+ *
+ * Usage:
+ * 1. AWhitelineNightmareGameMode::GetSeamlessTravelActorList calls ParkPools() and GetParkedActors()
+ * 2. UObjectPoolComponent::Initialize() calls TakeParkedActors() for persisted pools
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UObjectPoolCacheSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the pool cache for a world context object
+	 * @param WorldContextObject - Any object living in a world owned by the game instance
+	 * @return Subsystem or nullptr if there is no game instance (e.g. editor worlds)
+	 */
+	static UObjectPoolCacheSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Park the actors of every persisted pool in a world (called as the world is left)
+	 * Actors parked in an earlier level and never adopted are destroyed first.
+	 * @param World - World being left
+	 * @return Number of actors parked
+	 */
+	int32 ParkPools(UWorld* World);
+
+	/**
+	 * Take every actor out of one pool and park it
+	 * @param Pool - Pool to empty (its active actors are returned first)
+	 * @return Number of actors parked
+	 */
+	int32 ParkPool(UObjectPoolComponent* Pool);
+
+	/**
+	 * Get every parked actor still alive (the actors to keep through travel)
+	 * @param OutActors - Receives the parked actors (appended)
+	 */
+	void GetParkedActors(TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Hand parked actors of a class to a pool in the given world
+	 * @param ActorClass - Pooled actor class
+	 * @param World - World the adopting pool lives in (actors elsewhere are left parked)
+	 * @param MaxCount - Most actors to take
+	 * @param OutActors - Receives the taken actors (appended)
+	 * @return Number of actors taken
+	 */
+	int32 TakeParkedActors(TSubclassOf<AActor> ActorClass, const UWorld* World, int32 MaxCount, TArray<AActor*>& OutActors);
+
+	/**
+	 * Get the number of parked actors of a class
+	 * @param ActorClass - Pooled actor class
+	 * @return Parked actors still alive
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Cache")
+	int32 GetParkedActorCount(TSubclassOf<AActor> ActorClass) const;
+
+	/**
+	 * Destroy the parked actors of a class and drop its entry
+	 * @param ActorClass - Pooled actor class
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Cache")
+	void ForgetClass(TSubclassOf<AActor> ActorClass);
+
+	/**
+	 * Destroy every parked actor
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Cache")
+	void ClearCache();
+
+private:
+	/**
+	 * Destroy the parked actors of one entry
+	 * @param Entry - Entry to empty
+	 */
+	static void DestroyParkedActors(FCachedPoolEntry& Entry);
+
+	// Parked actors keyed by pooled actor class (the key keeps the class and its default assets loaded)
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, FCachedPoolEntry> CachedPools;
+};
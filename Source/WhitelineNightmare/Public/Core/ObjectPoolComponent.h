@@ -7,17 +7,37 @@
 #include "ObjectPoolTypes.h"
 #include "ObjectPoolComponent.generated.h"
 
+class UObjectPoolComponent;
+
+/** Broadcast when a pool reaches a prewarm milestone (ready threshold or fully spawned) */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectPoolPrewarmEvent, UObjectPoolComponent*, Pool);
+
 /**
  * Object Pool Component - Manages a pool of reusable actors
  *
  * This component provides efficient object pooling for frequently spawned/despawned actors.
  * Instead of destroying and creating new actors, it recycles them from a pool.
  *
+ * Prefer UObjectPoolSubsystem::GetOrCreatePool() so systems spawning the same class
+ * share one pool. Initialized pools register with the subsystem for stats/debugging.
+ *
  * Usage:
  * 1. Add component to your manager actor
  * 2. Call Initialize() with the actor class and config
  * 3. Use GetFromPool() to get an actor when needed
  * 4. Use ReturnToPool() when done with the actor
+ *
+ * With FObjectPoolConfig::bTimeSlicedPrewarm the initial actors are spawned a few per
+ * frame after Initialize() returns. GetFromPool() still works during prewarm: if nothing
+ * is available yet it spawns one of the pending actors immediately.
+ *
+ * With FObjectPoolConfig::bAdaptiveSizing the pool tracks peak demand over a moving
+ * window, spawns ahead of that peak from TickComponent and trims idle actors back
+ * towards MinPoolSize after sustained low usage.
+ *
+ * With FObjectPoolConfig::bDeferActorStateChanges, hide/collision/tick changes are
+ * queued and applied in one pass after all actors have ticked. Pool bookkeeping,
+ * placement and IPoolableActor callbacks still happen immediately.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class WHITELINENIGHTMARE_API UObjectPoolComponent : public UActorComponent
@@ -45,6 +65,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
 	AActor* GetFromPool(FVector SpawnLocation, FRotator SpawnRotation);
 
+	/**
+	 * Get an actor from the pool along with a handle that detects use-after-return
+	 * @param SpawnLocation - Location to place the actor
+	 * @param SpawnRotation - Rotation to apply to the actor
+	 * @param OutHandle - Handle for the returned actor (reset if the pool is exhausted)
+	 * @return Pooled actor or nullptr if pool is exhausted and cannot expand
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	AActor* GetFromPoolWithHandle(FVector SpawnLocation, FRotator SpawnRotation, FPooledActorHandle& OutHandle);
+
+	/**
+	 * Get several actors in one pass (reserve, place, then notify OnActivated)
+	 * Stops at the first request the pool can't serve; logs once per batch.
+	 * @param SpawnTransforms - World transform for each requested actor
+	 * @param OutActors - Receives the acquired actors, in request order
+	 * @param OutHandles - Optional, receives a handle per acquired actor
+	 * @return Number of actors acquired
+	 */
+	int32 GetFromPoolBatch(TArrayView<const FTransform> SpawnTransforms, TArray<AActor*>& OutActors, TArray<FPooledActorHandle>* OutHandles = nullptr);
+
 	/**
 	 * Return an actor to the pool
 	 * @param Actor - Actor to return to the pool
@@ -53,6 +93,46 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
 	bool ReturnToPool(AActor* Actor);
 
+	/**
+	 * Return several actors in one pass (release slots, notify OnDeactivated, then deactivate)
+	 * Actors not active in this pool (including duplicates in the batch) are skipped.
+	 * @param Actors - Actors to return
+	 * @return Number of actors returned
+	 */
+	int32 ReturnToPoolBatch(TArrayView<AActor* const> Actors);
+
+	/**
+	 * Return the actor referenced by a handle to the pool
+	 * @param Handle - Handle issued by GetFromPoolWithHandle or GetHandleForActor
+	 * @return True if the handle was still valid and the actor was returned
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	bool ReturnToPoolByHandle(const FPooledActorHandle& Handle);
+
+	/**
+	 * Resolve a handle to its actor
+	 * @param Handle - Handle to resolve
+	 * @return The actor, or nullptr if the handle is stale (actor was returned since)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	AActor* ResolveHandle(const FPooledActorHandle& Handle) const;
+
+	/**
+	 * Check whether a handle still refers to an active actor
+	 * @param Handle - Handle to check
+	 * @return True if the actor has not been returned since the handle was issued
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	bool IsHandleValid(const FPooledActorHandle& Handle) const;
+
+	/**
+	 * Get a handle for an actor that is currently active in this pool
+	 * @param Actor - Active pooled actor
+	 * @return Handle, or an unset handle if the actor is not active in this pool
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	FPooledActorHandle GetHandleForActor(const AActor* Actor) const;
+
 	/**
 	 * Get the number of currently active (in-use) objects
 	 * @return Number of active objects
@@ -75,13 +155,13 @@ public:
 	bool HasAvailable() const { return AvailableObjects.Num() > 0; }
 
 	/**
-	 * Return all active objects to the pool
+	 * Return all active objects to the pool (rejected while the pool is shared, see IsShared)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
 	void ClearPool();
 
 	/**
-	 * Return all objects to the pool and reset their state
+	 * Return all objects to the pool and reset their state (rejected while the pool is shared)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool")
 	void ResetPool();
@@ -93,6 +173,100 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Object Pool")
 	int32 GetTotalPoolSize() const { return ActiveObjects.Num() + AvailableObjects.Num(); }
 
+	/**
+	 * Check if the pool is still spawning its initial actors over multiple frames
+	 * @return True while time-sliced prewarm is in progress
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Prewarm")
+	bool IsPrewarming() const { return PendingPrewarmCount > 0; }
+
+	/**
+	 * Check if the pool has spawned at least MinReadyCount actors
+	 * @return True once the ready threshold has been reached
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Prewarm")
+	bool IsPoolReady() const { return bPoolReady; }
+
+	/** Fired once the pool has spawned MinReadyCount actors (immediately after Initialize if not time-sliced) */
+	UPROPERTY(BlueprintAssignable, Category = "Object Pool|Prewarm")
+	FOnObjectPoolPrewarmEvent OnPoolReady;
+
+	/** Fired once the whole initial pool has been spawned */
+	UPROPERTY(BlueprintAssignable, Category = "Object Pool|Prewarm")
+	FOnObjectPoolPrewarmEvent OnPrewarmComplete;
+
+	/**
+	 * Get usage statistics for this pool (leak count is evaluated at call time)
+	 * @return Snapshot of the pool's counters
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Stats")
+	FObjectPoolStats GetPoolStats() const;
+
+	/**
+	 * Reset all usage counters (peak active restarts from the current active count)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Stats")
+	void ResetPoolStats();
+
+	/**
+	 * Collect active actors that have been out of the pool longer than LeakDetectionTTL
+	 * @param OutLeakedActors - Receives the likely leaked actors
+	 */
+	void GetLeakedActors(TArray<AActor*>& OutLeakedActors) const;
+
+	/**
+	 * Get the class of actors managed by this pool
+	 * @return Pooled actor class (null before Initialize)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	TSubclassOf<AActor> GetPooledActorClass() const { return PooledActorClass; }
+
+	/**
+	 * Check whether this pool's actors are carried across level loads
+	 * @return True if the pool was initialized with bPersistAcrossLevels
+	 */
+	bool IsPersistentAcrossLevels() const { return bIsInitialized && PoolConfig.bPersistAcrossLevels; }
+
+	/**
+	 * Get the configuration the pool was initialized with
+	 * @return Pool configuration
+	 */
+	const FObjectPoolConfig& GetPoolConfig() const { return PoolConfig; }
+
+	/**
+	 * Record another system drawing from this pool (UObjectPoolSubsystem counts shared pool consumers)
+	 */
+	void AddConsumer() { ++ConsumerCount; }
+
+	/**
+	 * Record that a system stopped drawing from this pool
+	 */
+	void RemoveConsumer();
+
+	/**
+	 * Get the number of systems drawing from this pool through UObjectPoolSubsystem
+	 * @return Consumer count (0 for pools owned directly by one system)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	int32 GetConsumerCount() const { return ConsumerCount; }
+
+	/**
+	 * Check whether more than one system draws from this pool
+	 * Pool-wide calls (ClearPool, ResetPool, ReleaseAllActors, Initialize) are rejected while shared,
+	 * since they would take out the other consumers' active actors.
+	 * @return True if the pool has more than one consumer
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	bool IsShared() const { return ConsumerCount > 1; }
+
+	/**
+	 * Return every actor and hand them all out of the pool, inactive and unowned
+	 * (used to park actors across level loads; the pool is left empty; rejected while shared)
+	 * @param OutActors - Receives the released actors (appended)
+	 * @return Number of actors released
+	 */
+	int32 ReleaseAllActors(TArray<AActor*>& OutActors);
+
 	/**
 	 * Check if debug visualization is enabled
 	 * @return True if debug visualization is enabled
@@ -105,12 +279,41 @@ public:
 	 * @param bEnabled - Whether to show debug visualization
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Object Pool|Debug")
-	void SetDebugVisualization(bool bEnabled) { bShowDebugVisualization = bEnabled; }
+	void SetDebugVisualization(bool bEnabled);
+
+	/**
+	 * Get the size adaptive sizing is currently steering towards
+	 * @return Target pool size (PoolSize if adaptive sizing is disabled)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Adaptive")
+	int32 GetAdaptiveTargetSize() const;
+
+	/**
+	 * Apply queued activation/deactivation now instead of at the end of the frame
+	 * Actors whose final state matches their applied state are left untouched.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool|Activation")
+	void FlushDeferredStateChanges();
+
+	/**
+	 * Get the number of slots waiting for the deferred state pass
+	 * @return Number of queued slots
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool|Activation")
+	int32 GetPendingStateChangeCount() const { return DirtySlotIndices.Num(); }
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	/**
+	 * Called whenever the pool spawns a new actor (prewarm, on-demand or expansion)
+	 * or adopts one parked by a previous level. Override to inject references into pooled actors
+	 * @param Actor - Newly spawned or adopted actor
+	 */
+	virtual void OnPooledActorSpawned(AActor* Actor) {}
+
 private:
 	/**
 	 * Pre-spawn pool of actors
@@ -119,12 +322,74 @@ private:
 	 */
 	bool PreSpawnPool(int32 NumToSpawn);
 
+	/**
+	 * Take actors parked by a previous level from the UObjectPoolCacheSubsystem into the available list
+	 * @return Number of actors adopted
+	 */
+	int32 AdoptParkedActors();
+
+	/**
+	 * Add this pool to the world's UObjectPoolSubsystem registry
+	 */
+	void RegisterWithSubsystem();
+
+	/**
+	 * Spawn pending prewarm actors within this frame's count/time budget
+	 */
+	void TickPrewarm();
+
+	/**
+	 * Broadcast ready/complete events once their thresholds are reached
+	 */
+	void UpdatePrewarmState();
+
+	/**
+	 * Advance the demand window and grow/trim the pool towards its target size
+	 * @param DeltaTime - Frame time in seconds
+	 */
+	void TickAdaptiveSizing(float DeltaTime);
+
+	/**
+	 * Record the current active count in the demand window
+	 */
+	void RecordDemand();
+
+	/**
+	 * Whether the component still has per-frame work (prewarm, adaptive sizing, debug drawing)
+	 * @return True if ticking is required
+	 */
+	bool NeedsTick() const;
+
 	/**
 	 * Spawn a single pooled actor
 	 * @return Spawned actor or nullptr if spawn failed
 	 */
 	AActor* SpawnPooledActor();
 
+	/**
+	 * Bring a slot's actor in line with its active flag, or queue that for the deferred pass
+	 * @param SlotIndex - Slot whose active flag just changed
+	 */
+	void UpdateSlotActorState(int32 SlotIndex);
+
+	/**
+	 * Activate or deactivate a slot's actor if its applied state differs from its active flag
+	 * @param SlotIndex - Slot to apply
+	 * @return True if the actor's state was changed
+	 */
+	bool ApplySlotActorState(int32 SlotIndex);
+
+	/**
+	 * Start/stop flushing deferred state changes after each world actor tick
+	 */
+	void BindDeferredFlush();
+	void UnbindDeferredFlush();
+
+	/**
+	 * End-of-frame hook that flushes deferred state changes for this pool's world
+	 */
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
 	/**
 	 * Deactivate an actor (hide and disable collision)
 	 * @param Actor - Actor to deactivate
@@ -144,6 +409,77 @@ private:
 	 */
 	bool ValidatePooledActor(AActor* Actor) const;
 
+	/**
+	 * Find the slot owned by an actor
+	 * @param Actor - Actor to look up
+	 * @return Slot index, or INDEX_NONE if the actor is not from this pool
+	 */
+	int32 FindSlotIndex(const AActor* Actor) const;
+
+	/**
+	 * Create a slot for a freshly spawned actor and place it in the available list
+	 * @param Actor - Newly spawned pooled actor
+	 * @return Index of the new slot
+	 */
+	int32 AddSlot(AActor* Actor);
+
+	/**
+	 * Move a slot between the active and available lists (O(1) swap-remove)
+	 * @param SlotIndex - Slot to move
+	 * @param bActive - True to move to the active list, false for the available list
+	 */
+	void SetSlotActive(int32 SlotIndex, bool bActive);
+
+	/**
+	 * Take an available slot (spawning a pending prewarm or expansion actor if needed) and mark it active
+	 * The actor is not activated or moved yet.
+	 * @param bLogExpansion - Log expansion/exhaustion warnings (batch calls log a summary instead)
+	 * @return Slot index or INDEX_NONE if the pool is exhausted
+	 */
+	int32 AcquireSlot(bool bLogExpansion);
+
+	/**
+	 * Update release stats for a slot that just went back to the available list
+	 * @param SlotIndex - Released slot
+	 */
+	void RecordRelease(int32 SlotIndex);
+
+	/**
+	 * Deactivate an active slot's actor and move it back to the available list
+	 * Invalidates all outstanding handles to the slot.
+	 * @param SlotIndex - Active slot to release
+	 */
+	void ReleaseSlot(int32 SlotIndex);
+
+	/**
+	 * Destroy an available slot's actor and put the slot on the free list
+	 * @param SlotIndex - Available slot to remove
+	 */
+	void RemoveSlot(int32 SlotIndex);
+
+	/**
+	 * Remove every slot and empty the active/available lists (does not destroy actors)
+	 */
+	void ResetSlots();
+
+	/**
+	 * Release every active slot back to the pool
+	 */
+	void ReturnAllActive();
+
+	/**
+	 * Check that a pool-wide operation can't take out another consumer's actors
+	 * @param Operation - Name of the call, for the warning
+	 * @return False (after logging) if the pool is shared
+	 */
+	bool CanRunPoolWideOperation(const TCHAR* Operation) const;
+
+	/**
+	 * Get the clock used for time-to-return and leak tracking
+	 * @return World time in seconds
+	 */
+	double GetStatsTime() const;
+
 	/**
 	 * Draw debug visualization for the pool
 	 */
@@ -166,14 +502,67 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool", meta = (AllowPrivateAccess = "true"))
 	TArray<AActor*> ActiveObjects;
 
-	// All pooled objects (for validation)
+	// One slot per pooled actor (index is stable for the actor's lifetime)
 	UPROPERTY()
-	TSet<AActor*> AllPooledObjects;
+	TArray<FPooledActorSlot> Slots;
+
+	// Slot index of each entry in AvailableObjects (parallel array)
+	TArray<int32> AvailableSlotIndices;
+
+	// Slot index of each entry in ActiveObjects (parallel array)
+	TArray<int32> ActiveSlotIndices;
+
+	// Actor -> slot lookup (used by ReturnToPool, which only receives the actor)
+	TMap<const AActor*, int32> SlotIndexByActor;
+
+	// Identifies this pool (and its current slot layout) in issued handles
+	int32 PoolSerial;
+
+	// Last serial handed to a pool
+	static int32 LastPoolSerial;
+
+	// Systems drawing from this pool through UObjectPoolSubsystem
+	int32 ConsumerCount;
+
+	// Slots whose actor was destroyed by adaptive trimming, reused before Slots grows
+	TArray<int32> FreeSlotIndices;
+
+	// Peak active count per demand window bucket (ring buffer)
+	TArray<int32> DemandBucketPeaks;
+
+	// Current bucket in DemandBucketPeaks
+	int32 DemandBucketCursor;
+
+	// Time spent in the current demand bucket
+	float DemandBucketElapsed;
+
+	// How long the pool has continuously been larger than its adaptive target
+	float OverTargetTime;
+
+	// Slots queued for the deferred end-of-frame state pass
+	TArray<int32> DirtySlotIndices;
+
+	// Binding to FWorldDelegates::OnWorldPostActorTick while deferred mode is on
+	FDelegateHandle PostActorTickHandle;
 
 	// Whether the pool has been initialized
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool", meta = (AllowPrivateAccess = "true"))
 	bool bIsInitialized;
 
+	// Initial actors still waiting to be spawned by time-sliced prewarm
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Prewarm", meta = (AllowPrivateAccess = "true"))
+	int32 PendingPrewarmCount;
+
+	// Usage counters (see GetPoolStats)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats", meta = (AllowPrivateAccess = "true"))
+	FObjectPoolStats PoolStats;
+
+	// Whether OnPoolReady has fired for the current initialization
+	bool bPoolReady;
+
+	// Whether OnPrewarmComplete has fired for the current initialization
+	bool bPrewarmCompleteBroadcast;
+
 	// Whether to show debug visualization
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Debug", meta = (AllowPrivateAccess = "true"))
 	bool bShowDebugVisualization;
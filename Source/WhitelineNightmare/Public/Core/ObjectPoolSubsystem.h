@@ -0,0 +1,108 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ObjectPoolTypes.h"
+#include "ObjectPoolSubsystem.generated.h"
+
+class UObjectPoolComponent;
+
+/**
+ * Object Pool Subsystem - World-level owner and registry of object pools
+ *
+ * Shared pools are keyed by actor class, so every system that spawns the same class
+ * draws from one warm pool with one memory budget. Shared pools live on a transient
+ * host actor owned by the subsystem.
+ *
+ * Every initialized UObjectPoolComponent (shared or owned by a system, e.g. the pickup
+ * pool) also registers here, so stats and debug tooling don't need to scan the world.
+ *
+ * Usage:
+ * 1. UObjectPoolSubsystem::Get(this)->GetOrCreatePool(ActorClass, Config)
+ * 2. Use GetFromPool()/ReturnToPool() on the returned pool as usual
+ * 3. ReleasePool() when the consumer goes away
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UObjectPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the pool subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UObjectPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Get the shared pool for an actor class, creating and initializing it on first use
+	 * The first caller's config sizes the pool; later callers share it as-is (a differing
+	 * config is logged as a warning). Every call counts one more consumer; call ReleasePool
+	 * when done. While a pool has several consumers its pool-wide calls are rejected.
+	 * @param ActorClass - Class of actors to pool
+	 * @param Config - Pool configuration used if the pool has to be created
+	 * @return Shared pool or nullptr if creation failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	UObjectPoolComponent* GetOrCreatePool(TSubclassOf<AActor> ActorClass, const FObjectPoolConfig& Config);
+
+	/**
+	 * Stop drawing from a shared pool (undoes one GetOrCreatePool)
+	 * @param Pool - Pool returned by GetOrCreatePool
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Object Pool")
+	void ReleasePool(UObjectPoolComponent* Pool);
+
+	/**
+	 * Find the shared pool for an actor class without creating it
+	 * @param ActorClass - Pooled actor class
+	 * @return Shared pool or nullptr if none exists
+	 */
+	UFUNCTION(BlueprintPure, Category = "Object Pool")
+	UObjectPoolComponent* FindPool(TSubclassOf<AActor> ActorClass) const;
+
+	/**
+	 * Add a pool to the registry (called by UObjectPoolComponent::Initialize)
+	 * @param Pool - Pool to register
+	 */
+	void RegisterPool(UObjectPoolComponent* Pool);
+
+	/**
+	 * Remove a pool from the registry (called when the pool ends play)
+	 * @param Pool - Pool to unregister
+	 */
+	void UnregisterPool(UObjectPoolComponent* Pool);
+
+	/**
+	 * Get every registered pool in this world (shared and system-owned)
+	 * @param OutPools - Receives the live pools
+	 */
+	void GetAllPools(TArray<UObjectPoolComponent*>& OutPools) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Get (spawning on first use) the transient actor that owns shared pool components
+	 * @return Host actor or nullptr if spawning failed
+	 */
+	AActor* GetOrCreatePoolHost();
+
+	// Shared pools keyed by pooled actor class
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, TObjectPtr<UObjectPoolComponent>> PoolsByClass;
+
+	// All initialized pools in this world, for stats and debugging
+	TArray<TWeakObjectPtr<UObjectPoolComponent>> RegisteredPools;
+
+	// Actor owning the shared pool components
+	UPROPERTY()
+	TObjectPtr<AActor> PoolHost;
+};
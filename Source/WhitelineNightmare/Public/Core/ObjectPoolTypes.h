@@ -26,6 +26,63 @@ struct FObjectPoolConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool")
 	int32 MaxPoolSize;
 
+	// Spawn the initial pool over several frames instead of all at once in Initialize()
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Prewarm")
+	bool bTimeSlicedPrewarm;
+
+	// Maximum actors to spawn per frame while prewarming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Prewarm", meta = (ClampMin = "1", EditCondition = "bTimeSlicedPrewarm"))
+	int32 PrewarmActorsPerFrame;
+
+	// Time budget per frame for prewarm spawning in milliseconds (0 = only limited by PrewarmActorsPerFrame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Prewarm", meta = (ClampMin = "0.0", EditCondition = "bTimeSlicedPrewarm"))
+	float PrewarmBudgetMs;
+
+	// Number of spawned actors at which the pool reports itself ready (0 = whole PoolSize)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Prewarm", meta = (ClampMin = "0", EditCondition = "bTimeSlicedPrewarm"))
+	int32 MinReadyCount;
+
+	// Grow/shrink the pool in the background from a moving window of observed demand
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive")
+	bool bAdaptiveSizing;
+
+	// Length of the demand window in seconds (peak active count over this window drives the target size)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "0.1", EditCondition = "bAdaptiveSizing"))
+	float DemandWindowSeconds;
+
+	// Extra capacity kept above the window peak (0.25 = 25% headroom)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "0.0", EditCondition = "bAdaptiveSizing"))
+	float GrowHeadroom;
+
+	// Pool never trims below this many actors (0 = PoolSize)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "0", EditCondition = "bAdaptiveSizing"))
+	int32 MinPoolSize;
+
+	// Seconds the pool must stay above its target before idle actors are destroyed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "0.0", EditCondition = "bAdaptiveSizing"))
+	float ShrinkDelaySeconds;
+
+	// Maximum actors spawned per frame when growing ahead of demand
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "1", EditCondition = "bAdaptiveSizing"))
+	int32 MaxAdaptiveSpawnsPerFrame;
+
+	// Maximum idle actors destroyed per frame when trimming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Adaptive", meta = (ClampMin = "1", EditCondition = "bAdaptiveSizing"))
+	int32 MaxAdaptiveDestroysPerFrame;
+
+	// Queue hide/collision/tick changes and apply them once at the end of the frame in one batched pass.
+	// An actor taken and returned within the same frame never touches render or physics state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Activation")
+	bool bDeferActorStateChanges;
+
+	// Carry this pool's actors into the next level on seamless travel instead of respawning them (see UObjectPoolCacheSubsystem)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Cache")
+	bool bPersistAcrossLevels;
+
+	// Actors active for longer than this many seconds are reported as likely leaks (0 = disabled)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Stats", meta = (ClampMin = "0.0"))
+	float LeakDetectionTTL;
+
 	// How far ahead of the war rig to spawn objects
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Pool|Spawning")
 	float SpawnDistanceAhead;
@@ -38,12 +95,212 @@ struct FObjectPoolConfig
 		: PoolSize(10)
 		, bAutoExpand(false)
 		, MaxPoolSize(0)
+		, bTimeSlicedPrewarm(false)
+		, PrewarmActorsPerFrame(4)
+		, PrewarmBudgetMs(1.0f)
+		, MinReadyCount(0)
+		, bAdaptiveSizing(false)
+		, DemandWindowSeconds(5.0f)
+		, GrowHeadroom(0.25f)
+		, MinPoolSize(0)
+		, ShrinkDelaySeconds(10.0f)
+		, MaxAdaptiveSpawnsPerFrame(1)
+		, MaxAdaptiveDestroysPerFrame(1)
+		, bDeferActorStateChanges(false)
+		, bPersistAcrossLevels(false)
+		, LeakDetectionTTL(60.0f)
 		, SpawnDistanceAhead(2000.0f)
 		, DespawnDistanceBehind(1000.0f)
 	{
 	}
 };
 
+/**
+ * Object Pool Stats - Usage counters for sizing PoolSize/MaxPoolSize from real data
+ *
+ * Counters accumulate from Initialize() (or the last ResetPoolStats()) onwards.
+ */
+USTRUCT(BlueprintType)
+struct FObjectPoolStats
+{
+	GENERATED_BODY()
+
+	// Highest number of actors that were active at the same time
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 PeakActiveCount;
+
+	// Number of successful GetFromPool calls
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 TotalAcquires;
+
+	// Number of successful ReturnToPool calls
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 TotalReleases;
+
+	// Number of times the pool grew beyond its initial size
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 ExpansionCount;
+
+	// Actors spawned in the background by adaptive sizing
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 AdaptiveGrowCount;
+
+	// Idle actors destroyed by adaptive sizing
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 AdaptiveShrinkCount;
+
+	// Number of GetFromPool calls that returned nullptr because the pool was exhausted
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 ExhaustionMisses;
+
+	// Average seconds an actor stayed active before being returned
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	float AverageTimeToReturn;
+
+	// Longest seconds an actor stayed active before being returned
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	float MaxTimeToReturn;
+
+	// Actors currently active for longer than LeakDetectionTTL
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 LeakedActorCount;
+
+	// Deferred state changes applied at end of frame
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 DeferredStateChangesApplied;
+
+	// Deferred state changes skipped because the actor ended the frame in the state it started in
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Object Pool|Stats")
+	int32 DeferredStateChangesCoalesced;
+
+	// Sum of all active durations (used to compute the average)
+	double TotalTimeToReturn;
+
+	FObjectPoolStats()
+		: PeakActiveCount(0)
+		, TotalAcquires(0)
+		, TotalReleases(0)
+		, ExpansionCount(0)
+		, AdaptiveGrowCount(0)
+		, AdaptiveShrinkCount(0)
+		, ExhaustionMisses(0)
+		, AverageTimeToReturn(0.0f)
+		, MaxTimeToReturn(0.0f)
+		, LeakedActorCount(0)
+		, DeferredStateChangesApplied(0)
+		, DeferredStateChangesCoalesced(0)
+		, TotalTimeToReturn(0.0)
+	{
+	}
+
+	/** Fraction of acquire requests that failed because the pool was exhausted */
+	float GetMissRate() const
+	{
+		const int32 TotalRequests = TotalAcquires + ExhaustionMisses;
+		return TotalRequests > 0 ? static_cast<float>(ExhaustionMisses) / TotalRequests : 0.0f;
+	}
+};
+
+/**
+ * Pooled Actor Handle - Generation-checked reference to an actor taken from a pool
+ *
+ * Returned by UObjectPoolComponent::GetFromPoolWithHandle(). The handle stops resolving
+ * as soon as the actor goes back to the pool, so a stale holder can neither release nor
+ * use an actor that has since been handed out again. The handle also records which pool
+ * issued it, so passing it to another pool is rejected instead of releasing that pool's
+ * actor in the same slot. Validation is O(1).
+ */
+USTRUCT(BlueprintType)
+struct FPooledActorHandle
+{
+	GENERATED_BODY()
+
+	// Serial of the issuing pool (0 = no pool)
+	UPROPERTY()
+	int32 PoolSerial;
+
+	// Slot index inside the owning pool
+	UPROPERTY()
+	int32 SlotIndex;
+
+	// Slot generation at the time the handle was issued
+	UPROPERTY()
+	int32 Generation;
+
+	FPooledActorHandle()
+		: PoolSerial(0)
+		, SlotIndex(INDEX_NONE)
+		, Generation(0)
+	{
+	}
+
+	FPooledActorHandle(int32 InPoolSerial, int32 InSlotIndex, int32 InGeneration)
+		: PoolSerial(InPoolSerial)
+		, SlotIndex(InSlotIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	/** True if the handle was issued by a pool (it may still be stale) */
+	bool IsSet() const { return SlotIndex != INDEX_NONE; }
+
+	/** Clear the handle */
+	void Reset() { PoolSerial = 0; SlotIndex = INDEX_NONE; Generation = 0; }
+
+	bool operator==(const FPooledActorHandle& Other) const
+	{
+		return PoolSerial == Other.PoolSerial && SlotIndex == Other.SlotIndex && Generation == Other.Generation;
+	}
+	bool operator!=(const FPooledActorHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Pooled Actor Slot - Bookkeeping for a single actor owned by an object pool
+ *
+ * Every pooled actor keeps a slot for its whole lifetime. The slot remembers
+ * whether the actor is handed out and where it sits in the pool's active or
+ * available list, so acquire/release never has to search those lists.
+ * Slots freed by adaptive trimming have a null Actor and are reused by later spawns.
+ */
+USTRUCT()
+struct FPooledActorSlot
+{
+	GENERATED_BODY()
+
+	// Actor occupying this slot
+	UPROPERTY()
+	TObjectPtr<AActor> Actor;
+
+	// Index of the actor in the active list (if bIsActive) or the available list (if not)
+	int32 ListIndex;
+
+	// Whether the actor is currently in use (true) or free in the pool (false)
+	bool bIsActive;
+
+	// World time at which the actor was last taken from the pool
+	double ActivationTime;
+
+	// Incremented every time the actor is returned, invalidating outstanding handles
+	int32 Generation;
+
+	// Whether the actor's hidden/collision/tick state currently reflects being in use
+	bool bAppliedActive;
+
+	// Whether the slot is queued for the deferred end-of-frame state pass
+	bool bStateDirty;
+
+	FPooledActorSlot()
+		: Actor(nullptr)
+		, ListIndex(INDEX_NONE)
+		, bIsActive(false)
+		, ActivationTime(0.0)
+		, Generation(0)
+		, bAppliedActive(false)
+		, bStateDirty(false)
+	{
+	}
+};
+
 /**
  * Poolable Actor Interface - UInterface class
  * Actors that can be pooled should implement IPoolableActor
@@ -0,0 +1,209 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Core/LaneDistanceIndex.h"
+#include "ScrollMoverSubsystem.generated.h"
+
+class UWorldScrollComponent;
+class UScrollMoverSubsystem;
+
+/**
+ * Tick function that moves every registered scroll mover, ordered after the scroll source
+ */
+USTRUCT()
+struct FScrollMoverTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem to tick
+	UScrollMoverSubsystem* Target = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScrollMoverTickFunction> : public TStructOpsTypeTraitsBase2<FScrollMoverTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Scroll Mover Subsystem - Moves all scrolling actors in one pass per frame
+ *
+ * Ground tiles, pickups and future scrolling types register here while active instead
+ * of ticking themselves. A single tick function, prerequisite on the scroll source's
+ * component tick, applies the frame's scroll offset to the contiguous mover list.
+ *
+ * The first UWorldScrollComponent to begin play becomes the scroll source.
+ *
+ * The subsystem also keeps a lane x road-distance index (FLaneDistanceIndex) of scrolling
+ * entities. Road distance is world X minus the scroll offset the subsystem has applied, so it
+ * stays constant for anything moving with the world and entities only register once. Turret
+ * targeting and projectile hit tests read their candidates from this index (QueryAllLanes)
+ * and only fall back to a physics overlap when it holds no pawn in range, so enemies should
+ * register with RegisterLaneEntity when they spawn.
+ *
+ * Usage:
+ * 1. UScrollMoverSubsystem::Get(this)->RegisterMover(this) in OnActivated
+ * 2. UnregisterMover(this) in OnDeactivated
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UScrollMoverSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the scroll mover subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UScrollMoverSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Set the component whose velocity drives all movers (tick is ordered after it)
+	 * @param ScrollComponent - Scroll source
+	 */
+	void SetScrollSource(UWorldScrollComponent* ScrollComponent);
+
+	/**
+	 * Clear the scroll source if it is the given component
+	 * @param ScrollComponent - Scroll source that is ending play
+	 */
+	void ClearScrollSource(UWorldScrollComponent* ScrollComponent);
+
+	/**
+	 * Get the current scroll source
+	 * @return Scroll source or nullptr if none has begun play
+	 */
+	UWorldScrollComponent* GetScrollSource() const { return ScrollSource.Get(); }
+
+	/**
+	 * Start moving an actor with the world scroll (no-op if already registered)
+	 * @param Actor - Actor to move
+	 */
+	void RegisterMover(AActor* Actor);
+
+	/**
+	 * Stop moving an actor (O(1) swap-remove, no-op if not registered)
+	 * @param Actor - Actor to stop moving
+	 */
+	void UnregisterMover(AActor* Actor);
+
+	/**
+	 * Check whether an actor is currently moved by the subsystem
+	 * @param Actor - Actor to check
+	 * @return True if registered
+	 */
+	bool IsMoverRegistered(const AActor* Actor) const { return MoverIndexByActor.Contains(TObjectKey<AActor>(Actor)); }
+
+	/**
+	 * Get the number of registered movers
+	 * @return Mover count
+	 */
+	int32 GetMoverCount() const { return Movers.Num(); }
+
+	/**
+	 * Convert a world X to road distance (constant for actors scrolling with the world)
+	 * @param WorldX - World X coordinate
+	 * @return Road distance
+	 */
+	float GetRoadDistanceAtWorldX(float WorldX) const { return static_cast<float>(WorldX - ScrollOffsetX); }
+
+	/**
+	 * Convert a road distance to the world X it is currently scrolled to
+	 * @param RoadDistance - Road distance
+	 * @return World X coordinate
+	 */
+	float GetWorldXAtRoadDistance(float RoadDistance) const { return static_cast<float>(RoadDistance + ScrollOffsetX); }
+
+	/**
+	 * Index an entity by lane at its current road distance (re-registering moves it)
+	 * @param Actor - Entity to index
+	 * @param Lane - Lane index (see ULaneSystemComponent)
+	 */
+	void RegisterLaneEntity(AActor* Actor, int32 Lane);
+
+	/**
+	 * Remove an entity from the lane index (also done by UnregisterMover)
+	 * @param Actor - Entity to remove
+	 */
+	void UnregisterLaneEntity(const AActor* Actor) { LaneIndex.Remove(Actor); }
+
+	/**
+	 * Collect entities in lanes LaneMin..LaneMax whose current world X is in [WorldXMin, WorldXMax]
+	 * @param LaneMin - First lane (inclusive)
+	 * @param LaneMax - Last lane (inclusive)
+	 * @param WorldXMin - Start of the range in world X (inclusive)
+	 * @param WorldXMax - End of the range in world X (inclusive)
+	 * @param OutActors - Receives matching entities (appended)
+	 * @return Number of entities appended
+	 */
+	int32 QueryLaneRange(int32 LaneMin, int32 LaneMax, float WorldXMin, float WorldXMax, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Collect entities in every lane whose current world X is in [WorldXMin, WorldXMax]
+	 * @param WorldXMin - Start of the range in world X (inclusive)
+	 * @param WorldXMax - End of the range in world X (inclusive)
+	 * @param OutActors - Receives matching entities (appended)
+	 * @return Number of entities appended (0 without a query if nothing is indexed)
+	 */
+	int32 QueryAllLanes(float WorldXMin, float WorldXMax, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * Get the lane index for queries in road distance
+	 * @return Lane x road-distance index
+	 */
+	const FLaneDistanceIndex& GetLaneIndex() const { return LaneIndex; }
+
+	/**
+	 * Apply one frame of scroll movement to every registered mover
+	 * @param DeltaTime - Frame time in seconds
+	 */
+	void TickMovers(float DeltaTime);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Swap-remove a mover by list index and patch the moved entry's index
+	 * @param MoverIndex - Index in Movers
+	 */
+	void RemoveMoverAt(int32 MoverIndex);
+
+	// Actors moved each frame (contiguous, order not preserved)
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Movers;
+
+	// Key of each entry in Movers (parallel array; GC nulls a destroyed mover's pointer but not its key)
+	TArray<TObjectKey<AActor>> MoverKeys;
+
+	// Actor -> index in Movers (keyed per object, so a new actor reusing a dead one's address registers normally)
+	TMap<TObjectKey<AActor>, int32> MoverIndexByActor;
+
+	// Component providing the scroll velocity
+	TWeakObjectPtr<UWorldScrollComponent> ScrollSource;
+
+	// Tick function running TickMovers after the scroll source has ticked
+	FScrollMoverTickFunction MoverTickFunction;
+
+	// Total X offset applied to movers since the world began
+	double ScrollOffsetX = 0.0;
+
+	// Scrolling entities by lane and road distance
+	FLaneDistanceIndex LaneIndex;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Pawn.h"
 #include "GameDataStructs.h"
+#include "ObjectPoolTypes.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayAbilitySpec.h"
 #include "WarRigPawn.generated.h"
@@ -12,6 +13,7 @@
 // Forward declarations
 class UAbilitySystemComponent;
 class UWarRigAttributeSet;
+class UCombatAttributeSet;
 class UDataTable;
 class UStaticMeshComponent;
 class USpringArmComponent;
@@ -19,6 +21,9 @@ class UCameraComponent;
 class ULaneSystemComponent;
 class USceneComponent;
 class ATurretBase;
+class UObjectPoolComponent;
+class UStaticMesh;
+struct FStreamableHandle;
 
 /**
  * AWarRigPawn - The player's war rig vehicle
@@ -33,6 +38,15 @@ class ATurretBase;
  *
  * Configuration is loaded from a data table (DT_WarRigData) which supports multiple rig types.
  * MVP uses only the "SemiTruck" configuration.
+ *
+ * Rig assembly is progressive: section meshes that aren't resident are streamed asynchronously
+ * and each section component is registered as its mesh arrives. SwapWarRig switches to another
+ * configuration at runtime, reusing the existing section components. Mounted turrets move to the
+ * new rig's mount with the same index; turrets whose mount no longer exists are removed (pooled).
+ *
+ * With bLightweightTurretAbilitySystems, mounted turrets keep their own ability system component
+ * (so attributes, effects, tags and abilities resolve per turret as GAS expects) but it neither
+ * replicates nor ticks.
  */
 UCLASS()
 class WHITELINENIGHTMARE_API AWarRigPawn : public APawn, public IAbilitySystemInterface
@@ -44,6 +58,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -55,6 +70,85 @@ public:
 	// Data table loading
 	void LoadWarRigConfiguration(const FName& RigID);
 
+	/**
+	 * Switch to another rig configuration at runtime without rebuilding the pawn
+	 * @param NewRigID - Row name in the war rig data table
+	 */
+	UFUNCTION(BlueprintCallable, Category = "War Rig|Configuration")
+	void SwapWarRig(FName NewRigID);
+
+	/**
+	 * Check whether every section mesh of the current rig has arrived
+	 * @return True when no section is still streaming
+	 */
+	UFUNCTION(BlueprintPure, Category = "War Rig|Configuration")
+	bool IsRigAssemblyComplete() const { return PendingMeshSections.Num() == 0; }
+
+	/** Get the war rig data table (rig configuration rows) */
+	UDataTable* GetWarRigDataTable() const { return WarRigDataTable; }
+
+	/** Set the war rig data table (takes effect on the next LoadWarRigConfiguration/SwapWarRig) */
+	void SetWarRigDataTable(UDataTable* InWarRigDataTable) { WarRigDataTable = InWarRigDataTable; }
+
+	/**
+	 * Get the scene component of a mount point
+	 * @param MountIndex - Mount point index
+	 * @return Mount component, or nullptr if the index is invalid
+	 */
+	USceneComponent* GetMountPointComponent(int32 MountIndex) const
+	{
+		return MountPointComponents.IsValidIndex(MountIndex) ? MountPointComponents[MountIndex].Get() : nullptr;
+	}
+
+	/** Get the turret data table (turret rows) */
+	UDataTable* GetTurretDataTable() const { return TurretDataTable; }
+
+	// === TURRET ABILITY SYSTEM ===
+
+	/**
+	 * Get the combat attributes of the turret on a mount
+	 * @param MountIndex - Mount index
+	 * @return Attribute set, or nullptr if the mount is empty
+	 */
+	UFUNCTION(BlueprintPure, Category = "War Rig|Turrets")
+	UCombatAttributeSet* GetTurretAttributeSet(int32 MountIndex) const;
+
+	/** Check whether turrets mounted on this rig run their ability systems without replication and tick */
+	bool UsesLightweightTurretAbilitySystems() const { return bLightweightTurretAbilitySystems; }
+
+	/**
+	 * Choose whether turrets initialized on this rig from now on run lightweight ability systems
+	 * @param bLightweight - True to turn replication and tick off on mounted turrets' ASCs
+	 */
+	void SetLightweightTurretAbilitySystems(bool bLightweight) { bLightweightTurretAbilitySystems = bLightweight; }
+
+	// === TURRET PLACEMENT ===
+
+	/**
+	 * Place a turret on a mount, taking it from the pool for its TurretClass (created on first use)
+	 * @param TurretData - Turret stats; TurretClass selects the pool
+	 * @param MountIndex - Mount point to place the turret on
+	 * @return Mounted turret, or nullptr if the mount is invalid or taken
+	 */
+	UFUNCTION(BlueprintCallable, Category = "War Rig|Turrets")
+	ATurretBase* PlaceTurret(const FTurretData& TurretData, int32 MountIndex);
+
+	/**
+	 * Remove (sell) the turret on a mount and return it to its pool, which resets its state
+	 * @param MountIndex - Mount point to clear
+	 * @return True if a turret was removed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "War Rig|Turrets")
+	bool RemoveTurret(int32 MountIndex);
+
+	/**
+	 * Get the turret on a mount
+	 * @param MountIndex - Mount point index
+	 * @return Turret, or nullptr if the mount is empty
+	 */
+	UFUNCTION(BlueprintPure, Category = "War Rig|Turrets")
+	ATurretBase* GetTurretAtMount(int32 MountIndex) const;
+
 	// Testing functions
 	UFUNCTION(Exec, Category = "Testing|Movement")
 	void TestWarRigDataLoading();
@@ -128,6 +222,9 @@ public:
 	UFUNCTION(Exec, Category = "Debug|War Rig")
 	void DebugReloadWarRigData();
 
+	UFUNCTION(Exec, Category = "Debug|War Rig")
+	void DebugSwapWarRig(FName RigID);
+
 	/** Toggle lane debug visualization (wrapper for LaneSystemComponent) */
 	UFUNCTION(Exec, Category = "Debug|Lane System")
 	void DebugShowLanes();
@@ -162,8 +259,18 @@ protected:
 	// Validation
 	bool ValidateWarRigData(const FWarRigData& RigData) const;
 
+	// Progressive assembly
+	void AssembleMeshSection(int32 SectionIndex, UStaticMesh* Mesh);
+	void HandleSectionMeshesStreamed();
+	void FinishRigAssembly();
+
+	/**
+	 * Move mounted turrets onto the rebuilt mount points (turrets are detached before the old mounts go)
+	 */
+	void RehomeTurrets();
+
 	// Clean up existing components
-	void ClearMeshComponents();
+	void TrimMeshComponents(int32 NumSectionsToKeep);
 	void ClearMountPoints();
 
 protected:
@@ -197,6 +304,15 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "War Rig|Mesh")
 	TArray<TObjectPtr<UStaticMeshComponent>> MeshComponents;
 
+	/** Section indices whose meshes are still streaming */
+	TArray<int32> PendingMeshSections;
+
+	/** Streaming request for the current rig's section meshes */
+	TSharedPtr<FStreamableHandle> SectionMeshHandle;
+
+	/** True once FinishRigAssembly has run for the current configuration */
+	bool bRigAssemblyFinished = false;
+
 	/** Dynamically spawned mount point scene components */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "War Rig|Mount Points")
 	TArray<TObjectPtr<USceneComponent>> MountPointComponents;
@@ -215,6 +331,21 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Rig|Turrets")
 	TObjectPtr<UDataTable> TurretDataTable;
 
+	/**
+	 * Mounted turrets' ASCs don't replicate or tick. Turret state then stays on the server (or the
+	 * local game), and abilities granted to turrets must not rely on ticking ability tasks.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Rig|Turrets")
+	bool bLightweightTurretAbilitySystems;
+
+	/** Pool settings used when a turret class gets its pool (buy/sell churn reuses pooled turrets) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "War Rig|Turrets")
+	FObjectPoolConfig TurretPoolConfig;
+
+	/** Shared turret pools this rig draws from, by turret class (released in EndPlay) */
+	UPROPERTY()
+	TMap<TSubclassOf<AActor>, TObjectPtr<UObjectPoolComponent>> TurretPools;
+
 	/** Currently spawned turrets on this war rig */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "War Rig|Turrets")
 	TArray<TObjectPtr<ATurretBase>> SpawnedTurrets;
@@ -27,6 +27,9 @@ public:
 	// Called to bind functionality to input
 	virtual void SetupInputComponent() override;
 
+	// Called in the new level after a seamless travel (the controller survives it, BeginPlay doesn't run again)
+	virtual void PostSeamlessTravel() override;
+
 	/**
 	 * Add scrap to the player's inventory
 	 * @param Amount - Amount of scrap to add (can be negative to subtract)
@@ -78,6 +81,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Whiteline Nightmare|Game State")
 	bool IsGameOver() const { return bIsGameOver; }
 
+	/**
+	 * Start a fresh run: starting scrap, game over cleared, pending auto-restart cancelled
+	 * (called from BeginPlay and after the seamless travel of a restart)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Whiteline Nightmare|Game State")
+	void ResetRunState();
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -94,6 +104,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Whiteline Nightmare|Game State")
 	bool bIsGameOver;
 
+	// Auto-restart started by OnGameOver
+	FTimerHandle RestartTimerHandle;
+
 private:
 	/**
 	 * Validate scrap amount changes
@@ -27,6 +27,9 @@ public:
 	// Initialize the game mode
 	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 
+	// Keep parked pooled actors through seamless travel (see UObjectPoolCacheSubsystem)
+	virtual void GetSeamlessTravelActorList(bool bToTransition, TArray<AActor*>& ActorList) override;
+
 	/**
 	 * Track distance traveled by the war rig
 	 * @param DeltaDistance - Distance to add (should be positive)
@@ -158,6 +161,17 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Whiteline Nightmare|Components")
 	class UGroundTileManager* GroundTileManager;
 
+	// Extra data tables whose soft asset references are streamed in when the level starts (defaults to the project's rig and tile tables)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Whiteline Nightmare|Preload")
+	TArray<TObjectPtr<class UDataTable>> PreloadDataTables;
+
+	/**
+	 * Collect every data table preloaded by InitGame: PreloadDataTables plus the tables the
+	 * ground tile manager and the default pawn read when they begin play
+	 * @param OutDataTables - Receives the tables (appended, no duplicates)
+	 */
+	void GatherPreloadDataTables(TArray<class UDataTable*>& OutDataTables) const;
+
 protected:
 	// Current distance traveled
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Whiteline Nightmare|Game Progress")
@@ -25,7 +25,8 @@ struct FWorldScrollData;
  * Usage:
  * 1. Add component to GameMode or level manager actor
  * 2. Configure DataTableRowName to point to data table row
- * 3. Other systems query GetScrollVelocity() to move backward
+ * 3. Scrolling actors register with UScrollMoverSubsystem (moved right after this component
+ *    ticks); other systems query GetScrollVelocity() to move backward
  * 4. GameMode queries GetDistanceTraveled() for win condition
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -39,6 +40,9 @@ public:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the component is removed from play
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -59,11 +63,11 @@ public:
 
 	/**
 	 * Get total virtual distance traveled
-	 * Used by GameMode for win condition
-	 * @return Accumulated distance in units
+	 * Used by GameMode for win condition and by the road for drift-free tile placement
+	 * @return Accumulated distance in units (double: a float can't hold small per-frame steps on long runs)
 	 */
 	UFUNCTION(BlueprintPure, Category = "World Scroll")
-	float GetDistanceTraveled() const { return DistanceTraveled; }
+	double GetDistanceTraveled() const { return DistanceTraveled; }
 
 	/**
 	 * Set scroll speed at runtime
@@ -124,9 +128,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Scroll|State")
 	bool bIsScrolling;
 
-	// Total virtual distance traveled (accumulated)
+	// Total virtual distance traveled (accumulated in double precision)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Scroll|State")
-	float DistanceTraveled;
+	double DistanceTraveled;
 
 	// Normalized scroll direction vector
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "World Scroll|State")
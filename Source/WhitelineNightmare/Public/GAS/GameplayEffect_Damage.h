@@ -0,0 +1,34 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "GameplayEffect_Damage.generated.h"
+
+/**
+ * UGameplayEffect_Damage - Instant effect that subtracts a caller-supplied amount of Health
+ *
+ * Defined natively so systems without a Blueprint to configure (e.g. the projectile subsystem)
+ * can route damage through GAS. The amount is read from the "Data.Damage" SetByCaller
+ * magnitude and is added to Health, so callers pass the damage negated.
+ *
+ * Usage:
+ *   FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(UGameplayEffect_Damage::StaticClass(), 1.0f, Context);
+ *   Spec.Data->SetSetByCallerMagnitude(UGameplayEffect_Damage::GetDamageDataTag(), -Damage);
+ *   ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UGameplayEffect_Damage : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UGameplayEffect_Damage();
+
+	/**
+	 * Get the SetByCaller tag carrying the Health change
+	 * @return "Data.Damage" tag
+	 */
+	static FGameplayTag GetDamageDataTag();
+};
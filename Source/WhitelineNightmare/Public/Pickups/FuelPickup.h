@@ -15,14 +15,13 @@ class AWarRigPawn;
 class UGameplayEffect;
 class USoundBase;
 class UNiagaraSystem;
-class UNiagaraComponent;
 
 /**
  * AFuelPickup - Poolable actor that restores fuel to the war rig
  *
  * Implements IPoolableActor for object pooling
  * Visual: Bright green sphere (configurable via data table)
- * Scrolls backward with world scroll speed
+ * Scrolls backward with world scroll speed while active (moved by UScrollMoverSubsystem, no Tick)
  * Restores fuel on overlap with war rig
  */
 UCLASS()
@@ -37,8 +36,6 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
-	virtual void Tick(float DeltaTime) override;
-
 	// IPoolableActor interface implementation
 	virtual void OnActivated_Implementation() override;
 	virtual void OnDeactivated_Implementation() override;
@@ -63,6 +60,24 @@ public:
 	 */
 	void SetPoolComponent(class UPickupPoolComponent* InPoolComponent);
 
+	/**
+	 * Set the pool handle issued when this pickup was taken from the pool
+	 * @param InPoolHandle - Handle used to return this pickup exactly once
+	 */
+	void SetPoolHandle(const FPooledActorHandle& InPoolHandle);
+
+	/**
+	 * Get the pickup data loaded from the data table
+	 * @return Pickup configuration (effects, rewards, visuals)
+	 */
+	const FPickupData& GetPickupData() const { return PickupData; }
+
+	/**
+	 * Get the data table this pickup loads its configuration from
+	 * @return Pickup data table (may be null)
+	 */
+	UDataTable* GetPickupDataTable() const { return PickupDataTable; }
+
 protected:
 	/** Sphere component for collision and visual representation */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -76,6 +91,9 @@ protected:
 	UPROPERTY()
 	TObjectPtr<class UPickupPoolComponent> PoolComponent;
 
+	/** Handle for the current activation (stale once the pickup has been returned) */
+	FPooledActorHandle PoolHandle;
+
 	/** Pickup data loaded from data table */
 	UPROPERTY(BlueprintReadOnly, Category = "Pickup")
 	FPickupData PickupData;
@@ -92,10 +110,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Pickup")
 	FName PickupDataRowName;
 
-	/** Current Niagara component for particle effect (if any) */
-	UPROPERTY()
-	TObjectPtr<UNiagaraComponent> ActiveParticleComponent;
-
 	/** Handle sphere overlap events */
 	UFUNCTION()
 	void OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -104,7 +118,7 @@ protected:
 	/** Apply fuel restoration to the war rig */
 	void ApplyFuelRestore(AWarRigPawn* WarRig);
 
-	/** Play pickup effects (sound and particle) */
+	/** Play pickup effects (sound and particle), on the pool's pooled components when pooled */
 	void PlayPickupEffects();
 
 	/** Update visual appearance based on pickup data */
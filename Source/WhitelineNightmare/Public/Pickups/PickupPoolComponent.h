@@ -10,6 +10,9 @@
 class AFuelPickup;
 class AWarRigPawn;
 class UWorldScrollComponent;
+class UNiagaraComponent;
+class UAudioComponent;
+struct FPickupData;
 
 /**
  * UPickupPoolComponent - Specialized object pool for fuel and scrap pickups
@@ -18,6 +21,7 @@ class UWorldScrollComponent;
  * - Automatic despawning when pickups pass behind war rig
  * - Lane-based spawning
  * - Integration with world scroll system
+ * - Pooled collection effects (Niagara + audio) with asynchronously preloaded assets and a concurrency cap
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class WHITELINENIGHTMARE_API UPickupPoolComponent : public UObjectPoolComponent
@@ -72,7 +76,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Pickup Pool")
 	int32 GetAvailablePickupCount() const { return GetAvailableCount(); }
 
+	/**
+	 * Play a pickup's collection sound and particle effect on pooled components
+	 * Effects beyond MaxConcurrentPickupEffects are dropped rather than allocating.
+	 * @param PickupData - Pickup whose effect assets to play
+	 * @param EffectTransform - World transform for the effects
+	 */
+	void PlayPickupEffects(const FPickupData& PickupData, const FTransform& EffectTransform);
+
+	/**
+	 * Start streaming the sound/particle of every row in a pickup class's data table, so
+	 * collection finds them resident instead of loading synchronously (one async request)
+	 * @param PickupClass - Pickup class whose default data table to preload
+	 * @return Number of assets requested
+	 */
+	int32 PreloadPickupEffects(TSubclassOf<AFuelPickup> PickupClass);
+
 protected:
+	// UObjectPoolComponent interface
+	virtual void OnPooledActorSpawned(AActor* Actor) override;
+
 	/** Reference to the war rig pawn */
 	UPROPERTY()
 	TObjectPtr<AWarRigPawn> WarRigPawn;
@@ -97,6 +120,38 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup Pool|Spawning")
 	float SpawnHeight;
 
+	/** Maximum pickup effects (of each kind) playing at once; also the number of pooled components */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup Pool|Effects", meta = (ClampMin = "1"))
+	int32 MaxConcurrentPickupEffects;
+
+	/** Effect assets resolved for collection, keyed by soft path (keeps them resident) */
+	UPROPERTY()
+	TMap<FSoftObjectPath, TObjectPtr<UObject>> PreloadedEffectAssets;
+
+	/** Reusable particle components for collection effects */
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> PooledParticleComponents;
+
+	/** Reusable audio components for collection sounds */
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> PooledAudioComponents;
+
+	/** Effects skipped because every pooled component was busy */
+	int32 DroppedPickupEffectCount;
+
+	/**
+	 * Create the pooled effect components on the owning actor (once)
+	 */
+	void CreatePooledEffectComponents();
+
+	/**
+	 * Get a preloaded effect asset, loading it synchronously (with a warning) if it isn't resident yet
+	 * @param SoftAsset - Asset reference from FPickupData
+	 * @return Loaded asset or nullptr
+	 */
+	template<typename T>
+	T* GetPreloadedEffectAsset(const TSoftObjectPtr<T>& SoftAsset);
+
 	/**
 	 * Check active pickups and despawn those that have passed behind the war rig
 	 */
@@ -0,0 +1,80 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "World/GroundTileManager.h"
+#include "TestGroundTileManager.generated.h"
+
+/**
+ * UTestGroundTileManager - Ground tile manager driven directly by unit tests
+ *
+ * Exposes road configuration, the per-frame road updates and the resulting tile/instance
+ * positions so tests can step the road without a game mode or a registered tick.
+ */
+UCLASS(NotBlueprintable)
+class WHITELINENIGHTMARE_API UTestGroundTileManager : public UGroundTileManager
+{
+	GENERATED_BODY()
+
+public:
+	UTestGroundTileManager();
+
+	/**
+	 * Configure the road before it is built
+	 * @param bInstanced - Use the instanced road
+	 * @param bAnalytic - Use analytic tile placement (tile actor road only)
+	 * @param InTileSize - Tile length
+	 * @param InSpawnDistance - Distance ahead of the war rig to fill
+	 * @param InDespawnDistance - Distance behind the war rig to keep
+	 */
+	void ConfigureRoad(bool bInstanced, bool bAnalytic, float InTileSize, float InSpawnDistance, float InDespawnDistance);
+
+	/** Set the actor the road is laid out around */
+	void SetTestWarRig(AActor* InWarRig) { WarRig = InWarRig; }
+
+	/** Build the instanced road around the war rig */
+	void BuildTestInstancedRoad() { BuildInstancedRoad(); }
+
+	/** Run one instanced road update */
+	void StepInstancedRoad() { UpdateInstancedRoad(); }
+
+	/**
+	 * Get the shared tile pool for the configured tile class
+	 * @return True if the pool is ready
+	 */
+	bool InitializeTestTilePool() { return InitializeTilePool(); }
+
+	/** Run one analytic placement update */
+	void StepAnalyticTiles() { UpdateAnalyticTiles(); }
+
+	/**
+	 * Get the world X of the Nth active tile counted from the rear
+	 * @param Offset - 0 for the rearmost tile
+	 * @return World X of the tile, or 0 if there is no such tile
+	 */
+	float GetTileWorldX(int32 Offset) const;
+
+	/** Return every active tile to the pool */
+	void ReleaseTestTiles();
+
+	/** Get the instanced road component */
+	UInstancedStaticMeshComponent* GetRoadInstances() const { return RoadInstances; }
+
+	/** Get the ring index of the rearmost instance */
+	int32 GetRoadRingHead() const { return RoadRingHead; }
+
+	/**
+	 * Get the world X of the Nth instance counted from the rear of the ring
+	 * @param Offset - 0 for the rearmost instance
+	 * @return World X of the instance's tile origin
+	 */
+	float GetRoadInstanceWorldX(int32 Offset) const;
+
+	/**
+	 * Get the world X the instanced mesh component actually renders the Nth instance at
+	 * @param Offset - 0 for the rearmost instance
+	 * @return World X of the instance's tile origin, read back from the component
+	 */
+	float GetRoadInstanceRenderedX(int32 Offset) const;
+};
@@ -23,4 +23,16 @@ public:
 
 	// Override Fire() for testing purposes (just call base implementation)
 	virtual void Fire() override;
+
+	// Records scheduled wakes instead of firing while ScriptedWakeInterval > 0
+	virtual double ProcessScheduledFire(double DueTime, double Now) override;
+
+	// When > 0, scheduled wakes are only recorded and the next wake is due this many seconds later
+	double ScriptedWakeInterval = 0.0;
+
+	// Due times of the wakes recorded while scripted
+	TArray<double> ScheduledWakeDueTimes;
+
+	// Game times the scheduler delivered those wakes at
+	TArray<double> ScheduledWakeTimes;
 };
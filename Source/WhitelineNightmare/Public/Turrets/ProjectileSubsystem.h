@@ -0,0 +1,322 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ProjectileSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+class UProjectileSubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnProjectileHit, AActor*, HitActor, float, Damage, FVector, HitLocation);
+
+/**
+ * Tick function that advances every projectile in one batched pass
+ */
+USTRUCT()
+struct FProjectileTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem to tick
+	UProjectileSubsystem* Target = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FProjectileTickFunction> : public TStructOpsTypeTraitsBase2<FProjectileTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Parameters for one projectile
+ */
+USTRUCT(BlueprintType)
+struct FProjectileSpawnParams
+{
+	GENERATED_BODY()
+
+	// World location the projectile starts at
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	FVector Origin = FVector::ZeroVector;
+
+	// Direction of travel (normalized on spawn)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	FVector Direction = FVector::ForwardVector;
+
+	// Muzzle speed in units per second
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float Speed = 5000.0f;
+
+	// Damage applied on hit
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float Damage = 10.0f;
+
+	// Collision radius
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float Radius = 10.0f;
+
+	// Seconds before the projectile expires
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float Lifetime = 1.0f;
+
+	// Seconds the round has already been flying at launch (a shot due earlier in the frame); added to its first update
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float HeadStart = 0.0f;
+
+	// Mesh rendered for the projectile (null = simulated but not rendered)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+	// Uniform mesh scale
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	float MeshScale = 0.1f;
+
+	// False for rounds fired from the rig (they keep its motion along the road); true for rounds that move with the road
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	bool bMovesWithRoad = false;
+
+	// Actor that fired the projectile (never hit)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	TObjectPtr<AActor> Instigator = nullptr;
+
+	// Additional actor the projectile passes through (e.g. the instigator's war rig)
+	UPROPERTY(BlueprintReadWrite, Category = "Projectile")
+	TObjectPtr<AActor> IgnoredActor = nullptr;
+};
+
+/**
+ * All projectiles sharing one mesh: structure-of-arrays state plus one instanced mesh component
+ */
+USTRUCT()
+struct FProjectileBatch
+{
+	GENERATED_BODY()
+
+	// Mesh shared by the batch
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+	// Instances rendering the batch (null when Mesh is null)
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+
+	// Per-projectile state (parallel arrays)
+	TArray<float> PositionX;
+	TArray<float> PositionY;
+	TArray<float> PositionZ;
+	TArray<float> VelocityX;
+	TArray<float> VelocityY;
+	TArray<float> VelocityZ;
+	TArray<float> ScrollScale;
+	TArray<float> Damage;
+	TArray<float> Radius;
+	TArray<float> TimeRemaining;
+	TArray<float> HeadStart;
+	TArray<float> MeshScale;
+	TArray<FQuat4f> Rotation;
+	TArray<TWeakObjectPtr<AActor>> Instigator;
+	TArray<TWeakObjectPtr<AActor>> IgnoredActor;
+
+	// Segment start of the current update (scratch)
+	TArray<float> PreviousX;
+	TArray<float> PreviousY;
+	TArray<float> PreviousZ;
+
+	// Instances currently showing a projectile (the rest are hidden, not removed)
+	int32 VisibleInstanceCount = 0;
+
+	/** Number of projectiles in the batch */
+	int32 Num() const { return PositionX.Num(); }
+
+	/**
+	 * Append a projectile
+	 * @param Params - Spawn parameters (Direction must be normalized)
+	 * @param InRotation - Mesh orientation
+	 */
+	void Add(const FProjectileSpawnParams& Params, const FQuat4f& InRotation);
+
+	/**
+	 * Swap-remove a projectile
+	 * @param Index - Projectile index
+	 */
+	void RemoveAtSwap(int32 Index);
+
+	/** Remove every projectile (keeps allocations) */
+	void Reset();
+};
+
+/**
+ * Projectile Subsystem - Simulates turret rounds as data instead of actors
+ *
+ * Each projectile is a row in structure-of-arrays storage grouped by mesh. One tick function
+ * advances every projectile (adding the world scroll velocity for rounds that move with the
+ * road), gathers the pawns inside one box bounding every projectile's swept segment this frame
+ * (from the scroll mover subsystem's lane index plus one overlap for pawns that aren't indexed),
+ * resolves hits with segment-vs-sphere tests against them, and writes all transforms to one
+ * instanced static mesh component per mesh. Cost per round is a few floats and one instance.
+ *
+ * Hits apply damage to the target's UCombatAttributeSet through its ability system component
+ * when it has one, otherwise through the engine damage path, and broadcast OnProjectileHit.
+ *
+ * Usage:
+ * 1. UProjectileSubsystem::Get(this)->FireProjectile(Params)
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UProjectileSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the projectile subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UProjectileSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Launch a projectile
+	 * @param Params - Spawn parameters
+	 * @return False if the projectile limit is reached or the parameters are invalid
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	bool FireProjectile(const FProjectileSpawnParams& Params);
+
+	/**
+	 * Advance, collide and render every projectile
+	 * @param DeltaTime - Frame time in seconds
+	 */
+	void TickProjectiles(float DeltaTime);
+
+	/**
+	 * Get the number of projectiles in flight
+	 * @return Projectile count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Projectile")
+	int32 GetProjectileCount() const { return ProjectileCount; }
+
+	/**
+	 * Get the number of hits resolved since the subsystem started
+	 * @return Hit count
+	 */
+	UFUNCTION(BlueprintPure, Category = "Projectile")
+	int32 GetHitCount() const { return HitCount; }
+
+	/**
+	 * Get the number of hit candidate gathers that ran a physics overlap
+	 * @return Physics query count
+	 */
+	int32 GetOverlapQueryCount() const { return OverlapQueryCount; }
+
+	/**
+	 * Set the maximum number of projectiles in flight
+	 * @param NewMax - Projectile limit (>= 1)
+	 */
+	void SetMaxProjectiles(int32 NewMax) { MaxProjectiles = FMath::Max(NewMax, 1); }
+
+	/**
+	 * Apply a round's damage to a hit actor, count the hit and broadcast OnProjectileHit
+	 * (also used for hitscan shots resolved elsewhere)
+	 * @param HitActor - Actor that was hit
+	 * @param Damage - Damage to apply
+	 * @param Instigator - Actor that fired the round (may be null)
+	 * @param HitLocation - Where the hit happened
+	 */
+	void ApplyHit(AActor* HitActor, float Damage, AActor* Instigator, const FVector& HitLocation);
+
+	/** Remove every projectile in flight */
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	void ClearProjectiles();
+
+	// Broadcast for every projectile hit
+	UPROPERTY(BlueprintAssignable, Category = "Projectile")
+	FOnProjectileHit OnProjectileHit;
+
+	// Default projectile limit
+	static constexpr int32 DefaultMaxProjectiles = 4096;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Find or create the batch for a mesh
+	 * @param Mesh - Projectile mesh (may be null)
+	 * @return Batch index
+	 */
+	int32 GetOrCreateBatch(UStaticMesh* Mesh);
+
+	/**
+	 * Gather hit candidates covering every swept segment from the lane index and one overlap, once per actor
+	 * @param SweepBounds - Bounds of every segment, expanded by the largest projectile radius
+	 */
+	void GatherHitCandidates(const FBox& SweepBounds);
+
+	/**
+	 * Append one hit candidate to the parallel arrays
+	 * @param Actor - Candidate actor
+	 */
+	void AddHitCandidate(AActor* Actor);
+
+	/**
+	 * Find the first candidate a projectile's segment this frame passes through
+	 * @param Batch - Projectile batch
+	 * @param Index - Projectile index in the batch
+	 * @param OutHitLocation - Receives the point on the segment closest to the hit candidate
+	 * @return Hit candidate index, or INDEX_NONE
+	 */
+	int32 FindHitCandidate(const FProjectileBatch& Batch, int32 Index, FVector& OutHitLocation) const;
+
+	/**
+	 * Write every projectile transform of a batch to its instances (hides instances no longer used)
+	 * @param Batch - Batch to render
+	 */
+	void UpdateBatchInstances(FProjectileBatch& Batch);
+
+	// Projectile storage, one batch per mesh
+	UPROPERTY()
+	TArray<FProjectileBatch> Batches;
+
+	// Actor owning the instanced mesh components
+	UPROPERTY()
+	TObjectPtr<AActor> RenderActor;
+
+	// Hit candidates of the current update (parallel arrays)
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> HitCandidateActors;
+	TArray<FVector3f> HitCandidateLocations;
+	TArray<float> HitCandidateRadii;
+
+	// Instance transform scratch
+	TArray<FTransform> InstanceTransforms;
+
+	// Tick function running TickProjectiles
+	FProjectileTickFunction ProjectileTickFunction;
+
+	// Projectiles in flight across all batches
+	int32 ProjectileCount = 0;
+
+	// Projectile limit
+	int32 MaxProjectiles = DefaultMaxProjectiles;
+
+	// Hits resolved so far
+	int32 HitCount = 0;
+
+	// Hit candidate gathers that ran a physics overlap
+	int32 OverlapQueryCount = 0;
+};
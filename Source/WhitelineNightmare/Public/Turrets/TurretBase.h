@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayTagContainer.h"
+#include "Core/ObjectPoolTypes.h"
 #include "TurretBase.generated.h"
 
 // Forward declarations
@@ -27,20 +28,29 @@ struct FTurretData;
  * - Target acquisition via sphere overlap + arc filtering
  *
  * LIFECYCLE:
- * 1. Spawned at mount point during placement
+ * 1. Taken from the per-TurretClass pool and attached to a mount point during placement
+ *    (AWarRigPawn::PlaceTurret)
  * 2. Initialize() called to setup stats from data table
  * 3. Abilities granted (auto-fire ability)
  * 4. Begins targeting and firing
- * 5. Destroyed when war rig destroyed or player sells
+ * 5. Returned to the pool when the player sells (AWarRigPawn::RemoveTurret); ResetState clears
+ *    active gameplay effects, restores attribute defaults and detaches from the mount
+ * 6. Destroyed with the pool
  *
  * TARGETING:
- * - Sphere overlap query for potential targets (radius = Range attribute)
+ * - Candidates come from UTurretTargetingSubsystem (one shared overlap per frame for all turrets)
+ * - Falls back to a per-turret sphere overlap (radius = Range attribute) when not registered
  * - Filters targets within 180° firing arc using dot product
  * - Priority: closest enemy in range + arc
  * - Returns nullptr if no valid targets
+ *
+ * FIRING:
+ * - UTurretFireSchedulerSubsystem wakes the turret when a shot is due (ProcessScheduledFire);
+ *   the actor tick stays off unless debug visualization is on
+ * - Falls back to Tick-driven fire timing when not registered with the scheduler
  */
 UCLASS(Abstract)
-class WHITELINENIGHTMARE_API ATurretBase : public AActor, public IAbilitySystemInterface
+class WHITELINENIGHTMARE_API ATurretBase : public AActor, public IAbilitySystemInterface, public IPoolableActor
 {
 	GENERATED_BODY()
 
@@ -49,6 +59,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -56,6 +67,11 @@ public:
 	// IAbilitySystemInterface
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
+	// IPoolableActor interface implementation
+	virtual void OnActivated_Implementation() override;
+	virtual void OnDeactivated_Implementation() override;
+	virtual void ResetState_Implementation() override;
+
 	// === INITIALIZATION ===
 
 	/**
@@ -68,6 +84,12 @@ public:
 	 */
 	virtual void Initialize(const FTurretData& TurretData, int32 InMountIndex, const FRotator& InFacingDirection, AWarRigPawn* InOwnerWarRig);
 
+	/**
+	 * Leave the current mount: stop targeting and scheduled fire and detach from the mount point
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Turret")
+	void DetachFromMount();
+
 	// === VIRTUAL FUNCTIONS FOR SUBCLASSES ===
 
 	/**
@@ -102,6 +124,33 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Turret|Combat")
 	TArray<AActor*> GetPotentialTargets() const;
 
+	/**
+	 * Validate that target is valid and alive (line of sight is read from the trace cache, never traced here)
+	 * @param Target - Potential target
+	 * @return true if the turret may engage the target
+	 */
+	bool IsTargetValid(AActor* Target) const;
+
+	/**
+	 * Check whether a target can still be engaged (valid, in range and in the firing arc)
+	 * @param Target - Target to check
+	 * @return true if the turret can keep the target
+	 */
+	UFUNCTION(BlueprintPure, Category = "Turret|Combat")
+	bool IsTargetEngageable(AActor* Target) const;
+
+	// === FIRE SCHEDULING ===
+
+	/**
+	 * Called by the fire scheduler when this turret is due: refresh the target and fire every shot
+	 * whose due time has passed (shots due earlier in the frame launch with a matching head start)
+	 * Shots due more than UTurretFireSchedulerSubsystem::MaxFireBacklog ago are dropped.
+	 * @param DueTime - Game time the wake was scheduled for
+	 * @param Now - Current game time
+	 * @return Game time of the next wake
+	 */
+	virtual double ProcessScheduledFire(double DueTime, double Now);
+
 	// === GETTERS ===
 
 	UFUNCTION(BlueprintPure, Category = "Turret")
@@ -110,6 +159,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Turret")
 	FORCEINLINE FRotator GetFacingDirection() const { return FacingDirection; }
 
+	/** Set the firing arc's forward direction (e.g. when a rig swap moves the turret's mount) */
+	void SetFacingDirection(const FRotator& InFacingDirection) { FacingDirection = InFacingDirection; }
+
 	UFUNCTION(BlueprintPure, Category = "Turret")
 	FORCEINLINE AWarRigPawn* GetOwnerWarRig() const { return OwnerWarRig; }
 
@@ -119,6 +171,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Turret")
 	UCombatAttributeSet* GetCombatAttributeSet() const { return CombatAttributes; }
 
+	/** True while the turret's ability system replicates and ticks (off on lightweight rigs and in the pool) */
+	UFUNCTION(BlueprintPure, Category = "Turret")
+	bool IsAbilitySystemActive() const;
+
 	// === DEBUG VISUALIZATION ===
 
 	/** Draw debug visualization for firing arc, range, and current target */
@@ -133,6 +189,10 @@ public:
 	UFUNCTION(Exec, Category = "Debug|Turret")
 	void DebugShowTurretInfo();
 
+	/** Console command: Show shared targeting counters (re-acquisitions, budget deferrals, target quality) */
+	UFUNCTION(Exec, Category = "Debug|Turret")
+	void DebugShowTargetingStats();
+
 protected:
 	// === COMPONENTS ===
 
@@ -144,7 +204,7 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Turret|Components")
 	TObjectPtr<UStaticMeshComponent> TurretMesh;
 
-	/** Ability System Component for GAS integration */
+	/** Ability System Component for GAS integration (replication and tick off while lightweight or pooled) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Turret|Abilities")
 	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
 
@@ -170,10 +230,39 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Turret|Combat")
 	TObjectPtr<AActor> CurrentTarget;
 
+	/** Seconds a valid target is kept before full target selection runs again (0 = every frame) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Combat")
+	float TargetReevaluationInterval;
+
+	/** Seconds until the next full target selection (staggered by mount index) */
+	float TimeUntilTargetReevaluation;
+
+	/** Reject targets whose last async line-of-sight trace was blocked */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Combat")
+	bool bRequireLineOfSight;
+
+	/** Projectile speed in units per second (from data table, 0 = hitscan through async traces) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	float ProjectileSpeed;
+
+	/** Projectile collision radius (from data table) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	float ProjectileRadius;
+
+	/** Mesh rendered for each projectile (resolved from the data table at Initialize) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Turret|Projectile")
+	TObjectPtr<UStaticMesh> ProjectileMesh;
+
 	/** Time since last fire (for fire rate timing) */
 	UPROPERTY(BlueprintReadOnly, Category = "Turret|Combat")
 	float TimeSinceLastFire;
 
+	/** Seconds the shot being fired is late (scheduled shots due earlier in the frame) */
+	float ShotTimeOffset;
+
+	/** Game time of the last scheduled wake (-1 before the first) */
+	double LastScheduledWakeTime;
+
 	// === DEBUG ===
 
 	/** Show debug visualization (firing arc, range, target line) */
@@ -197,6 +286,28 @@ protected:
 	/** Validate that all required components and references are valid */
 	bool ValidateTurretSetup() const;
 
-	/** Validate that target is valid and alive */
-	bool IsTargetValid(AActor* Target) const;
+	// === ABILITY SYSTEM ===
+
+	/**
+	 * Switch replication and tick of our ability system component (effects and timers keep working either way)
+	 * @param bActive - True for a mount on a rig without lightweight turret ability systems
+	 */
+	void SetAbilitySystemActive(bool bActive);
+
+	// === TURRET SUBSYSTEMS ===
+
+	/** Join the shared targeting query and the fire scheduler (actor tick stays on only without a scheduler or for debug) */
+	void RegisterWithTurretSubsystems();
+
+	/** Leave the shared targeting query and the fire scheduler */
+	void UnregisterFromTurretSubsystems();
+
+	// === TARGETING ===
+
+	/**
+	 * Keep the current target while it stays engageable; re-run target selection when it is lost
+	 * or the re-evaluation interval expires and the shared per-frame budget allows
+	 * @param DeltaTime - Frame time in seconds
+	 */
+	void UpdateTarget(float DeltaTime);
 };
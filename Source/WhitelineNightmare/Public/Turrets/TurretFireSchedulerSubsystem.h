@@ -0,0 +1,170 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "TurretFireSchedulerSubsystem.generated.h"
+
+class ATurretBase;
+class UTurretFireSchedulerSubsystem;
+
+/**
+ * Tick function that advances the fire scheduler's timing wheel
+ */
+USTRUCT()
+struct FTurretFireTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem to tick
+	UTurretFireSchedulerSubsystem* Target = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTurretFireTickFunction> : public TStructOpsTypeTraitsBase2<FTurretFireTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Turret Fire Scheduler Subsystem - Wakes turrets only when their next shot is due
+ *
+ * Each registered turret has one entry holding its next wake time in game seconds. Entries live
+ * in a hashed timing wheel of WheelSlotCount slots, each SlotDuration seconds wide; a wake time
+ * further out than one revolution simply stays in its slot until a later pass finds it due.
+ * Every frame the wheel visits only the slots elapsed since the last frame, so the per-frame cost
+ * scales with the turrets that are due, not with the turrets in play. Registered turrets switch
+ * their own actor tick off.
+ *
+ * A woken turret fires every shot whose exact due time has passed (see
+ * ATurretBase::ProcessScheduledFire), so high fire rates at low frame rates keep their rate of
+ * fire; only shots due more than MaxFireBacklog ago (a long hitch) are dropped. Unregistering is
+ * lazy: a stale entry is dropped when its slot is next visited.
+ *
+ * Usage: turrets register themselves when Initialize mounts them and unregister in EndPlay or
+ * when they leave their mount (e.g. returned to their pool).
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UTurretFireSchedulerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UTurretFireSchedulerSubsystem();
+
+	// USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the fire scheduler for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UTurretFireSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Start scheduling a turret; it is first woken on the next frame
+	 * @param Turret - Turret to schedule
+	 */
+	void RegisterTurret(ATurretBase* Turret);
+
+	/**
+	 * Stop scheduling a turret
+	 * @param Turret - Turret to remove
+	 */
+	void UnregisterTurret(ATurretBase* Turret);
+
+	/**
+	 * Check whether a turret is scheduled
+	 * @param Turret - Turret to check
+	 * @return true if the scheduler owns the turret's fire timing
+	 */
+	bool IsTurretRegistered(const ATurretBase* Turret) const { return RegisteredTurrets.Contains(Turret); }
+
+	/**
+	 * Wake every turret due up to a game time
+	 * @param Now - Current game time in seconds
+	 */
+	void AdvanceTo(double Now);
+
+	/**
+	 * Get the number of scheduled turrets
+	 * @return Registered turret count
+	 */
+	int32 GetRegisteredTurretCount() const { return RegisteredTurrets.Num(); }
+
+	/**
+	 * Get the number of turret wake-ups since the subsystem started
+	 * @return Wake count
+	 */
+	int32 GetWakeCount() const { return WakeCount; }
+
+	// Number of slots in the timing wheel (power of two)
+	static constexpr int32 WheelSlotCount = 256;
+
+	// Seconds covered by one slot
+	static constexpr double SlotDuration = 1.0 / 60.0;
+
+	// Seconds of overdue shots a woken turret still fires; older shots are dropped after a long hitch
+	static constexpr double MaxFireBacklog = 0.25;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** A turret waiting in the wheel */
+	struct FScheduledTurret
+	{
+		TWeakObjectPtr<ATurretBase> Turret;
+		double WakeTime = 0.0;
+		// Registration the entry belongs to (entries left by an earlier registration are dropped)
+		uint32 Registration = 0;
+	};
+
+	/**
+	 * Put a turret into the slot of its wake time (never a slot already visited)
+	 * @param Entry - Turret and wake time
+	 */
+	void Insert(const FScheduledTurret& Entry);
+
+	/**
+	 * Convert a game time to an absolute slot index
+	 * @param Time - Game time in seconds
+	 * @return Slot index (not wrapped)
+	 */
+	static int64 TimeToSlot(double Time) { return FMath::FloorToInt64(Time / SlotDuration); }
+
+	// Timing wheel slots
+	TArray<TArray<FScheduledTurret>> Wheel;
+
+	// Entries taken out of the slot being visited (scratch)
+	TArray<FScheduledTurret> DueScratch;
+
+	// Turrets currently scheduled, with their registration number
+	TMap<const ATurretBase*, uint32> RegisteredTurrets;
+
+	// Tick function advancing the wheel
+	FTurretFireTickFunction FireTickFunction;
+
+	// Last absolute slot visited
+	int64 LastVisitedSlot = -1;
+
+	// Game time the wheel was last advanced to
+	double LastAdvanceTime = 0.0;
+
+	// Number given to the next registration
+	uint32 NextRegistration = 1;
+
+	// Turret wake-ups so far
+	int32 WakeCount = 0;
+};
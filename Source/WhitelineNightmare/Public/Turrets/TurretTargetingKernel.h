@@ -0,0 +1,38 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Turret Targeting Kernel - Batch arc/range filter over structure-of-arrays candidate positions
+ *
+ * Finds the closest candidate inside a turret's range and 180° firing arc without a sqrt:
+ * range is tested on squared distance and the arc on the sign of the unnormalized dot
+ * product between the turret's forward vector and the delta to the candidate. FindClosest
+ * processes four candidates per step with VectorRegister math; FindClosestScalar is the
+ * reference implementation and must return the same index.
+ */
+struct WHITELINENIGHTMARE_API FTurretTargetingKernel
+{
+	/**
+	 * Find the closest candidate in range and in arc (SIMD)
+	 * @param X - Candidate X positions
+	 * @param Y - Candidate Y positions
+	 * @param Z - Candidate Z positions
+	 * @param Num - Number of candidates
+	 * @param Origin - Turret location
+	 * @param Forward - Turret forward vector (need not be normalized)
+	 * @param RangeSquared - Squared turret range
+	 * @param OutDistanceSquared - Receives the squared distance of the result (optional)
+	 * @return Candidate index, or INDEX_NONE if no candidate qualifies (ties resolve to the lowest index)
+	 */
+	static int32 FindClosest(const float* X, const float* Y, const float* Z, int32 Num,
+		const FVector3f& Origin, const FVector3f& Forward, float RangeSquared, float* OutDistanceSquared = nullptr);
+
+	/**
+	 * Scalar reference for FindClosest (same parameters and result)
+	 */
+	static int32 FindClosestScalar(const float* X, const float* Y, const float* Z, int32 Num,
+		const FVector3f& Origin, const FVector3f& Forward, float RangeSquared, float* OutDistanceSquared = nullptr);
+};
@@ -0,0 +1,237 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TurretTargetingSubsystem.generated.h"
+
+class ATurretBase;
+
+/**
+ * Targeting counters for weighing sticky-target savings against target quality
+ */
+USTRUCT(BlueprintType)
+struct FTurretTargetingStats
+{
+	GENERATED_BODY()
+
+	// Full target selections run
+	UPROPERTY(BlueprintReadOnly, Category = "Turret Targeting")
+	int32 Reacquisitions = 0;
+
+	// Selections pushed to a later frame by the per-frame budget
+	UPROPERTY(BlueprintReadOnly, Category = "Turret Targeting")
+	int32 DeferredReacquisitions = 0;
+
+	// Frames a turret kept its target and was compared against a full selection (quality sampling only)
+	UPROPERTY(BlueprintReadOnly, Category = "Turret Targeting")
+	int32 QualitySamples = 0;
+
+	// Samples where a closer target than the kept one was available
+	UPROPERTY(BlueprintReadOnly, Category = "Turret Targeting")
+	int32 SuboptimalSamples = 0;
+
+	// Sum of (kept target distance - closest target distance) over suboptimal samples
+	UPROPERTY(BlueprintReadOnly, Category = "Turret Targeting")
+	float TotalExtraDistance = 0.0f;
+};
+
+/**
+ * Turret Targeting Subsystem - Shares one spatial query per frame between all turrets
+ *
+ * Turrets register while in play. The first target request of a frame gathers the pawns inside
+ * one sphere bounding every registered turret's range and stores them as a compact
+ * structure-of-arrays candidate list (actor + X/Y/Z). Pawns registered in the scroll mover
+ * subsystem's lane index are read from it with one bucket walk, including pawns without collision;
+ * the sphere overlap always runs as well for pawns that never registered as lane entities, and
+ * an actor found by both is kept once. Each turret then resolves its closest
+ * in-range, in-arc target from that list with FTurretTargetingKernel, so physics query cost no
+ * longer scales with the number of mounted turrets.
+ *
+ * Turrets keep their target between re-evaluations (see ATurretBase::TargetReevaluationInterval)
+ * and spend a shared per-frame re-acquisition budget when they do re-evaluate. Quality sampling
+ * compares every kept target against a full selection so the cost of stickiness can be measured.
+ *
+ * Usage:
+ * 1. UTurretTargetingSubsystem::Get(this)->RegisterTurret(this) when the turret is mounted
+ * 2. FindBestTarget(this) instead of a per-turret overlap
+ * 3. UnregisterTurret(this) in EndPlay or when the turret leaves its mount
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UTurretTargetingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the targeting subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UTurretTargetingSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Include a turret in the shared candidate query (no-op if already registered)
+	 * @param Turret - Turret to register
+	 */
+	void RegisterTurret(ATurretBase* Turret);
+
+	/**
+	 * Remove a turret from the shared candidate query (no-op if not registered)
+	 * @param Turret - Turret to remove
+	 */
+	void UnregisterTurret(const ATurretBase* Turret);
+
+	/**
+	 * Check whether a turret is registered
+	 * @param Turret - Turret to check
+	 * @return True if registered
+	 */
+	bool IsTurretRegistered(const ATurretBase* Turret) const;
+
+	/**
+	 * Force the next target request to re-run the candidate query
+	 * (call when a turret's range, position or owner changes within a frame)
+	 */
+	void InvalidateCandidates() { bCandidatesDirty = true; }
+
+	/**
+	 * Resolve the closest valid target within a turret's range and firing arc from the shared candidates
+	 * @param Turret - Registered turret requesting a target
+	 * @return Target actor, or nullptr if no candidate qualifies
+	 */
+	AActor* FindBestTarget(const ATurretBase* Turret);
+
+	/**
+	 * Get the number of candidates gathered by the current query
+	 * @return Candidate count
+	 */
+	int32 GetCandidateCount() const { return CandidateActors.Num(); }
+
+	/**
+	 * Get the number of physics overlap candidate queries run since the subsystem started
+	 * @return Physics query count
+	 */
+	int32 GetQueryCount() const { return QueryCount; }
+
+	/**
+	 * Get the number of candidate gathers that found pawns in the lane index
+	 * @return Lane index gather count
+	 */
+	int32 GetLaneQueryCount() const { return LaneQueryCount; }
+
+	/**
+	 * Take one full target selection from this frame's budget
+	 * @return False if the budget is spent (the caller should retry next frame)
+	 */
+	bool TryConsumeReacquisitionBudget();
+
+	/**
+	 * Set how many turrets may run a full target selection per frame
+	 * @param NewBudget - Selections per frame (0 = unlimited)
+	 */
+	void SetReacquisitionBudget(int32 NewBudget) { ReacquisitionBudget = FMath::Max(NewBudget, 0); }
+
+	/**
+	 * Get how many turrets may run a full target selection per frame
+	 * @return Selections per frame (0 = unlimited)
+	 */
+	int32 GetReacquisitionBudget() const { return ReacquisitionBudget; }
+
+	/**
+	 * Enable comparing kept targets against a full selection every frame (costs a selection per sample)
+	 * @param bEnabled - True to sample
+	 */
+	void SetQualitySampling(bool bEnabled) { bQualitySampling = bEnabled; }
+
+	/**
+	 * Check whether quality sampling is enabled
+	 * @return True if kept targets are sampled
+	 */
+	bool IsQualitySamplingEnabled() const { return bQualitySampling; }
+
+	/**
+	 * Compare a turret's kept target with the target a full selection would pick and record the result
+	 * @param Turret - Registered turret keeping its target
+	 * @param KeptTarget - Target the turret is keeping
+	 */
+	void RecordQualitySample(const ATurretBase* Turret, const AActor* KeptTarget);
+
+	/**
+	 * Get targeting counters
+	 * @return Counters accumulated since the last reset
+	 */
+	const FTurretTargetingStats& GetStats() const { return Stats; }
+
+	/** Clear targeting counters */
+	void ResetStats() { Stats = FTurretTargetingStats(); }
+
+	/** Log targeting counters */
+	void LogStats() const;
+
+	// Default full target selections per frame
+	static constexpr int32 DefaultReacquisitionBudget = 4;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Re-run the candidate query if this frame has not run it yet or it was invalidated
+	 */
+	void EnsureCandidates();
+
+	/**
+	 * Rebuild the candidate arrays from the lane index and one overlap covering every registered turret's range
+	 */
+	void GatherCandidates();
+
+	/**
+	 * Append one candidate to the structure-of-arrays list
+	 * @param Actor - Candidate actor
+	 */
+	void AddCandidate(AActor* Actor);
+
+	// Registered turrets
+	TArray<TWeakObjectPtr<ATurretBase>> Turrets;
+
+	// Candidate actors (parallel to CandidateX/Y/Z)
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> CandidateActors;
+
+	// Candidate locations, one array per axis
+	TArray<float> CandidateX;
+	TArray<float> CandidateY;
+	TArray<float> CandidateZ;
+
+	// Frame the candidates were gathered on
+	uint64 GatheredFrame = 0;
+
+	// True when the candidates must be regathered regardless of frame
+	bool bCandidatesDirty = true;
+
+	// Physics candidate queries run so far
+	int32 QueryCount = 0;
+
+	// Candidate gathers that found pawns in the lane index
+	int32 LaneQueryCount = 0;
+
+	// Full target selections allowed per frame (0 = unlimited)
+	int32 ReacquisitionBudget = DefaultReacquisitionBudget;
+
+	// Full target selections spent this frame
+	int32 ReacquisitionsThisFrame = 0;
+
+	// Frame ReacquisitionsThisFrame belongs to
+	uint64 BudgetFrame = 0;
+
+	// Compare kept targets against full selections
+	bool bQualitySampling = false;
+
+	// Targeting counters
+	FTurretTargetingStats Stats;
+};
@@ -0,0 +1,280 @@
+// Copyright Flatlander81. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "WorldCollision.h"
+#include "TurretTraceSubsystem.generated.h"
+
+class ATurretBase;
+class UTurretTraceSubsystem;
+
+/**
+ * Last known line of sight between a turret and a target
+ */
+UENUM(BlueprintType)
+enum class ETurretLineOfSight : uint8
+{
+	Unknown,
+	Visible,
+	Blocked
+};
+
+/**
+ * Tick function that submits queued turret traces within the per-frame cap
+ */
+USTRUCT()
+struct FTurretTraceTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem to tick
+	UTurretTraceSubsystem* Target = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FTurretTraceTickFunction> : public TStructOpsTypeTraitsBase2<FTurretTraceTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Turret Trace Subsystem - Line-of-sight and hitscan traces through the engine's async trace API
+ *
+ * Nothing here blocks the game thread on physics. Traces are submitted through UWorld's async
+ * line traces and their results are consumed when the engine delivers them on the following
+ * frame. At most MaxTracesPerFrame traces are submitted per frame:
+ * - Line of sight is cached per turret/target pair. Each turret update calls RefreshLineOfSight
+ *   once for its target, which schedules a trace when the entry is stale; refreshes over the
+ *   cap are simply retried on the next update. GetLineOfSight only reads the cache, so target
+ *   validity checks never spend trace budget.
+ * - Hitscan shots over the cap wait in a FIFO queue drained at the start of later frames. The
+ *   queue holds at most MaxQueuedHitscans shots and drops shots older than MaxHitscanQueueAge,
+ *   since by then they would be aimed at where the target used to be. Hits apply damage
+ *   through UProjectileSubsystem::ApplyHit.
+ */
+UCLASS()
+class WHITELINENIGHTMARE_API UTurretTraceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the trace subsystem for a world context object
+	 * @param WorldContextObject - Any object living in the target world
+	 * @return Subsystem or nullptr if the world has none
+	 */
+	static UTurretTraceSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Get the last known line of sight from a turret to a target without tracing
+	 * @param Turret - Turret looking
+	 * @param Target - Target to see
+	 * @return Cached result (Unknown if the pair was never refreshed or no trace has completed)
+	 */
+	ETurretLineOfSight GetLineOfSight(const ATurretBase* Turret, const AActor* Target) const;
+
+	/**
+	 * Keep a turret/target pair's line of sight cached, scheduling an async trace when it is stale
+	 * @param Turret - Turret looking
+	 * @param Target - Target to see
+	 * @return Last known result (Unknown until the first trace completes)
+	 */
+	ETurretLineOfSight RefreshLineOfSight(const ATurretBase* Turret, const AActor* Target);
+
+	/**
+	 * Fire a hitscan shot; the trace runs asynchronously and damage is applied when it completes
+	 * @param Turret - Turret firing
+	 * @param Start - Trace start
+	 * @param End - Trace end
+	 * @param Damage - Damage applied to the first actor hit
+	 */
+	void RequestHitscan(ATurretBase* Turret, const FVector& Start, const FVector& End, float Damage);
+
+	/**
+	 * Drop stale queued hitscan shots and submit the rest up to this frame's cap
+	 */
+	void TickTraces();
+
+	/**
+	 * Resolve every in-flight trace now with a blocking trace (their async results are ignored)
+	 * Used by tests, which cannot wait for the engine to deliver results on a later frame.
+	 */
+	void FlushPendingTraces();
+
+	/**
+	 * Set how many traces may be submitted per frame
+	 * @param NewMax - Traces per frame (>= 1)
+	 */
+	void SetMaxTracesPerFrame(int32 NewMax) { MaxTracesPerFrame = FMath::Max(NewMax, 1); }
+
+	/**
+	 * Get how many traces may be submitted per frame
+	 * @return Traces per frame
+	 */
+	int32 GetMaxTracesPerFrame() const { return MaxTracesPerFrame; }
+
+	/**
+	 * Get the number of traces submitted during the current frame
+	 * @return Traces counted against this frame's cap
+	 */
+	int32 GetTracesThisFrame() const { return BudgetFrame == GFrameCounter ? TracesThisFrame : 0; }
+
+	/**
+	 * Get the number of traces submitted and not yet completed
+	 * @return In-flight trace count
+	 */
+	int32 GetPendingTraceCount() const { return PendingTraces.Num(); }
+
+	/**
+	 * Get the number of hitscan shots waiting for trace budget
+	 * @return Queued shot count
+	 */
+	int32 GetQueuedHitscanCount() const { return QueuedHitscans.Num(); }
+
+	/**
+	 * Get the number of traces submitted since the subsystem started
+	 * @return Submitted trace count
+	 */
+	int32 GetSubmittedTraceCount() const { return SubmittedTraceCount; }
+
+	/**
+	 * Get the number of queued hitscan shots dropped for age or queue size
+	 * @return Dropped shot count
+	 */
+	int32 GetDroppedHitscanCount() const { return DroppedHitscanCount; }
+
+	// Default traces submitted per frame
+	static constexpr int32 DefaultMaxTracesPerFrame = 16;
+
+	// Seconds a line-of-sight result is trusted before it is refreshed
+	static constexpr float LineOfSightRefreshInterval = 0.2f;
+
+	// Most hitscan shots waiting for budget (the oldest is dropped when full)
+	static constexpr int32 MaxQueuedHitscans = 64;
+
+	// Seconds a hitscan shot may wait for budget before it is dropped
+	static constexpr float MaxHitscanQueueAge = 0.25f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Kind of trace in flight */
+	enum class ETraceKind : uint8
+	{
+		LineOfSight,
+		Hitscan
+	};
+
+	/** A trace waiting for budget or for its result */
+	struct FTurretTrace
+	{
+		ETraceKind Kind = ETraceKind::LineOfSight;
+		// Line-of-sight cache key (stays valid as a key after either actor is destroyed)
+		const ATurretBase* TurretKey = nullptr;
+		const AActor* TargetKey = nullptr;
+		// Firing turret (hitscan damage instigator)
+		TWeakObjectPtr<ATurretBase> Turret;
+		// Actors the trace passes through (turret, its war rig, and the target for line of sight)
+		TArray<TWeakObjectPtr<const AActor>> IgnoredActors;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		float Damage = 0.0f;
+		// World time the shot was requested (hitscan queue age)
+		double RequestTime = 0.0;
+	};
+
+	/** Cached line of sight for one turret/target pair */
+	struct FLineOfSightEntry
+	{
+		ETurretLineOfSight Result = ETurretLineOfSight::Unknown;
+		double LastUpdateTime = -1.0;
+		double LastQueryTime = 0.0;
+		bool bPending = false;
+	};
+
+	/**
+	 * Take one trace from this frame's cap
+	 * @return False if the cap is reached
+	 */
+	bool TryConsumeTraceBudget();
+
+	/**
+	 * Submit an async line trace
+	 * @param Trace - Trace to submit
+	 */
+	void SubmitTrace(const FTurretTrace& Trace);
+
+	/**
+	 * Async trace completion callback
+	 * @param Handle - Trace handle
+	 * @param Datum - Trace results (UserData identifies the pending trace)
+	 */
+	void HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/**
+	 * Apply a finished trace: update the line-of-sight cache or resolve the hitscan shot
+	 * @param Trace - Completed trace
+	 * @param BlockingHit - First blocking hit, or null if the trace was clear
+	 */
+	void CompleteTrace(const FTurretTrace& Trace, const FHitResult* BlockingHit);
+
+	/**
+	 * Build the query params ignoring a trace's actors
+	 * @param Trace - Trace to build params for
+	 * @return Query params
+	 */
+	static FCollisionQueryParams MakeQueryParams(const FTurretTrace& Trace);
+
+	/**
+	 * Drop cached line-of-sight entries that have not been queried recently
+	 */
+	void PruneLineOfSight();
+
+	// Line of sight by turret/target pair
+	TMap<TPair<const ATurretBase*, const AActor*>, FLineOfSightEntry> LineOfSightCache;
+
+	// Traces submitted and awaiting results, by trace id
+	TMap<uint32, FTurretTrace> PendingTraces;
+
+	// Hitscan shots waiting for trace budget (oldest first)
+	TArray<FTurretTrace> QueuedHitscans;
+
+	// Completion delegate shared by every trace
+	FTraceDelegate TraceDoneDelegate;
+
+	// Tick function running TickTraces
+	FTurretTraceTickFunction TraceTickFunction;
+
+	// Traces allowed per frame
+	int32 MaxTracesPerFrame = DefaultMaxTracesPerFrame;
+
+	// Traces submitted this frame
+	int32 TracesThisFrame = 0;
+
+	// Frame TracesThisFrame belongs to
+	uint64 BudgetFrame = 0;
+
+	// Id given to the next submitted trace
+	uint32 NextTraceId = 1;
+
+	// Traces submitted so far
+	int32 SubmittedTraceCount = 0;
+
+	// Queued hitscan shots dropped so far
+	int32 DroppedHitscanCount = 0;
+};
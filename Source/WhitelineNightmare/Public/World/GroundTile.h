@@ -16,7 +16,7 @@
  * Usage:
  * 1. Created by GroundTileManager using object pool
  * 2. Positioned ahead of the war rig
- * 3. Scrolls backward each tick at scroll velocity
+ * 3. Scrolls backward at scroll velocity while active (moved by UScrollMoverSubsystem)
  * 4. Recycled when it passes behind the war rig
  *
  * Implements IPoolableActor interface for proper pool lifecycle management
@@ -86,18 +86,6 @@ protected:
 	float TileLength;
 
 private:
-	/**
-	 * Update tile position based on scroll velocity
-	 * @param DeltaTime - Time since last frame
-	 */
-	void UpdateScrollPosition(float DeltaTime);
-
-	/**
-	 * Get world scroll component from game mode
-	 * @return WorldScrollComponent or nullptr if not found
-	 */
-	class UWorldScrollComponent* GetWorldScrollComponent() const;
-
 	/**
 	 * Draw debug visualization
 	 */
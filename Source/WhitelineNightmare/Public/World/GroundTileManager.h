@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Core/ObjectPoolTypes.h"
 #include "GroundTileManager.generated.h"
 
+class UInstancedStaticMeshComponent;
+
 /**
  * Ground Tile Manager - Manages spawning and scrolling of ground tiles
  *
@@ -24,6 +27,19 @@
  * - Detect when tiles pass behind war rig
  * - Recycle tiles to front of road
  * - Provide debug visualization
+ *
+ * Instanced road mode (bUseInstancedRoad) skips tile actors entirely: one instanced static
+ * mesh component holds a ring of tile instances. The component itself is placed from the
+ * scroll component's distance traveled, and the rear instance is rewritten to the front when
+ * it passes the despawn threshold, so the road costs one component regardless of its length.
+ *
+ * In every mode the road is set up once the asset preload has finished, so the tile mesh and
+ * material overrides resolve from memory instead of loading synchronously.
+ *
+ * Analytic placement mode (bAnalyticTilePlacement) keeps tile actors but derives every tile's
+ * X from the scroll component's distance traveled instead of per-tile scroll offsets, and
+ * recycles as many tiles per frame as the distance requires, so the road stays seamless at
+ * any scroll speed or frame time.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class WHITELINENIGHTMARE_API UGroundTileManager : public UActorComponent
@@ -34,6 +50,7 @@ public:
 	UGroundTileManager();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/**
@@ -41,7 +58,14 @@ public:
 	 * @return Number of tiles currently spawned
 	 */
 	UFUNCTION(BlueprintPure, Category = "Ground Tile Manager")
-	int32 GetActiveTileCount() const { return ActiveTiles.Num(); }
+	int32 GetActiveTileCount() const { return bUseInstancedRoad ? RoadInstanceLocalX.Num() : ActiveTileCount; }
+
+	/**
+	 * Check whether the road is rendered as instances instead of tile actors
+	 * @return True in instanced road mode
+	 */
+	UFUNCTION(BlueprintPure, Category = "Ground Tile Manager")
+	bool IsUsingInstancedRoad() const { return bUseInstancedRoad; }
 
 	/**
 	 * Get position of the furthest forward tile
@@ -56,6 +80,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Ground Tile Manager")
 	void CheckForTileRecycling();
 
+	/**
+	 * Get the data table the tile configuration is read from
+	 * @return Tile data table, or nullptr if none is assigned
+	 */
+	UDataTable* GetTileDataTable() const { return TileDataTable; }
+
+	/**
+	 * Set the scroll component the road follows instead of the game mode's
+	 * @param InScrollSource - Scroll component to follow (nullptr to use the game mode's again)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ground Tile Manager")
+	void SetScrollSource(class UWorldScrollComponent* InScrollSource) { ScrollSource = InScrollSource; }
+
 	// === DEBUG FUNCTIONS ===
 
 	/** Toggle debug visualization of tiles */
@@ -95,10 +132,19 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|Components")
 	class UObjectPoolComponent* TilePool;
 
-	// Active tiles currently on the road
+	// Ring buffer of active tiles, rearmost at ActiveTileHead (tiles scroll uniformly, so order never changes)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|State")
 	TArray<class AGroundTile*> ActiveTiles;
 
+	// Pool handle for each entry in ActiveTiles (parallel ring buffer)
+	TArray<FPooledActorHandle> ActiveTileHandles;
+
+	// Ring index of the rearmost active tile
+	int32 ActiveTileHead;
+
+	// Number of active tiles in the ring
+	int32 ActiveTileCount;
+
 	// Tile size (loaded from data table)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|Config")
 	float TileSize;
@@ -123,10 +169,82 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|Config")
 	TSoftObjectPtr<UMaterialInterface> ConfiguredTileMaterial;
 
+	// ConfiguredTileMesh resolved once after it streamed in (so tile spawns never load from disk)
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> ResolvedTileMesh;
+
+	// ConfiguredTileMaterial resolved alongside ResolvedTileMesh
+	UPROPERTY()
+	TObjectPtr<UMaterialInterface> ResolvedTileMaterial;
+
 	// Debug visualization
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground Tile Manager|Debug")
 	bool bShowDebugVisualization;
 
+	// Place tiles from the scroll distance traveled every frame instead of moving them with the scroll subsystem (set before BeginPlay)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|Config")
+	bool bAnalyticTilePlacement;
+
+	// Road index of the rearmost active tile (analytic placement only)
+	int64 ActiveTileRearRoadIndex;
+
+	// X of road index 0 when the scroll distance equals AnalyticAnchorDistance
+	float AnalyticAnchorX;
+
+	// Scroll distance traveled when the analytic road was anchored
+	double AnalyticAnchorDistance;
+
+	// True once the analytic road has an anchor
+	bool bAnalyticRoadAnchored;
+
+	// Render the road as a ring of mesh instances instead of pooled AGroundTile actors
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ground Tile Manager|Instanced Road")
+	bool bUseInstancedRoad;
+
+	// Instanced road mesh component (instanced road mode only)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Ground Tile Manager|Instanced Road")
+	TObjectPtr<UInstancedStaticMeshComponent> RoadInstances;
+
+	// Component-space X of each instance's tile origin
+	TArray<float> RoadInstanceLocalX;
+
+	// Index of the rearmost instance in the ring
+	int32 RoadRingHead;
+
+	// Scroll distance traveled when the instanced road component was last at X = 0
+	double RoadAnchorDistance;
+
+	// True while the road setup waits for the asset preload to finish (nothing is built or ticked until then)
+	bool bWaitingForTileAssets;
+
+	// Scroll component set with SetScrollSource (the game mode's is used when unset)
+	UPROPERTY(Transient)
+	TObjectPtr<class UWorldScrollComponent> ScrollSource;
+
+	// Tile mesh transform relative to the tile origin (taken from the tile class defaults)
+	FTransform RoadInstanceBaseTransform;
+
+	/**
+	 * Create the instanced road component and fill the ring from behind the war rig to the spawn distance
+	 */
+	void BuildInstancedRoad();
+
+	/**
+	 * Place the instanced road from the scroll distance and move instances that passed the despawn threshold to the front
+	 */
+	void UpdateInstancedRoad();
+
+	/**
+	 * Initialize tile object pool
+	 * @return True if initialized successfully
+	 */
+	bool InitializeTilePool();
+
+	/**
+	 * Analytic placement: recycle/spawn every tile the scroll distance requires and place all tiles from the shared scroll phase
+	 */
+	void UpdateAnalyticTiles();
+
 private:
 	/**
 	 * Load configuration from data table
@@ -135,10 +253,20 @@ private:
 	bool LoadConfigFromDataTable();
 
 	/**
-	 * Initialize tile object pool
-	 * @return True if initialized successfully
+	 * Resolve the configured tile mesh/material overrides (call once they are resident)
 	 */
-	bool InitializeTilePool();
+	void ResolveTileAssets();
+
+	/**
+	 * Resolve the tile assets and build the road (instanced road, or tile pool and initial tiles)
+	 */
+	void StartRoad();
+
+	/**
+	 * OnPreloadComplete handler: run the road setup deferred by BeginPlay
+	 */
+	UFUNCTION()
+	void HandleTileAssetsPreloaded();
 
 	/**
 	 * Spawn initial tiles to fill the road
@@ -152,11 +280,46 @@ private:
 	 */
 	class AGroundTile* SpawnTile(const FVector& Position);
 
+	/**
+	 * Configure a tile freshly taken from the pool and add it to the active list
+	 * @param TileActor - Actor returned by the tile pool
+	 * @param TileHandle - Pool handle for the actor
+	 * @return Configured tile, or nullptr if the actor is not a ground tile (it is returned to the pool)
+	 */
+	class AGroundTile* SetupSpawnedTile(AActor* TileActor, const FPooledActorHandle& TileHandle);
+
 	/**
 	 * Recycle a tile that has passed behind the war rig
 	 * @param Tile - Tile to recycle
+	 * @param Handle - Pool handle issued when the tile was spawned
+	 */
+	void RecycleTile(class AGroundTile* Tile, const FPooledActorHandle& Handle);
+
+	/**
+	 * Get the ring index of the Nth active tile counted from the rear
+	 * @param Offset - 0 for the rearmost tile, ActiveTileCount - 1 for the furthest
+	 * @return Index into ActiveTiles/ActiveTileHandles
+	 */
+	int32 GetActiveTileRingIndex(int32 Offset) const { return (ActiveTileHead + Offset) % ActiveTiles.Num(); }
+
+	/**
+	 * Add a tile in front of the current furthest tile (grows the ring when full)
+	 * @param Tile - Tile to add
+	 * @param Handle - Pool handle for the tile
+	 */
+	void PushFrontTile(class AGroundTile* Tile, const FPooledActorHandle& Handle);
+
+	/**
+	 * Remove the rearmost tile from the ring (does not return it to the pool)
+	 */
+	void PopBackTile();
+
+	/**
+	 * Build the transform for an instance whose tile origin is at LocalX
+	 * @param LocalX - Component-space X of the tile origin
+	 * @return Instance transform in component space
 	 */
-	void RecycleTile(class AGroundTile* Tile);
+	FTransform MakeRoadInstanceTransform(float LocalX) const;
 
 	/**
 	 * Get war rig reference